@@ -0,0 +1,68 @@
+# Copyright (C) 2005 - 2024 Settlers Freaks <sf-team at siedler25.org>
+#
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+#.rst:
+# FindZstd
+# -----------
+#
+# Find the Zstandard compression library
+#
+# Imported Targets
+# ^^^^^^^^^^^^^^^^
+#
+# This module defines the following :prop_tgt:`IMPORTED` targets:
+#
+# ``Zstd::Zstd``
+
+find_package(PkgConfig QUIET)
+
+if(PkgConfig_FOUND)
+  pkg_check_modules(PC_Zstd QUIET libzstd)
+  if(PC_Zstd_FOUND)
+    find_path(Zstd_INCLUDE_DIR
+      NAMES zstd.h
+      HINTS ${PC_Zstd_INCLUDE_DIRS}
+      NO_DEFAULT_PATH
+    )
+    find_library(Zstd_LIBRARY
+      NAMES zstd libzstd zstd_static
+      HINTS ${PC_Zstd_LIBRARY_DIRS} ${PC_Zstd_STATIC_LIBRARY_DIRS}
+      NO_DEFAULT_PATH
+    )
+  endif()
+endif()
+
+find_path(Zstd_INCLUDE_DIR
+  NAMES zstd.h
+)
+
+find_library(Zstd_LIBRARY
+    NAMES zstd libzstd zstd_static
+)
+
+if(Zstd_INCLUDE_DIR AND EXISTS "${Zstd_INCLUDE_DIR}/zstd.h")
+  file(STRINGS "${Zstd_INCLUDE_DIR}/zstd.h" versionLines REGEX "^#define ZSTD_VERSION_(MAJOR|MINOR|RELEASE) +[0-9]+")
+  foreach(part MAJOR MINOR RELEASE)
+    string(REGEX MATCH "ZSTD_VERSION_${part} +([0-9]+)" _ "${versionLines}")
+    set(Zstd_VERSION_${part} "${CMAKE_MATCH_1}")
+  endforeach()
+  set(Zstd_VERSION "${Zstd_VERSION_MAJOR}.${Zstd_VERSION_MINOR}.${Zstd_VERSION_RELEASE}")
+endif()
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Zstd
+  REQUIRED_VARS Zstd_LIBRARY Zstd_INCLUDE_DIR
+  VERSION_VAR Zstd_VERSION
+)
+
+if(Zstd_FOUND)
+  if(NOT TARGET Zstd::Zstd)
+    add_library(Zstd::Zstd UNKNOWN IMPORTED)
+    set_target_properties(Zstd::Zstd PROPERTIES
+      INTERFACE_INCLUDE_DIRECTORIES "${Zstd_INCLUDE_DIR}"
+      IMPORTED_LOCATION "${Zstd_LIBRARY}")
+  endif()
+endif()
+
+mark_as_advanced(Zstd_INCLUDE_DIR Zstd_LIBRARY)
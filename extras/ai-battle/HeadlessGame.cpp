@@ -21,6 +21,22 @@
 #    include "Windows.h"
 #endif
 
+std::string HeadlessGame::GetSummary() const
+{
+    std::stringstream ss;
+    ss << "GF " << em_.GetCurrentGF() << (game_.IsGameFinished() ? " (finished)" : "") << '\n';
+    for(unsigned playerId = 0; playerId < world_.GetNumPlayers(); ++playerId)
+    {
+        const GamePlayer& player = world_.GetPlayer(playerId);
+        ss << "  " << player.name << (player.IsDefeated() ? " (defeated)" : "")
+           << ": Country=" << player.GetStatisticCurrentValue(StatisticType::Country)
+           << " Buildings=" << player.GetStatisticCurrentValue(StatisticType::Buildings)
+           << " Military=" << player.GetStatisticCurrentValue(StatisticType::Military)
+           << " Gold=" << player.GetStatisticCurrentValue(StatisticType::Gold) << '\n';
+    }
+    return ss.str();
+}
+
 std::vector<PlayerInfo> GeneratePlayerInfo(const std::vector<AI::Info>& ais);
 std::string ToString(const std::chrono::milliseconds& time);
 std::string HumanReadableNumber(unsigned num);
@@ -43,7 +59,7 @@ void printConsole(const char* fmt, ...);
 
 HeadlessGame::HeadlessGame(const GlobalGameSettings& ggs, const bfs::path& map, const std::vector<AI::Info>& ais)
     : map_(map), game_(ggs, std::make_unique<EventManager>(0), GeneratePlayerInfo(ais)), world_(game_.world_),
-      em_(*static_cast<EventManager*>(game_.em_.get()))
+      em_(*static_cast<EventManager*>(game_.em_.get())), aiRunner_(world_)
 {
     MapLoader loader(world_);
     if(!loader.Load(map))
@@ -96,26 +112,27 @@ void HeadlessGame::Run(unsigned maxGF)
             }
         }
 
-        for(auto& player : players_)
-            player->RunGF(em_.GetCurrentGF(), isnfw);
+        aiRunner_.RunGF(players_, em_.GetCurrentGF(), isnfw);
 
         game_.RunGF();
 
         if(replay_.IsRecording())
             replay_.UpdateLastGF(em_.GetCurrentGF());
 
-        if(std::chrono::steady_clock::now() > nextReport)
+        if(printState_ && std::chrono::steady_clock::now() > nextReport)
         {
             nextReport += std::chrono::seconds(1);
             PrintState();
         }
     }
-    PrintState();
+    if(printState_)
+        PrintState();
 }
 
 void HeadlessGame::Close()
 {
-    bnw::cout << '\n';
+    if(printState_)
+        bnw::cout << '\n';
 
     if(replay_.IsRecording())
     {
@@ -183,9 +200,8 @@ std::string HumanReadableNumber(unsigned num)
 
 void HeadlessGame::PrintState()
 {
-    static bool first_run = true;
-    if(first_run)
-        first_run = false;
+    if(firstPrint_)
+        firstPrint_ = false;
     else
         printConsole("\x1b[%dA", 8 + world_.GetNumPlayers()); // Move cursor back up
 
@@ -7,10 +7,12 @@
 #include "Game.h"
 #include "Replay.h"
 #include "ai/AIPlayer.h"
+#include "ai/AIRunner.h"
 #include "gameTypes/AIInfo.h"
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <limits>
+#include <string>
 #include <vector>
 
 class GameWorld;
@@ -29,6 +31,12 @@ public:
 
     void RecordReplay(const boost::filesystem::path& path, unsigned random_init);
     void SaveGame(const boost::filesystem::path& path) const;
+    /// Enable/Disable the live status display on the console
+    void SetPrintState(bool printState) { printState_ = printState; }
+    /// Get a summary of the current state (GF and player statistics)
+    std::string GetSummary() const;
+    /// Set the number of threads used to run the AI players
+    void SetNumAIThreads(unsigned numThreads) { aiRunner_.SetNumThreads(numThreads); }
 
 private:
     void PrintState();
@@ -38,10 +46,13 @@ private:
     GameWorld& world_;
     EventManager& em_;
     std::vector<std::unique_ptr<AIPlayer>> players_;
+    AIRunner aiRunner_;
 
     Replay replay_;
     boost::filesystem::path replayPath_;
 
     unsigned lastReportGf_ = 0;
     std::chrono::steady_clock::time_point gameStartTime_;
+    bool printState_ = true;
+    bool firstPrint_ = true;
 };
@@ -17,11 +17,52 @@
 #include <boost/nowide/iostream.hpp>
 #include <boost/optional.hpp>
 #include <boost/program_options.hpp>
+#include <exception>
+#include <thread>
 
 namespace bnw = boost::nowide;
 namespace bfs = boost::filesystem;
 namespace po = boost::program_options;
 
+namespace {
+/// Append the index to the filename, e.g. "foo.sav" -> "foo_1.sav"
+bfs::path addIndexToPath(const bfs::path& path, unsigned idx)
+{
+    bfs::path result = path.parent_path() / path.stem();
+    result += "_" + std::to_string(idx);
+    result += path.extension();
+    return result;
+}
+
+struct GameSetup
+{
+    GlobalGameSettings ggs;
+    bfs::path mapPath;
+    std::vector<AI::Info> ais;
+    unsigned maxGF;
+    unsigned numAIThreads;
+};
+
+/// Run a single game. Can be called in parallel from multiple threads as all game state is per thread
+std::string runGame(const GameSetup& setup, unsigned random_init, const boost::optional<std::string>& replay_path,
+                    const boost::optional<std::string>& savegame_path, bool printState)
+{
+    RANDOM.Init(random_init);
+
+    HeadlessGame game(setup.ggs, setup.mapPath, setup.ais);
+    game.SetPrintState(printState);
+    game.SetNumAIThreads(setup.numAIThreads);
+    if(replay_path)
+        game.RecordReplay(*replay_path, random_init);
+
+    game.Run(setup.maxGF);
+    game.Close();
+    if(savegame_path)
+        game.SaveGame(*savegame_path);
+    return game.GetSummary();
+}
+} // namespace
+
 int main(int argc, char** argv)
 {
     bnw::nowide_filesystem();
@@ -30,6 +71,7 @@ int main(int argc, char** argv)
     boost::optional<std::string> replay_path;
     boost::optional<std::string> savegame_path;
     unsigned random_init = static_cast<unsigned>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    unsigned numParallel = 1;
 
     po::options_description desc("Allowed options");
     // clang-format off
@@ -42,6 +84,8 @@ int main(int argc, char** argv)
         ("save", po::value(&savegame_path),"Filename to write savegame to (optional)")
         ("random_init", po::value(&random_init),"Seed value for the random number generator (optional)")
         ("maxGF", po::value<unsigned>()->default_value(std::numeric_limits<unsigned>::max()),"Maximum number of game frames to run (optional)")
+        ("parallel", po::value(&numParallel),"Number of games to run in parallel using seeds random_init, random_init+1, ... (optional)")
+        ("ai-threads", po::value<unsigned>()->default_value(1),"Number of threads to run the AI players of each game on (optional)")
         ("version", "Show version information and exit")
         ;
     // clang-format on
@@ -88,12 +132,14 @@ int main(int argc, char** argv)
         bnw::cout << std::endl;
 
         RTTRCONFIG.Init();
-        RANDOM.Init(random_init);
 
-        const bfs::path mapPath = RTTRCONFIG.ExpandPath(options["map"].as<std::string>());
-        const std::vector<AI::Info> ais = ParseAIOptions(options["ai"].as<std::vector<std::string>>());
+        GameSetup setup;
+        setup.mapPath = RTTRCONFIG.ExpandPath(options["map"].as<std::string>());
+        setup.ais = ParseAIOptions(options["ai"].as<std::vector<std::string>>());
+        setup.maxGF = options["maxGF"].as<unsigned>();
+        setup.numAIThreads = options["ai-threads"].as<unsigned>();
 
-        GlobalGameSettings ggs;
+        GlobalGameSettings& ggs = setup.ggs;
         const auto objective = options["objective"].as<std::string>();
         if(objective == "domination")
             ggs.objective = GameObjective::TotalDomination;
@@ -106,14 +152,51 @@ int main(int argc, char** argv)
         }
 
         ggs.objective = GameObjective::TotalDomination;
-        HeadlessGame game(ggs, mapPath, ais);
-        if(replay_path)
-            game.RecordReplay(*replay_path, random_init);
-
-        game.Run(options["maxGF"].as<unsigned>());
-        game.Close();
-        if(savegame_path)
-            game.SaveGame(*savegame_path);
+        if(numParallel <= 1)
+        {
+            runGame(setup, random_init, replay_path, savegame_path, true);
+            return 0;
+        }
+
+        // Each game runs in its own thread with its own world, object counters and RNG
+        std::vector<std::thread> threads;
+        std::vector<std::string> results(numParallel);
+        std::vector<std::exception_ptr> errors(numParallel);
+        for(unsigned i = 0; i < numParallel; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                try
+                {
+                    boost::optional<std::string> curReplayPath, curSavegamePath;
+                    if(replay_path)
+                        curReplayPath = addIndexToPath(*replay_path, i).string();
+                    if(savegame_path)
+                        curSavegamePath = addIndexToPath(*savegame_path, i).string();
+                    results[i] = runGame(setup, random_init + i, curReplayPath, curSavegamePath, false);
+                } catch(...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for(std::thread& thread : threads)
+            thread.join();
+        int exitCode = 0;
+        for(unsigned i = 0; i < numParallel; ++i)
+        {
+            bnw::cout << "Game " << i << " (random_init: " << random_init + i << "): ";
+            try
+            {
+                if(errors[i])
+                    std::rethrow_exception(errors[i]);
+                bnw::cout << results[i];
+            } catch(const std::exception& e)
+            {
+                bnw::cout << "Error: " << e.what() << std::endl;
+                exitCode = 1;
+            }
+        }
+        return exitCode;
     } catch(const std::exception& e)
     {
         bnw::cerr << e.what() << std::endl;
@@ -0,0 +1,119 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "HeadlessReplay.h"
+#include "RTTR_Version.h"
+#include "ReplayKeyframes.h"
+#include "RttrConfig.h"
+#include "s25util/System.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/args.hpp>
+#include <boost/nowide/filesystem.hpp>
+#include <boost/nowide/iostream.hpp>
+#include <boost/program_options.hpp>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace bnw = boost::nowide;
+namespace bfs = boost::filesystem;
+namespace po = boost::program_options;
+
+namespace {
+/// Play the replay and write a keyframe every interval GFs into the keyframe file next to it
+void createKeyframes(const bfs::path& replayPath, unsigned interval)
+{
+    HeadlessReplay player(replayPath);
+    Replay& replay = player.GetReplay();
+    ReplayKeyframes keyframes;
+    const bfs::path keyframesPath = ReplayKeyframes::GetFilePath(replayPath);
+    if(!keyframes.StartWriting(keyframesPath, replay))
+        throw std::runtime_error(keyframes.GetLastErrorMsg());
+
+    for(unsigned gf = interval; gf <= replay.GetLastGF(); gf += interval)
+    {
+        player.RunUntil(gf);
+        if(player.IsFinished())
+            break;
+        keyframes.AddKeyframe(player.GetGame(), player.GetCommandPos(), replay.GetMapName());
+        bnw::cout << "\r" << gf << "/" << replay.GetLastGF() << " GFs" << std::flush;
+    }
+    keyframes.Close();
+    bnw::cout << "\r" << keyframes.GetKeyframes().size() << " keyframes written to " << keyframesPath << std::endl;
+    if(player.GetNumAsyncGFs() > 0)
+        bnw::cout << "Warning: Replay is not in sync in " << player.GetNumAsyncGFs() << " GFs" << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bnw::nowide_filesystem();
+    bnw::args _(argc, argv);
+
+    unsigned interval = 12000;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help,h", "Show help")
+        ("replay", po::value<std::vector<std::string>>()->required(),"Replay(s) to create keyframes for")
+        ("interval", po::value(&interval),"Number of GFs between keyframes (optional)")
+        ("version", "Show version information and exit")
+        ;
+    // clang-format on
+    po::positional_options_description positionalOptions;
+    positionalOptions.add("replay", -1);
+
+    if(argc == 1)
+    {
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    po::variables_map options;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positionalOptions).run(), options);
+
+        if(options.count("help"))
+        {
+            bnw::cout << desc << std::endl;
+            return 0;
+        }
+        if(options.count("version"))
+        {
+            bnw::cout << rttr::version::GetTitle() << " v" << rttr::version::GetVersion() << "-"
+                      << rttr::version::GetRevision() << std::endl
+                      << "Compiled with " << System::getCompilerName() << " for " << System::getOSName() << std::endl;
+            return 0;
+        }
+
+        po::notify(options);
+        if(interval == 0)
+            throw std::invalid_argument("interval must be positive");
+    } catch(const std::exception& e)
+    {
+        bnw::cerr << "Error: " << e.what() << std::endl;
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    RTTRCONFIG.Init();
+
+    int exitCode = 0;
+    for(const std::string& replayPath : options["replay"].as<std::vector<std::string>>())
+    {
+        try
+        {
+            createKeyframes(RTTRCONFIG.ExpandPath(replayPath), interval);
+        } catch(const std::exception& e)
+        {
+            bnw::cerr << replayPath << ": " << e.what() << std::endl;
+            exitCode = 1;
+        }
+    }
+    return exitCode;
+}
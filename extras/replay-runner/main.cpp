@@ -0,0 +1,136 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "HeadlessReplay.h"
+#include "RTTR_Version.h"
+#include "RttrConfig.h"
+#include "s25util/System.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/args.hpp>
+#include <boost/nowide/filesystem.hpp>
+#include <boost/nowide/iostream.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+namespace bnw = boost::nowide;
+namespace bfs = boost::filesystem;
+namespace po = boost::program_options;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double toSeconds(const Clock::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+/// Load the replay (from the last keyframe before startGF if possible) and run it up to the target GF.
+/// Only the simulation is timed, not the loading.
+void runReplay(const bfs::path& replayPath, unsigned startGF, unsigned targetGF, unsigned reportInterval)
+{
+    const auto loadStart = Clock::now();
+    HeadlessReplay player(replayPath, startGF);
+    const auto loadTime = Clock::now() - loadStart;
+    targetGF = std::min(targetGF, player.GetReplay().GetLastGF() + 1);
+    bnw::cout << "Loaded " << replayPath << " at GF " << player.GetCurrentGF() << " in " << toSeconds(loadTime)
+              << "s" << std::endl;
+
+    const unsigned firstGF = player.GetCurrentGF();
+    const auto runStart = Clock::now();
+    while(player.GetCurrentGF() < targetGF && !player.IsFinished())
+    {
+        const auto chunkStart = Clock::now();
+        const unsigned numGFs = player.RunUntil(std::min(player.GetCurrentGF() + reportInterval, targetGF));
+        if(numGFs == 0)
+            break;
+        const double chunkTime = toSeconds(Clock::now() - chunkStart);
+        bnw::cout << "GF " << player.GetCurrentGF() << "/" << targetGF << ": " << (chunkTime * 1000 / numGFs)
+                  << " ms/GF" << std::endl;
+    }
+    const double runTime = toSeconds(Clock::now() - runStart);
+    const unsigned numGFs = player.GetCurrentGF() - firstGF;
+
+    bnw::cout << "Executed " << numGFs << " GFs in " << runTime << "s";
+    if(numGFs > 0 && runTime > 0)
+        bnw::cout << " (" << (numGFs / runTime) << " GF/s, " << (runTime * 1000 / numGFs) << " ms/GF)";
+    bnw::cout << std::endl;
+    if(player.GetNumAsyncGFs() > 0)
+        bnw::cout << "Warning: Replay is not in sync in " << player.GetNumAsyncGFs() << " GFs" << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bnw::nowide_filesystem();
+    bnw::args _(argc, argv);
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help,h", "Show help")
+        ("replay", po::value<std::string>()->required(), "Replay to run")
+        ("skip-to", po::value<unsigned>(), "GF to run the replay to. Defaults to the end of the replay (optional)")
+        ("start", po::value<unsigned>()->default_value(0),
+            "GF to start timing at. Loaded from a keyframe if the replay has them (optional)")
+        ("report-interval", po::value<unsigned>()->default_value(10000), "Number of GFs between progress reports")
+        ("version", "Show version information and exit")
+        ;
+    // clang-format on
+    po::positional_options_description positionalOptions;
+    positionalOptions.add("replay", 1);
+
+    if(argc == 1)
+    {
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    po::variables_map options;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positionalOptions).run(), options);
+
+        if(options.count("help"))
+        {
+            bnw::cout << desc << std::endl;
+            return 0;
+        }
+        if(options.count("version"))
+        {
+            bnw::cout << rttr::version::GetTitle() << " v" << rttr::version::GetVersion() << "-"
+                      << rttr::version::GetRevision() << std::endl
+                      << "Compiled with " << System::getCompilerName() << " for " << System::getOSName() << std::endl;
+            return 0;
+        }
+
+        po::notify(options);
+        if(options["report-interval"].as<unsigned>() == 0)
+            throw std::invalid_argument("report-interval must be positive");
+    } catch(const std::exception& e)
+    {
+        bnw::cerr << "Error: " << e.what() << std::endl;
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    RTTRCONFIG.Init();
+
+    const std::string replayPath = options["replay"].as<std::string>();
+    try
+    {
+        const unsigned targetGF = options.count("skip-to") ? options["skip-to"].as<unsigned>() : ~0u;
+        runReplay(RTTRCONFIG.ExpandPath(replayPath), options["start"].as<unsigned>(), targetGF,
+                  options["report-interval"].as<unsigned>());
+    } catch(const std::exception& e)
+    {
+        bnw::cerr << replayPath << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
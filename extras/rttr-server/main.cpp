@@ -0,0 +1,232 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GlobalGameSettings.h"
+#include "QuickStartGame.h"
+#include "RTTR_Version.h"
+#include "RttrConfig.h"
+#include "addons/const_addons.h"
+#include "network/CreateServerInfo.h"
+#include "network/GameServer.h"
+#include "gameTypes/MapDescription.h"
+#include "gameData/MaxPlayers.h"
+#include "s25util/System.h"
+#include "s25util/strAlgos.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/args.hpp>
+#include <boost/nowide/filesystem.hpp>
+#include <boost/nowide/fstream.hpp>
+#include <boost/nowide/iostream.hpp>
+#include <boost/optional.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <csignal>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bnw = boost::nowide;
+namespace bfs = boost::filesystem;
+namespace po = boost::program_options;
+
+namespace {
+/// Time between 2 runs of the server loop. The NWFs are timed by the server itself, this only limits the latency
+constexpr std::chrono::milliseconds tickLength(1);
+
+volatile std::sig_atomic_t stopRequested = 0;
+
+void requestStop(int /*sig*/)
+{
+    stopRequested = 1;
+}
+
+/// Parse "<ADDON_NAME>=<value>" and set it in the settings
+void setAddon(GlobalGameSettings& ggs, const std::string& option)
+{
+    const auto sepPos = option.find('=');
+    if(sepPos == std::string::npos)
+        throw std::invalid_argument("Invalid addon setting '" + option + "', expected <name>=<value>");
+    const std::string name = s25util::toUpper(option.substr(0, sepPos));
+    const auto value = static_cast<unsigned>(std::stoul(option.substr(sepPos + 1)));
+    for(const AddonId id : rttrEnum::values<AddonId>)
+    {
+        if(name == rttrEnum::toString(id) || name == std::string("ADDON_") + rttrEnum::toString(id))
+        {
+            ggs.setSelection(id, value);
+            return;
+        }
+    }
+    throw std::invalid_argument("Unknown addon: " + name);
+}
+
+GameObjective parseObjective(const std::string& objective)
+{
+    if(objective == "none")
+        return GameObjective::None;
+    if(objective == "domination")
+        return GameObjective::TotalDomination;
+    if(objective == "conquer")
+        return GameObjective::Conquer3_4;
+    throw std::invalid_argument("Unknown objective: " + objective);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bnw::nowide_filesystem();
+    bnw::args _(argc, argv);
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help,h", "Show help")
+        ("config,c", po::value<std::string>(),
+            "Config file with the options below as <option>=<value> lines (optional)")
+        ("map,m", po::value<std::string>()->required(), "Map or savegame to host")
+        ("lua", po::value<std::string>(), "Lua script of the map. Defaults to the one next to the map (optional)")
+        ("name", po::value<std::string>()->default_value("Dedicated Server"), "Name of the game")
+        ("port,p", po::value<unsigned short>()->default_value(3665), "Port to listen on")
+        ("password", po::value<std::string>()->default_value(""), "Password required to join (optional)")
+        ("host-password", po::value<std::string>()->default_value(""),
+            "Password of the admin. The first client joining with it becomes the host which controls the lobby and "
+            "runs the AIs (optional)")
+        ("lan", "Announce the game in the local network")
+        ("ipv6", "Use IPv6")
+        ("ai", po::value<std::vector<std::string>>()->composing(),
+            "AI player(s) to put on the first free slots (optional)")
+        ("objective", po::value<std::string>()->default_value("none"), "none(default)|domination|conquer")
+        ("addon", po::value<std::vector<std::string>>()->composing(), "Addon setting as <name>=<value> (optional)")
+        ("countdown", po::value<unsigned>()->default_value(5),
+            "Seconds to wait before starting when all players are ready and no host is connected")
+        ("version", "Show version information and exit")
+        ;
+    // clang-format on
+
+    if(argc == 1)
+    {
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    po::variables_map options;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv).options(desc).run(), options);
+
+        if(options.count("help"))
+        {
+            bnw::cout << desc << std::endl;
+            return 0;
+        }
+        if(options.count("version"))
+        {
+            bnw::cout << rttr::version::GetTitle() << " v" << rttr::version::GetVersion() << "-"
+                      << rttr::version::GetRevision() << std::endl
+                      << "Compiled with " << System::getCompilerName() << " for " << System::getOSName() << std::endl;
+            return 0;
+        }
+        // Command line takes precedence as the first stored value wins
+        if(options.count("config"))
+        {
+            bnw::ifstream configFile(options["config"].as<std::string>());
+            if(!configFile)
+                throw std::runtime_error("Could not open config file " + options["config"].as<std::string>());
+            po::store(po::parse_config_file(configFile, desc), options);
+        }
+
+        po::notify(options);
+    } catch(const std::exception& e)
+    {
+        bnw::cerr << "Error: " << e.what() << std::endl;
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        RTTRCONFIG.Init();
+
+        const bfs::path mapPath = RTTRCONFIG.ExpandPath(options["map"].as<std::string>());
+        const MapType mapType =
+          s25util::toLower(mapPath.extension().string()) == ".sav" ? MapType::Savegame : MapType::OldMap;
+        boost::optional<bfs::path> luaPath;
+        if(options.count("lua"))
+            luaPath = RTTRCONFIG.ExpandPath(options["lua"].as<std::string>());
+
+        std::vector<AI::Info> ais;
+        if(options.count("ai"))
+            ais = ParseAIOptions(options["ai"].as<std::vector<std::string>>());
+        const std::string hostPassword = options["host-password"].as<std::string>();
+        // Only the host client executes the AIs
+        if(!ais.empty() && hostPassword.empty())
+            throw std::invalid_argument("AI players require a host password as the host runs them");
+
+        const CreateServerInfo csi(options.count("lan") ? ServerType::LAN : ServerType::Direct,
+                                   options["port"].as<unsigned short>(), options["name"].as<std::string>(),
+                                   options["password"].as<std::string>(), options.count("ipv6") > 0);
+        if(!GAMESERVER.Start(csi, MapDescription(mapPath, mapType, luaPath), hostPassword))
+            throw std::runtime_error("Could not start the server for " + mapPath.string());
+
+        if(mapType == MapType::OldMap)
+        {
+            GlobalGameSettings ggs;
+            ggs.objective = parseObjective(options["objective"].as<std::string>());
+            if(options.count("addon"))
+            {
+                for(const std::string& addon : options["addon"].as<std::vector<std::string>>())
+                    setAddon(ggs, addon);
+            }
+            GAMESERVER.SetGGS(ggs);
+        }
+        unsigned numAIsSet = 0;
+        for(unsigned playerIdx = 0; playerIdx < MAX_PLAYERS && numAIsSet < ais.size(); ++playerIdx)
+        {
+            if(GAMESERVER.SetAIPlayer(playerIdx, ais[numAIsSet]))
+                ++numAIsSet;
+        }
+        if(numAIsSet < ais.size())
+            throw std::invalid_argument("Not enough free slots for the AI players");
+        // AI slots of savegames need a host too
+        if(hostPassword.empty() && GAMESERVER.HasAIPlayers())
+            throw std::invalid_argument("AI players require a host password as the host runs them");
+        GAMESERVER.SetAutoStart(hostPassword.empty(), options["countdown"].as<unsigned>());
+
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+#ifndef _WIN32
+        // Writing to a closed socket must not kill the server
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+        bnw::cout << "Hosting " << mapPath << " on port " << csi.port << std::endl;
+        auto nextTick = std::chrono::steady_clock::now();
+        while(GAMESERVER.IsRunning())
+        {
+            if(stopRequested)
+            {
+                GAMESERVER.Stop();
+                break;
+            }
+            GAMESERVER.Run();
+            nextTick += tickLength;
+            const auto now = std::chrono::steady_clock::now();
+            // Don't try to catch up after a stall, the server handles delayed GFs itself
+            if(nextTick < now)
+                nextTick = now;
+            else
+                std::this_thread::sleep_until(nextTick);
+        }
+        bnw::cout << "Server stopped" << std::endl;
+    } catch(const std::exception& e)
+    {
+        GAMESERVER.Stop();
+        bnw::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AsyncSavegameWriter.h"
+#include "Savegame.h"
+#include <boost/filesystem/operations.hpp>
+#include <exception>
+
+AsyncSavegameWriter::AsyncSavegameWriter() : worker_(&AsyncSavegameWriter::WorkerMain, this) {}
+
+AsyncSavegameWriter::~AsyncSavegameWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    startCond_.notify_one();
+    worker_.join();
+}
+
+bool AsyncSavegameWriter::Write(std::unique_ptr<Savegame> savegame, const boost::filesystem::path& filepath,
+                                const std::string& mapName)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(savegame_)
+            return false;
+        savegame_ = std::move(savegame);
+        filepath_ = filepath;
+        mapName_ = mapName;
+    }
+    startCond_.notify_one();
+    return true;
+}
+
+bool AsyncSavegameWriter::IsBusy() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !!savegame_;
+}
+
+void AsyncSavegameWriter::Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCond_.wait(lock, [this]() { return !savegame_; });
+}
+
+std::vector<std::string> AsyncSavegameWriter::TakeErrors()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::move(errors_);
+}
+
+void AsyncSavegameWriter::WorkerMain()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(true)
+    {
+        // Write pending savegame before stopping
+        startCond_.wait(lock, [this]() { return stop_ || savegame_; });
+        if(!savegame_)
+            return;
+        // The savegame is only accessed by this thread until it is reset
+        lock.unlock();
+        WriteCurrentSavegame();
+        lock.lock();
+        savegame_.reset();
+        doneCond_.notify_all();
+    }
+}
+
+void AsyncSavegameWriter::WriteCurrentSavegame()
+{
+    boost::filesystem::path tmpFilepath = filepath_;
+    tmpFilepath += ".tmp";
+    std::string error;
+    try
+    {
+        if(savegame_->Save(tmpFilepath, mapName_))
+            boost::filesystem::rename(tmpFilepath, filepath_);
+        else
+            error = "Could not write " + tmpFilepath.string();
+    } catch(const std::exception& e)
+    {
+        error = e.what();
+    }
+    if(!error.empty())
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove(tmpFilepath, ec);
+        std::lock_guard<std::mutex> lock(mutex_);
+        errors_.push_back(error);
+    }
+}
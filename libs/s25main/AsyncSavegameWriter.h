@@ -0,0 +1,55 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Savegame;
+
+/// Writes savegames in a background thread, so the game is only paused for the snapshot.
+/// At most 1 savegame is written at a time to limit the memory used. The file is first written to a temporary file
+/// and then renamed, so an existing savegame is never replaced by a partially written one.
+class AsyncSavegameWriter
+{
+public:
+    AsyncSavegameWriter();
+    AsyncSavegameWriter(const AsyncSavegameWriter&) = delete;
+    AsyncSavegameWriter& operator=(const AsyncSavegameWriter&) = delete;
+    /// Waits for the current savegame to be written
+    ~AsyncSavegameWriter();
+
+    /// Start writing the savegame (compressing its game data) to the file.
+    /// Return false and do nothing if the previous savegame is still being written
+    bool Write(std::unique_ptr<Savegame> savegame, const boost::filesystem::path& filepath, const std::string& mapName);
+    /// Return true if a savegame is currently being written
+    bool IsBusy() const;
+    /// Wait until the current savegame is written
+    void Wait();
+    /// Return the errors of all savegames finished since the last call
+    std::vector<std::string> TakeErrors();
+
+private:
+    void WorkerMain();
+    void WriteCurrentSavegame();
+
+    std::thread worker_;
+    /// Protects all members below
+    mutable std::mutex mutex_;
+    /// Signals the worker that a savegame is ready or it should stop
+    std::condition_variable startCond_;
+    /// Signals that the savegame was written
+    std::condition_variable doneCond_;
+    std::unique_ptr<Savegame> savegame_;
+    boost::filesystem::path filepath_;
+    std::string mapName_;
+    bool stop_ = false;
+    std::vector<std::string> errors_;
+};
@@ -9,6 +9,8 @@
 #include "helpers/containerUtils.h"
 #include "s25util/Log.h"
 #include <mygettext/mygettext.h>
+#include <algorithm>
+#include <limits>
 
 EventManager::EventManager(unsigned startGF)
     : numActiveEvents(0), eventInstanceCtr(1), currentGF(startGF), curActiveEvent(nullptr)
@@ -21,16 +23,20 @@ EventManager::~EventManager()
 
 void EventManager::Clear()
 {
-    for(const auto& event : events)
-    {
-        for(const GameEvent* ev : event.second)
+    const auto clearList = [this](ScheduledEventList& events) {
+        while(const GameEvent* ev = events.front())
         {
-            delete ev;
+            ScheduledEventList::unlink(*ev);
+            DestroyEvent(ev);
             RTTR_Assert(numActiveEvents > 0u);
             numActiveEvents--;
         }
-    }
-    events.clear();
+    };
+    for(ScheduledEventList& events : nearEvents)
+        clearList(events);
+    for(ScheduledEventList& events : overflowEvents)
+        clearList(events);
+    clearList(farEvents);
     RTTR_Assert(numActiveEvents == 0u);
 
     for(auto* it : killList)
@@ -47,21 +53,43 @@ void EventManager::Clear()
     eventInstanceCtr = 1u;
 }
 
+ScheduledEventList& EventManager::GetEventList(const unsigned targetGF)
+{
+    if(targetGF < GetNearEventsEndGF())
+        return nearEvents[targetGF % numNearSlots];
+    const unsigned block = targetGF / blockSize;
+    if(block < GetOverflowEventsEndBlock())
+        return overflowEvents[block % numOverflowSlots];
+    return farEvents;
+}
+
 const GameEvent* EventManager::AddEventToQueue(const GameEvent* event)
 {
     // Should be in the future!
     RTTR_Assert(event->GetTargetGF() > currentGF);
-    events[event->GetTargetGF()].push_back(event);
+    RTTR_Assert(!ScheduledEventList::isLinked(*event));
+    GetEventList(event->GetTargetGF()).push_back(*event);
+    if(!ObjectEventList::isLinked(*event))
+        event->obj->events_.push_back(*event);
     ++numActiveEvents;
     return event;
 }
 
+void EventManager::DestroyEvent(const GameEvent* event)
+{
+    RTTR_Assert(!ScheduledEventList::isLinked(*event));
+    // Might already be removed if the object was deleted
+    if(ObjectEventList::isLinked(*event))
+        ObjectEventList::unlink(*event);
+    eventPool.destroy(event);
+}
+
 const GameEvent* EventManager::AddEvent(GameObject* obj, unsigned gf_length, unsigned id)
 {
     RTTR_Assert(obj);
     RTTR_Assert(gf_length);
 
-    return AddEventToQueue(new GameEvent(GetNextEventInstanceId(), obj, currentGF, gf_length, id));
+    return AddEventToQueue(eventPool.create(GetNextEventInstanceId(), obj, currentGF, gf_length, id));
 }
 
 const GameEvent* EventManager::AddEvent(GameObject* obj, unsigned gf_length, unsigned id, unsigned gf_elapsed)
@@ -69,7 +97,12 @@ const GameEvent* EventManager::AddEvent(GameObject* obj, unsigned gf_length, uns
     RTTR_Assert(gf_length > gf_elapsed);
     // Anfang des Events in die Vergangenheit zurückverlegen
     RTTR_Assert(currentGF >= gf_elapsed);
-    return AddEventToQueue(new GameEvent(GetNextEventInstanceId(), obj, currentGF - gf_elapsed, gf_length, id));
+    return AddEventToQueue(eventPool.create(GetNextEventInstanceId(), obj, currentGF - gf_elapsed, gf_length, id));
+}
+
+const GameEvent* EventManager::DeserializeEvent(SerializedGameData& sgd, unsigned instanceId)
+{
+    return eventPool.create(sgd, instanceId);
 }
 
 unsigned EventManager::GetNextEventInstanceId()
@@ -82,12 +115,57 @@ unsigned EventManager::GetNextEventInstanceId()
 
 void EventManager::ExecuteNextGF()
 {
-    currentGF++;
+    AdvanceToGF(currentGF + 1);
 
     ExecuteCurrentEvents();
     DestroyCurrentObjects();
 }
 
+void EventManager::AdvanceToGF(const unsigned gf)
+{
+    RTTR_Assert(gf >= currentGF);
+    // Without events there is nothing to move between the wheels
+    if(numActiveEvents == 0u)
+    {
+        currentGF = gf;
+        return;
+    }
+    while(currentGF < gf)
+    {
+        // The block after the last one starts beyond the range of unsigned
+        const uint64_t nextBlockStartGF = (static_cast<uint64_t>(currentGF) / blockSize + 1) * blockSize;
+        if(nextBlockStartGF > gf)
+            currentGF = gf;
+        else
+        {
+            currentGF = static_cast<unsigned>(nextBlockStartGF);
+            StartNewBlock();
+        }
+    }
+}
+
+void EventManager::StartNewBlock()
+{
+    RTTR_Assert(currentGF % blockSize == 0u);
+    // The block after the current one is now covered by the near wheel.
+    // This happens before any event could be added directly to the near wheel for that block,
+    // so the order of events of the same GF is kept.
+    const unsigned nextBlock = currentGF / blockSize + 1;
+    ScheduledEventList& blockEvents = overflowEvents[nextBlock % numOverflowSlots];
+    while(const GameEvent* ev = blockEvents.front())
+    {
+        RTTR_Assert(ev->GetTargetGF() / blockSize == nextBlock);
+        ScheduledEventList::unlink(*ev);
+        nearEvents[ev->GetTargetGF() % numNearSlots].push_back(*ev);
+    }
+    // The now free slot is used for the block entering the overflow wheel
+    const unsigned newOverflowBlock = GetOverflowEventsEndBlock() - 1;
+    RTTR_Assert(newOverflowBlock % numOverflowSlots == nextBlock % numOverflowSlots);
+    farEvents.moveIf(blockEvents, [newOverflowBlock](const GameEvent& ev) {
+        return ev.GetTargetGF() / blockSize == newOverflowBlock;
+    });
+}
+
 void EventManager::DestroyCurrentObjects()
 {
     // Remove all objects
@@ -107,44 +185,72 @@ void EventManager::DestroyCurrentObjects()
 std::vector<const GameEvent*> EventManager::GetEvents() const
 {
     std::vector<const GameEvent*> nextEv;
-    for(const auto& event : events)
-        nextEv.insert(nextEv.end(), event.second.begin(), event.second.end());
+    nextEv.reserve(numActiveEvents);
+    const auto addEvent = [&nextEv](const GameEvent* ev) { nextEv.push_back(ev); };
+    // Events of the current GF are only left while they are executed
+    if(curActiveEvent)
+        nextEv.push_back(curActiveEvent);
+    const uint64_t nearEndGF = GetNearEventsEndGF();
+    for(uint64_t gf = currentGF; gf < nearEndGF; ++gf)
+        nearEvents[gf % numNearSlots].forEach(addEvent);
+    // Lists of multiple GFs are sorted by GF keeping the insertion order
+    const auto addSortedEvents = [&](const ScheduledEventList& events) {
+        const auto firstIdx = nextEv.size();
+        events.forEach(addEvent);
+        std::stable_sort(nextEv.begin() + firstIdx, nextEv.end(), [](const GameEvent* lhs, const GameEvent* rhs) {
+            return lhs->GetTargetGF() < rhs->GetTargetGF();
+        });
+    };
+    const unsigned overflowEndBlock = GetOverflowEventsEndBlock();
+    for(unsigned block = overflowEndBlock - numOverflowSlots; block < overflowEndBlock; ++block)
+        addSortedEvents(overflowEvents[block % numOverflowSlots]);
+    addSortedEvents(farEvents);
     return nextEv;
 }
 
-void EventManager::ExecuteCurrentEvents()
+unsigned EventManager::GetNextEventGF() const
 {
-    if(events.empty())
-        return;
-    // Get list of events to be executed next
-    auto itCurEvents = events.begin();
-
-    RTTR_Assert(itCurEvents->first >= currentGF);
-
-    if(itCurEvents->first == currentGF)
-        ExecuteEvents(itCurEvents);
+    const uint64_t nearEndGF = GetNearEventsEndGF();
+    for(uint64_t gf = static_cast<uint64_t>(currentGF) + 1; gf < nearEndGF; ++gf)
+    {
+        if(!nearEvents[gf % numNearSlots].empty())
+            return static_cast<unsigned>(gf);
+    }
+    unsigned nextGF = std::numeric_limits<unsigned>::max();
+    const auto updateNextGF = [&nextGF](const GameEvent* ev) { nextGF = std::min(nextGF, ev->GetTargetGF()); };
+    const unsigned overflowEndBlock = GetOverflowEventsEndBlock();
+    for(unsigned block = overflowEndBlock - numOverflowSlots; block < overflowEndBlock; ++block)
+    {
+        const ScheduledEventList& events = overflowEvents[block % numOverflowSlots];
+        if(!events.empty())
+        {
+            events.forEach(updateNextGF);
+            return nextGF;
+        }
+    }
+    farEvents.forEach(updateNextGF);
+    return nextGF;
 }
 
-void EventManager::ExecuteEvents(const EventMap::iterator& itEvents)
+void EventManager::ExecuteCurrentEvents()
 {
-    EventList& curEvents = itEvents->second;
-    // We have to allow 2 cases:
-    // 1) Adding of events to current GF -> std::list allows this without invalidating any iterators
-    // 2) Checking for events -> Remove all deleted events so only valid ones are in the list
-    for(auto e_it = curEvents.begin(); e_it != curEvents.end(); e_it = curEvents.erase(e_it))
+    ScheduledEventList& curEvents = nearEvents[currentGF % numNearSlots];
+    // Events are removed from the list before they are executed as executing an event may remove other events of the
+    // same GF. No events can be added to the current GF.
+    while(const GameEvent* ev = curEvents.front())
     {
-        const GameEvent* ev = *e_it;
+        RTTR_Assert(ev->GetTargetGF() == currentGF);
         RTTR_Assert(ev->obj);
         RTTR_Assert(ev->obj->GetObjId() <= GameObject::GetObjIDCounter());
+        ScheduledEventList::unlink(*ev);
 
         curActiveEvent = ev;
         ev->obj->HandleEvent(ev->id);
 
-        delete ev;
+        DestroyEvent(ev);
         --numActiveEvents;
     }
     curActiveEvent = nullptr;
-    events.erase(itEvents);
 }
 
 void EventManager::Serialize(SerializedGameData& sgd) const
@@ -183,30 +289,20 @@ void EventManager::Deserialize(SerializedGameData& sgd)
         boost::format eventCtError(_("Event count mismatch. Read events: %1%. Expected: %2%.\n"));
         throw SerializedGameData::Error((eventCtError % numActiveEvents % numEvents).str());
     }
-    for(const auto& it : events)
+    for(const GameEvent* ev : GetEvents())
     {
-        for(const GameEvent* ev : it.second)
+        if(ev->GetInstanceId() >= eventInstanceCtr)
         {
-            if(ev->GetInstanceId() >= eventInstanceCtr)
-            {
-                boost::format eventIdError(_("Invalid event instance id. Found: %1%. Expected less than %2%.\n"));
-                throw SerializedGameData::Error((eventIdError % ev->GetInstanceId() % eventInstanceCtr).str());
-            }
+            boost::format eventIdError(_("Invalid event instance id. Found: %1%. Expected less than %2%.\n"));
+            throw SerializedGameData::Error((eventIdError % ev->GetInstanceId() % eventInstanceCtr).str());
         }
     }
 }
 
 bool EventManager::ObjectHasEvents(const GameObject& obj)
 {
-    for(const auto& event : events)
-    {
-        for(const GameEvent* ev : event.second)
-        {
-            if(ev->obj == &obj)
-                return true;
-        }
-    }
-    return false;
+    // The currently executed event is kept in the list until it is finished
+    return !obj.events_.empty();
 }
 
 bool EventManager::IsObjectInKillList(const GameObject& obj)
@@ -227,36 +323,21 @@ void EventManager::RemoveEvent(const GameEvent*& ep)
         return;
     }
     RemoveEventFromQueue(*ep);
-    deletePtr(ep);
+    DestroyEvent(ep);
+    ep = nullptr;
 }
 
 void EventManager::RemoveEventFromQueue(const GameEvent& event)
 {
     RTTR_Assert(curActiveEvent != &event);
-    auto itEventsAtTime = events.find(event.GetTargetGF());
-    if(itEventsAtTime != events.end())
+    if(ScheduledEventList::isLinked(event))
     {
-        EventList& eventsAtTime = itEventsAtTime->second;
-        auto e_it = helpers::find(eventsAtTime, &event);
-        if(e_it != eventsAtTime.end())
-        {
-            eventsAtTime.erase(e_it);
-            --numActiveEvents;
-            RTTR_Assert(!helpers::contains(eventsAtTime, &event)); // Event existed multiple times?
-        } else
-        {
-            RTTR_Assert(false);
-            LOG.write("Bug detected: Event to be removed did not exist");
-        }
-
-        // Note: Removing this is possible, as it cannot be the currently processed list
-        //       because there is always the curActiveEvent left, which cannot be removed (check above)
-        if(eventsAtTime.empty())
-            events.erase(itEventsAtTime);
+        ScheduledEventList::unlink(event);
+        --numActiveEvents;
     } else
     {
         RTTR_Assert(false);
-        LOG.write("Bug detected: GF of event to be removed did not exist");
+        LOG.write("Bug detected: Event to be removed did not exist");
     }
 }
 
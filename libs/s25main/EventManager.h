@@ -4,19 +4,28 @@
 
 #pragma once
 
+#include "GameEvent.h"
+#include "GameEventPool.h"
+#include <array>
+#include <cstdint>
 #include <list>
-#include <map>
 #include <memory>
 #include <vector>
 
 class SerializedGameData;
-class GameEvent;
 class GameObject;
 
+/// Schedules and executes the GameEvents.
+/// Events are stored in a hierarchical timing wheel: Events due in the current or next block of GFs are in the near
+/// wheel with 1 slot per GF, events further away are in the overflow wheel with 1 slot per block and the rest in a
+/// single list. When a new block is reached the events of the following block are moved to the near wheel.
+/// Events of the same GF are always executed in the order they were added.
 class EventManager
 {
 public:
     explicit EventManager(unsigned startGF);
+    EventManager(const EventManager&) = delete;
+    EventManager& operator=(const EventManager&) = delete;
     ~EventManager();
 
     /// Deletes all events and objects to be killed. Then resets counters
@@ -43,27 +52,32 @@ public:
 
     void Serialize(SerializedGameData& sgd) const;
     void Deserialize(SerializedGameData& sgd);
+    /// Create an event from serialized data. It gets added to the queue in Deserialize
+    const GameEvent* DeserializeEvent(SerializedGameData& sgd, unsigned instanceId);
 
     unsigned GetNextEventInstanceId();
 
     unsigned GetCurrentGF() const { return currentGF; }
 
-    /// Return true if the object has any active events. SLOW!
+    /// Return true if the object has any active events
     bool ObjectHasEvents(const GameObject& obj);
     /// Return true if the object will be destroyed after the current GF
     bool IsObjectInKillList(const GameObject& obj);
 
 protected:
-    // Use list to allow removing of events while iterating (Event A can cause Event B in the same GF to be removed)
-    using EventList = std::list<const GameEvent*>;
-    using EventMap = std::map<unsigned, EventList>;
+    /// Number of GFs in one block
+    static constexpr unsigned blockSize = 512;
+    /// Slots of the near wheel: Holds all events up to the end of the next block
+    static constexpr unsigned numNearSlots = 2 * blockSize;
+    /// Slots (blocks) of the overflow wheel
+    static constexpr unsigned numOverflowSlots = 256;
+
     // Use list to allow adding events while iterating (Destroying 1 object may lead to destruction of another)
     using GameObjList = std::list<GameObject*>;
     unsigned numActiveEvents;
     /// Instances created. Must be != 0
     unsigned eventInstanceCtr;
     unsigned currentGF;
-    EventMap events;      /// Mapping of GF to Events to be executed in this GF
     GameObjList killList; /// Objects that will be killed after current GF
     const GameEvent* curActiveEvent;
 
@@ -71,10 +85,32 @@ protected:
     void RemoveEventFromQueue(const GameEvent& event);
     /// Execute all events of the current GF
     void ExecuteCurrentEvents();
-    /// Execute the events from the given iterator
-    void ExecuteEvents(const EventMap::iterator& itEvents);
     /// Destroy all objects in the kill list
     void DestroyCurrentObjects();
     /// Get all events in the order they will be processed
     std::vector<const GameEvent*> GetEvents() const;
+    /// Return the GF of the next event to be executed or the max value if there is none
+    unsigned GetNextEventGF() const;
+    /// Set the current GF to the given one. There must not be any events scheduled before it
+    void AdvanceToGF(unsigned gf);
+
+private:
+    GameEventPool eventPool;
+    /// Events of the current and next block. Slot is targetGF % numNearSlots
+    std::array<ScheduledEventList, numNearSlots> nearEvents;
+    /// Events of the blocks following the near wheel. Slot is block % numOverflowSlots
+    std::array<ScheduledEventList, numOverflowSlots> overflowEvents;
+    /// All events even further in the future
+    ScheduledEventList farEvents;
+
+    /// Return the first GF whose events are not in the near wheel. 64 bit as it may exceed the range of unsigned
+    uint64_t GetNearEventsEndGF() const { return (static_cast<uint64_t>(currentGF) / blockSize + 2) * blockSize; }
+    /// Return the first block whose events are not in the overflow wheel
+    unsigned GetOverflowEventsEndBlock() const { return currentGF / blockSize + 2 + numOverflowSlots; }
+    /// Return the list the event for the given GF has to be stored in
+    ScheduledEventList& GetEventList(unsigned targetGF);
+    /// Move the events of the block following the current one into the near wheel
+    void StartNewBlock();
+    /// Destroy an event which is no longer scheduled
+    void DestroyEvent(const GameEvent* event);
 };
@@ -10,6 +10,8 @@
 #include "addons/AddonEconomyModeGameLength.h"
 #include "addons/const_addons.h"
 #include "ai/AIPlayer.h"
+#include "ai/AIResourceValueCache.h"
+#include "ai/AIRunner.h"
 #include "lua/LuaInterfaceGame.h"
 #include "network/GameClient.h"
 #include "gameData/GameConsts.h"
@@ -20,7 +22,9 @@ Game::Game(GlobalGameSettings settings, unsigned startGF, const std::vector<Play
 {}
 
 Game::Game(GlobalGameSettings settings, std::unique_ptr<EventManager> em, const std::vector<PlayerInfo>& players)
-    : ggs_(std::move(settings)), em_(std::move(em)), world_(players, ggs_, *em_), started_(false), finished_(false)
+    : ggs_(std::move(settings)), em_(std::move(em)), world_(players, ggs_, *em_), started_(false), finished_(false),
+      aiRunner_(std::make_unique<AIRunner>(world_)),
+      aiResourceValues_(std::make_unique<AIResourceValueCache>(world_))
 {}
 
 Game::~Game() = default;
@@ -51,6 +55,16 @@ void Game::AddAIPlayer(std::unique_ptr<AIPlayer> newAI)
     aiPlayers_.push_back(std::move(newAI));
 }
 
+void Game::RunAIs(unsigned gf, bool isNWF)
+{
+    aiRunner_->RunGF(aiPlayers_, gf, isNWF);
+}
+
+void Game::SetNumAIThreads(unsigned numThreads)
+{
+    aiRunner_->SetNumThreads(numThreads);
+}
+
 void Game::SetLua(std::unique_ptr<LuaInterfaceGame> newLua)
 {
     lua = std::move(newLua);
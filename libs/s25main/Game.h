@@ -10,6 +10,8 @@
 #include <memory>
 
 class AIPlayer;
+class AIResourceValueCache;
+class AIRunner;
 
 /// Holds all data for a running game
 class Game
@@ -27,10 +29,16 @@ public:
     /// Does the remaining initializations for starting the game
     void Start(bool startFromSave);
     void RunGF();
+    /// Run the GF of all AI players. Has to be called before RunGF as the AIs must not run while the world changes
+    void RunAIs(unsigned gf, bool isNWF);
+    /// Set the number of threads used to run the AI players
+    void SetNumAIThreads(unsigned numThreads);
     bool IsStarted() const { return started_; }
     bool IsGameFinished() const { return finished_; }
     AIPlayer* GetAIPlayer(unsigned id);
     void AddAIPlayer(std::unique_ptr<AIPlayer> newAI);
+    /// Values shared by the AI players of this game
+    AIResourceValueCache& GetAIResourceValueCache() { return *aiResourceValues_; }
     void SetLua(std::unique_ptr<LuaInterfaceGame> newLua);
 
 private:
@@ -41,4 +49,6 @@ private:
 
     bool started_, finished_;
     std::unique_ptr<LuaInterfaceGame> lua;
+    std::unique_ptr<AIRunner> aiRunner_;
+    std::unique_ptr<AIResourceValueCache> aiResourceValues_;
 };
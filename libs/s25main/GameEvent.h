@@ -6,8 +6,31 @@
 
 class GameObject;
 class SerializedGameData;
+template<class T_Tag>
+class GameEventList;
 
-class GameEvent
+/// Tag for the list of events scheduled for the same GF (or block of GFs)
+struct ScheduledEventsTag;
+/// Tag for the list of events of a GameObject
+struct ObjectEventsTag;
+
+/// Hook for storing an event in a GameEventList. Each event can be in at most 1 list per tag
+template<class T_Tag>
+class GameEventListNode
+{
+    friend class GameEventList<T_Tag>;
+    // Mutable as the list membership is not part of the state of the (const) event
+    mutable const GameEventListNode* prev_ = nullptr;
+    mutable const GameEventListNode* next_ = nullptr;
+
+public:
+    GameEventListNode() = default;
+    // We store nodes by address, so they must not be copied
+    GameEventListNode(const GameEventListNode&) = delete;
+    GameEventListNode& operator=(const GameEventListNode&) = delete;
+};
+
+class GameEvent : public GameEventListNode<ScheduledEventsTag>, public GameEventListNode<ObjectEventsTag>
 {
     const unsigned instanceId; /// unique ID
 public:
@@ -28,3 +51,76 @@ public:
     unsigned GetTargetGF() const { return startGF + length; }
     unsigned GetInstanceId() const { return instanceId; }
 };
+
+/// Intrusive, circular, doubly linked list of events in insertion order.
+/// Does not allocate and allows removing an event in O(1) without knowing the list it is in.
+template<class T_Tag>
+class GameEventList
+{
+    using Node = GameEventListNode<T_Tag>;
+    Node head_;
+
+public:
+    GameEventList() { head_.prev_ = head_.next_ = &head_; }
+    GameEventList(const GameEventList&) = delete;
+    GameEventList& operator=(const GameEventList&) = delete;
+    ~GameEventList() { clear(); }
+
+    bool empty() const { return head_.next_ == &head_; }
+    const GameEvent* front() const { return empty() ? nullptr : static_cast<const GameEvent*>(head_.next_); }
+
+    void push_back(const GameEvent& ev)
+    {
+        const Node& node = ev;
+        node.prev_ = head_.prev_;
+        node.next_ = &head_;
+        head_.prev_->next_ = &node;
+        head_.prev_ = &node;
+    }
+
+    /// Remove all events from this list (without destroying them)
+    void clear()
+    {
+        while(const GameEvent* ev = front())
+            unlink(*ev);
+    }
+
+    /// Return true if the event is currently part of a list of this type
+    static bool isLinked(const GameEvent& ev) { return static_cast<const Node&>(ev).next_ != nullptr; }
+
+    /// Remove the event from the list it is in
+    static void unlink(const GameEvent& ev)
+    {
+        const Node& node = ev;
+        node.prev_->next_ = node.next_;
+        node.next_->prev_ = node.prev_;
+        node.prev_ = node.next_ = nullptr;
+    }
+
+    /// Call the functor for each event in order. The functor must not modify this list
+    template<class T_Func>
+    void forEach(T_Func&& func) const
+    {
+        for(const Node* node = head_.next_; node != &head_; node = node->next_)
+            func(static_cast<const GameEvent*>(node));
+    }
+
+    /// Move all events matching the predicate to the end of the other list keeping their order
+    template<class T_Pred>
+    void moveIf(GameEventList& other, T_Pred&& pred)
+    {
+        for(const Node* node = head_.next_; node != &head_;)
+        {
+            const auto* ev = static_cast<const GameEvent*>(node);
+            node = node->next_;
+            if(pred(*ev))
+            {
+                unlink(*ev);
+                other.push_back(*ev);
+            }
+        }
+    }
+};
+
+using ScheduledEventList = GameEventList<ScheduledEventsTag>;
+using ObjectEventList = GameEventList<ObjectEventsTag>;
@@ -0,0 +1,31 @@
+// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GameEventPool.h"
+#include "RTTR_Assert.h"
+
+void GameEventPool::destroy(const GameEvent* ev)
+{
+    RTTR_Assert(ev);
+    RTTR_Assert(!ScheduledEventList::isLinked(*ev));
+    RTTR_Assert(!ObjectEventList::isLinked(*ev));
+    ev->~GameEvent();
+    freeSlots_.push_back(reinterpret_cast<Storage*>(const_cast<GameEvent*>(ev)));
+}
+
+GameEventPool::Storage* GameEventPool::allocate()
+{
+    if(freeSlots_.empty())
+    {
+        chunks_.push_back(std::make_unique<Storage[]>(chunkSize));
+        Storage* chunk = chunks_.back().get();
+        freeSlots_.reserve(capacity());
+        // Reverse order so the chunk gets used front to back
+        for(size_t i = chunkSize; i > 0; --i)
+            freeSlots_.push_back(&chunk[i - 1]);
+    }
+    Storage* result = freeSlots_.back();
+    freeSlots_.pop_back();
+    return result;
+}
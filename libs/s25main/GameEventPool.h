@@ -0,0 +1,49 @@
+// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "GameEvent.h"
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Slab allocator for GameEvents: Memory is allocated in chunks and reused after events are destroyed
+class GameEventPool
+{
+public:
+    GameEventPool() = default;
+    GameEventPool(const GameEventPool&) = delete;
+    GameEventPool& operator=(const GameEventPool&) = delete;
+
+    /// Construct a new event with the given constructor arguments
+    template<typename... T_Args>
+    GameEvent* create(T_Args&&... args)
+    {
+        Storage* storage = allocate();
+        try
+        {
+            return new(storage) GameEvent(std::forward<T_Args>(args)...);
+        } catch(...)
+        {
+            freeSlots_.push_back(storage);
+            throw;
+        }
+    }
+    /// Destroy an event created by this pool making its memory available again
+    void destroy(const GameEvent* ev);
+
+    /// Number of events that can be held without allocating more memory
+    size_t capacity() const { return chunks_.size() * chunkSize; }
+
+private:
+    static constexpr size_t chunkSize = 1024;
+    using Storage = std::aligned_storage_t<sizeof(GameEvent), alignof(GameEvent)>;
+
+    Storage* allocate();
+
+    std::vector<std::unique_ptr<Storage[]>> chunks_;
+    std::vector<Storage*> freeSlots_;
+};
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GameManager.h"
+#include "FramesInfo.h"
 #include "GlobalVars.h"
 #include "Loader.h"
 #include "RTTR_Assert.h"
@@ -17,17 +18,22 @@
 #include "files.h"
 #include "network/GameClient.h"
 #include "network/GameServer.h"
+#include "ogl/FontStyle.h"
 #include "ogl/glArchivItem_Bitmap.h"
+#include "ogl/glFont.h"
 #include "liblobby/LobbyClient.h"
 #include "libsiedler2/Archiv.h"
 #include "s25util/Log.h"
+#include "s25util/colors.h"
 #include "s25util/error.h"
+#include <boost/format.hpp>
 #include <boost/pointer_cast.hpp>
+#include <cstdint>
 
 GameManager::GameManager(Log& log, Settings& settings, VideoDriverWrapper& videoDriver, AudioDriverWrapper& audioDriver,
                          WindowManager& windowManager)
     : log_(log), settings_(settings), videoDriver_(videoDriver), audioDriver_(audioDriver),
-      windowManager_(windowManager)
+      windowManager_(windowManager), skipTimeBudget_(100)
 {
     ResetAverageGFPS();
 }
@@ -102,52 +108,21 @@ bool GameManager::Run()
 
     // Get this before the run so we know if we are currently skipping
     const unsigned targetSkipGF = GAMECLIENT.skiptogf;
-    GAMECLIENT.Run();
-    GAMESERVER.Run();
-
     if(targetSkipGF)
     {
-        // if we skip drawing write a comment every 5k gf
-        unsigned current_time = videoDriver_.GetTickCount();
-        const unsigned curGF = GAMECLIENT.GetGFNumber();
-        if(targetSkipGF > curGF)
-        {
-            if(curGF % 5000 == 0)
-            {
-                if(lastSkipReport)
-                {
-                    // Elapsed time in ms
-                    const auto timeDiff = static_cast<double>(current_time - lastSkipReport->time);
-                    const unsigned numGFPassed = curGF - lastSkipReport->gf;
-                    log_.write(_("jumping to gf %i, now at gf %i, time for last 5k gf: %.3f s, avg gf time %.3f ms \n"))
-                      % targetSkipGF % curGF % (timeDiff / 1000) % (timeDiff / numGFPassed);
-                } else
-                    log_.write(_("jumping to gf %i, now at gf %i \n")) % targetSkipGF % curGF;
-                lastSkipReport = SkipReport{current_time, curGF};
-            } else if(!lastSkipReport)
-                lastSkipReport = SkipReport{current_time, curGF};
-        } else
-        {
-            // Jump just completed
-            RTTR_Assert(!GAMECLIENT.skiptogf);
-            if(lastSkipReport)
-            {
-                const auto timeDiff = static_cast<double>(current_time - lastSkipReport->time);
-                const unsigned numGFPassed = curGF - lastSkipReport->gf;
-                log_.write(_("jump to gf %i complete, time for last %i gf: %.3f s, avg gf time %.3f ms \n"))
-                  % targetSkipGF % numGFPassed % (timeDiff / 1000) % (timeDiff / numGFPassed);
-                lastSkipReport.reset();
-            } else
-            {
-                log_.write(_("jump to gf %1% complete\n")) % targetSkipGF;
-            }
-        }
+        RunSkipBatch();
+        ReportSkipProgress(targetSkipGF);
     } else
     {
-        videoDriver_.ClearScreen();
-        windowManager_.Draw();
-        videoDriver_.SwapBuffers();
+        GAMECLIENT.Run();
+        GAMESERVER.Run();
     }
+
+    videoDriver_.ClearScreen();
+    windowManager_.Draw();
+    if(GAMECLIENT.skiptogf)
+        DrawSkipProgress(GAMECLIENT.skiptogf);
+    videoDriver_.SwapBuffers();
     gfCounter_.update();
 
     // Fenstermanager aufräumen
@@ -157,6 +132,69 @@ bool GameManager::Run()
     return GLOBALVARS.notdone;
 }
 
+void GameManager::RunSkipBatch()
+{
+    const auto deadline = FramesInfo::UsedClock::now() + skipTimeBudget_;
+    // Run at least once to handle messages etc. even if the budget is zero
+    do
+    {
+        // Replays don't need the network, so the client can execute the GFs on its own
+        if(GAMECLIENT.IsReplayModeOn())
+            GAMECLIENT.ExecuteSkippedGFs(deadline);
+        GAMECLIENT.Run();
+        GAMESERVER.Run();
+    } while(GAMECLIENT.skiptogf && GLOBALVARS.notdone && FramesInfo::UsedClock::now() < deadline);
+}
+
+void GameManager::ReportSkipProgress(const unsigned targetSkipGF)
+{
+    // Write a comment every 5k GFs
+    constexpr unsigned reportInterval = 5000;
+    const unsigned current_time = videoDriver_.GetTickCount();
+    const unsigned curGF = GAMECLIENT.GetGFNumber();
+    if(targetSkipGF > curGF)
+    {
+        if(!lastSkipReport)
+        {
+            log_.write(_("jumping to gf %i, now at gf %i \n")) % targetSkipGF % curGF;
+            lastSkipReport = SkipReport{current_time, curGF};
+        } else if(curGF - lastSkipReport->gf >= reportInterval)
+        {
+            // Elapsed time in ms
+            const auto timeDiff = static_cast<double>(current_time - lastSkipReport->time);
+            const unsigned numGFPassed = curGF - lastSkipReport->gf;
+            log_.write(_("jumping to gf %i, now at gf %i, time for last %i gf: %.3f s, avg gf time %.3f ms \n"))
+              % targetSkipGF % curGF % numGFPassed % (timeDiff / 1000) % (timeDiff / numGFPassed);
+            lastSkipReport = SkipReport{current_time, curGF};
+        }
+    } else
+    {
+        // Jump just completed
+        RTTR_Assert(!GAMECLIENT.skiptogf);
+        if(lastSkipReport && curGF > lastSkipReport->gf)
+        {
+            const auto timeDiff = static_cast<double>(current_time - lastSkipReport->time);
+            const unsigned numGFPassed = curGF - lastSkipReport->gf;
+            log_.write(_("jump to gf %i complete, time for last %i gf: %.3f s, avg gf time %.3f ms \n"))
+              % targetSkipGF % numGFPassed % (timeDiff / 1000) % (timeDiff / numGFPassed);
+        } else
+        {
+            log_.write(_("jump to gf %1% complete\n")) % targetSkipGF;
+        }
+        lastSkipReport.reset();
+    }
+}
+
+void GameManager::DrawSkipProgress(const unsigned targetSkipGF)
+{
+    const unsigned curGF = GAMECLIENT.GetGFNumber();
+    if(curGF >= targetSkipGF)
+        return;
+    boost::format nwfString(_("current GF: %u - still fast forwarding: %d GFs left (%d %%)"));
+    nwfString % curGF % (targetSkipGF - curGF) % (static_cast<uint64_t>(curGF) * 100 / targetSkipGF);
+    LargeFont->Draw(DrawPoint(videoDriver_.GetRenderSize() / 2u), nwfString.str(), FontStyle::CENTER, COLOR_YELLOW);
+}
+
 bool GameManager::ShowSplashscreen()
 {
     libsiedler2::Archiv arSplash;
@@ -6,6 +6,7 @@
 
 #include "FrameCounter.h"
 #include <boost/optional.hpp>
+#include <chrono>
 
 class Log;
 class Settings;
@@ -32,8 +33,16 @@ public:
     unsigned GetNumFrames() { return gfCounter_.getCurNumFrames(); }
     unsigned GetAverageGFPS() { return gfCounter_.getCurFrameRate(); }
 
+    /// Set the time spent executing GFs per frame while skipping. The UI is drawn between the batches of GFs
+    void SetSkipTimeBudget(std::chrono::milliseconds budget) { skipTimeBudget_ = budget; }
+    std::chrono::milliseconds GetSkipTimeBudget() const { return skipTimeBudget_; }
+
 private:
     bool ShowSplashscreen();
+    /// Execute GFs until the skip target is reached or the time budget is used up
+    void RunSkipBatch();
+    void ReportSkipProgress(unsigned targetSkipGF);
+    void DrawSkipProgress(unsigned targetSkipGF);
 
     Log& log_;
     Settings& settings_;
@@ -41,6 +50,7 @@ private:
     AudioDriverWrapper& audioDriver_;
     WindowManager& windowManager_;
     FrameCounter gfCounter_;
+    std::chrono::milliseconds skipTimeBudget_;
 
     struct SkipReport
     {
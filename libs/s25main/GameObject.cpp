@@ -12,10 +12,10 @@
 /**
  *  Objekt-ID-Counter.
  */
-unsigned GameObject::objIdCounter_ = 0;
-unsigned GameObject::objCounter_ = 0;
+thread_local unsigned GameObject::objIdCounter_ = 0;
+thread_local unsigned GameObject::objCounter_ = 0;
 
-GameWorld* GameObject::world = nullptr;
+thread_local GameWorld* GameObject::world = nullptr;
 
 GameObject::GameObject() : objId(++objIdCounter_)
 {
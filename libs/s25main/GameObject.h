@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "GameEvent.h"
 #include "commonDefines.h"
 #include "gameTypes/GO_Type.h"
 #include <memory>
@@ -51,9 +52,14 @@ protected:
     static void SendPostMessage(unsigned player, std::unique_ptr<PostMsg> msg);
 
 private:
+    // Maintained by the EventManager
+    friend class EventManager;
+
     unsigned objId; /// unique ID
+    /// All active events of this object
+    ObjectEventList events_;
 
-    // Static members
+    // Static members. They are per thread so multiple games can run in parallel threads
 public:
     /// Set the currently active world for all game objects
     static void AttachWorld(GameWorld* gameWorld);
@@ -78,11 +84,11 @@ public:
 
 protected:
     /// Access to the currently active game world
-    static GameWorld* world;
+    static thread_local GameWorld* world;
 
 private:
-    static unsigned objIdCounter_; /// Object-ID-Counter (number of objects created)
-    static unsigned objCounter_;   /// Object-Counter (number of objects alive)
+    static thread_local unsigned objIdCounter_; /// Object-ID-Counter (number of objects created)
+    static thread_local unsigned objCounter_;   /// Object-Counter (number of objects alive)
 };
 
 /// Calls destroy on a GameObject and then deletes it setting the ptr to nullptr
@@ -24,6 +24,7 @@
 #include "helpers/mathFuncs.h"
 #include "lua/LuaInterfaceGame.h"
 #include "notifications/ToolNote.h"
+#include "pathfinding/RoadDistanceCache.h"
 #include "pathfinding/RoadPathFinder.h"
 #include "postSystem/DiplomacyPostQuestion.h"
 #include "postSystem/PostManager.h"
@@ -48,7 +49,8 @@
 #include <numeric>
 
 GamePlayer::GamePlayer(unsigned playerId, const PlayerInfo& playerInfo, GameWorld& world)
-    : GamePlayerInfo(playerId, playerInfo), world(world), hqPos(MapPoint::Invalid()), emergency(false)
+    : GamePlayerInfo(playerId, playerInfo), world(world), roadDistanceCache(std::make_unique<RoadDistanceCache>()),
+      hqPos(MapPoint::Invalid()), emergency(false)
 {
     std::fill(building_enabled.begin(), building_enabled.end(), true);
 
@@ -355,8 +357,10 @@ void GamePlayer::Deserialize(SerializedGameData& sgd)
 template<class T_IsWarehouseGood>
 nobBaseWarehouse* GamePlayer::FindWarehouse(const noRoadNode& start, const T_IsWarehouseGood& isWarehouseGood,
                                             bool to_wh, bool use_boat_roads, unsigned* length,
-                                            const RoadSegment* forbidden) const
+                                            const RoadSegment* forbidden, RoadPathFinder* pathFinder) const
 {
+    if(!pathFinder)
+        pathFinder = &world.GetRoadPathFinder();
     nobBaseWarehouse* best = nullptr;
 
     unsigned best_length = std::numeric_limits<unsigned>::max();
@@ -383,8 +387,14 @@ nobBaseWarehouse* GamePlayer::FindWarehouse(const noRoadNode& start, const T_IsW
         // Bei der erlaubten Benutzung von Bootsstraßen Waren-Pathfinding benutzen wenns zu nem Lagerhaus gehn soll
         // start <-> ziel tauschen bei der wegfindung
         unsigned tlength;
-        if(world.GetRoadPathFinder().FindPath(to_wh ? start : *wh, to_wh ? *wh : start, use_boat_roads, best_length,
-                                              forbidden, &tlength))
+        const noRoadNode& pathStart = to_wh ? start : *wh;
+        const noRoadNode& pathGoal = to_wh ? *wh : start;
+        // Paths for persons only depend on the road network, so they can be cached
+        const bool pathFound =
+          (use_boat_roads || forbidden) ?
+            pathFinder->FindPath(pathStart, pathGoal, use_boat_roads, best_length, forbidden, &tlength) :
+            roadDistanceCache->findPath(*pathFinder, pathStart, pathGoal, best_length, tlength);
+        if(pathFound)
         {
             if(tlength < best_length || !best)
             {
@@ -427,6 +437,8 @@ void GamePlayer::AddBuilding(noBuilding* bld, BuildingType bldType)
 
     if(bldType == BuildingType::HarborBuilding)
     {
+        // New ship connections
+        RoadNetworkChanged();
         // Schiff durchgehen und denen Bescheid sagen
         for(noShip* ship : ships)
             ship->NewHarborBuilt(static_cast<nobHarborBuilding*>(bld));
@@ -447,7 +459,10 @@ void GamePlayer::RemoveBuilding(noBuilding* bld, BuildingType bldType)
     buildings.Remove(bld, bldType);
     ChangeStatisticValue(StatisticType::Buildings, -1);
     if(bldType == BuildingType::HarborBuilding)
-    { // Schiffen Bescheid sagen
+    {
+        // Ship connections are gone
+        RoadNetworkChanged();
+        // Schiffen Bescheid sagen
         for(noShip* ship : ships)
             ship->HarborDestroyed(static_cast<nobHarborBuilding*>(bld));
     } else if(bldType == BuildingType::Headquarters)
@@ -508,6 +523,11 @@ void GamePlayer::DeleteRoad(RoadSegment* rs)
     roads.remove(rs);
 }
 
+void GamePlayer::RoadNetworkChanged()
+{
+    roadDistanceCache->clear();
+}
+
 void GamePlayer::FindClientForLostWares()
 {
     // Alle Lost-Wares müssen gucken, ob sie ein Lagerhaus finden
@@ -1051,6 +1071,7 @@ noBaseBuilding* GamePlayer::FindClientForWare(const Ware& ware)
     noBaseBuilding* lastBld = nullptr;
     noBaseBuilding* bestBld = nullptr;
     unsigned best_points = 0;
+    RoadPathFinder::WarePathCosts pathCosts(world.GetRoadPathFinder(), *start);
     for(auto& possibleClient : possibleClients)
     {
         unsigned path_length;
@@ -1073,9 +1094,7 @@ noBaseBuilding* GamePlayer::FindClientForWare(const Ware& ware)
         // Find path ONLY if it may be better. Pathfinding is limited to the worst path score that would lead to a
         // better score. This eliminates the worst case scenario where all nodes in a split road network would be hit by
         // the pathfinding only to conclude that there is no possible path.
-        if(world.FindPathForWareOnRoads(*start, *possibleClient.bld, &path_length, nullptr,
-                                        (possibleClient.points - best_points) * 2 - 1)
-           != RoadPathDirection::None)
+        if(pathCosts.FindPath(*possibleClient.bld, (possibleClient.points - best_points) * 2 - 1, path_length))
         {
             unsigned score = possibleClient.points - (path_length / 2);
 
@@ -1121,6 +1140,7 @@ nobBaseMilitary* GamePlayer::FindClientForCoin(const Ware& ware) const
 {
     nobBaseMilitary* bb = nullptr;
     unsigned best_points = 0, points;
+    RoadPathFinder::WarePathCosts pathCosts(world.GetRoadPathFinder(), *ware.GetLocation());
 
     // Militärgebäude durchgehen
     for(nobMilitary* milBld : buildings.GetMilitaryBuildings())
@@ -1132,7 +1152,7 @@ nobBaseMilitary* GamePlayer::FindClientForCoin(const Ware& ware) const
         if(points)
         {
             // Weg dorthin berechnen
-            if(world.FindPathForWareOnRoads(*ware.GetLocation(), *milBld, &way_points) != RoadPathDirection::None)
+            if(pathCosts.FindPath(*milBld, std::numeric_limits<unsigned>::max(), way_points))
             {
                 // Die Wegpunkte noch davon abziehen
                 points -= way_points;
@@ -2280,7 +2300,7 @@ void GamePlayer::FillVisualSettings(VisualSettings& visualSettings) const
 
 #define INSTANTIATE_FINDWH(Cond)                                                                                \
     template nobBaseWarehouse* GamePlayer::FindWarehouse(const noRoadNode&, const Cond&, bool, bool, unsigned*, \
-                                                         const RoadSegment*) const
+                                                         const RoadSegment*, RoadPathFinder*) const
 
 INSTANTIATE_FINDWH(FW::HasMinWares);
 INSTANTIATE_FINDWH(FW::HasFigure);
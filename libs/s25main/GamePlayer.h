@@ -35,6 +35,8 @@ class nobMilitary;
 class nofCarrier;
 class nofFlagWorker;
 class PostMsg;
+class RoadDistanceCache;
+class RoadPathFinder;
 class RoadSegment;
 class SerializedGameData;
 struct VisualSettings;
@@ -105,6 +107,8 @@ public:
     void RoadDestroyed();
     /// (Unbesetzte) Straße aus der Liste entfernen
     void DeleteRoad(RoadSegment* rs);
+    /// Notify that the road network (roads, road nodes or harbors) changed, invalidating cached road distances
+    void RoadNetworkChanged();
     /// Sucht einen Träger für die Straße und ruft ggf den Träger aus dem jeweiligen nächsten Lagerhaus
     bool FindCarrierForRoad(RoadSegment* rs) const;
     /// Returns true if the given wh does still exist and hence the ptr is valid
@@ -117,11 +121,12 @@ public:
     /// Looks for the closest warehouse for the point 'start' (including it) that matches the conditions by the functor
     /// - isWarehouseGood must be a functor taking a "const nobBaseWarhouse&", that returns a bool whether this
     /// warehouse should be considered - to_wh true if path to wh is searched, false for path from wh - length is
-    /// optional for the path length - forbidden optional roadSegment that must not be used
+    /// optional for the path length - forbidden optional roadSegment that must not be used - pathFinder optional
+    /// path finder to use instead of the one of the world (e.g. from other threads)
     template<class T_IsWarehouseGood>
     nobBaseWarehouse* FindWarehouse(const noRoadNode& start, const T_IsWarehouseGood& isWarehouseGood, bool to_wh,
                                     bool use_boat_roads, unsigned* length = nullptr,
-                                    const RoadSegment* forbidden = nullptr) const;
+                                    const RoadSegment* forbidden = nullptr, RoadPathFinder* pathFinder = nullptr) const;
     /// Für alle unbesetzen Straßen Weg neu berechnen
     void FindCarrierForAllRoads();
     /// Versucht für alle Arbeitsplätze eine Arbeitskraft zu suchen
@@ -342,6 +347,8 @@ private:
 
     /// Lister aller Straßen von dem Spieler
     std::list<RoadSegment*> roads;
+    /// Costs of paths for persons between road nodes, used for finding warehouses
+    std::unique_ptr<RoadDistanceCache> roadDistanceCache;
 
     struct JobNeeded
     {
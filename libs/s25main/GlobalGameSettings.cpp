@@ -75,8 +75,10 @@ void GlobalGameSettings::registerAllAddons()
         AddonDurableGeologistSigns,
         AddonEconomyModeGameLength,
         AddonExhaustibleWater,
+        AddonFollowFreeRoutes,
         AddonFrontierDistanceReachable,
         AddonHalfCostMilEquip,
+        AddonHierarchicalPathfinding,
         AddonInexhaustibleFish,
         AddonInexhaustibleGraniteMines,
         AddonInexhaustibleMines,
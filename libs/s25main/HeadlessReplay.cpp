@@ -0,0 +1,135 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "HeadlessReplay.h"
+#include "EventManager.h"
+#include "Game.h"
+#include "GamePlayer.h"
+#include "PlayerInfo.h"
+#include "ReplayKeyframes.h"
+#include "Savegame.h"
+#include "network/PlayerGameCommands.h"
+#include "random/Random.h"
+#include "variant.h"
+#include "world/GameWorld.h"
+#include "world/MapLoader.h"
+#include "gameTypes/MapInfo.h"
+#include "s25util/tmpFile.h"
+#include <stdexcept>
+#include <vector>
+
+HeadlessReplay::HeadlessReplay(const boost::filesystem::path& replayPath, const unsigned startGF)
+{
+    MapInfo mapInfo;
+    if(!replay_.LoadHeader(replayPath) || !replay_.LoadGameData(mapInfo))
+        throw std::runtime_error("Could not load " + replayPath.string() + ": " + replay_.GetLastErrorMsg());
+
+    ReplayKeyframes keyframes;
+    const ReplayKeyframes::Keyframe* keyframe = nullptr;
+    if(startGF > 0 && keyframes.Load(ReplayKeyframes::GetFilePath(replayPath), replay_))
+    {
+        keyframe = keyframes.Find(startGF);
+        if(keyframe)
+        {
+            mapInfo.savegame = std::make_unique<Savegame>();
+            if(!keyframes.LoadSavegame(*keyframe, *mapInfo.savegame))
+                throw std::runtime_error("Could not load keyframe: " + keyframes.GetLastErrorMsg());
+        }
+    }
+
+    std::vector<PlayerInfo> players;
+    for(unsigned i = 0; i < replay_.GetNumPlayers(); i++)
+        players.emplace_back(replay_.GetPlayer(i));
+    game_ = std::make_unique<Game>(replay_.ggs, mapInfo.savegame ? mapInfo.savegame->start_gf : 0, players);
+    RANDOM.Init(replay_.getSeed());
+    GameWorld& world = game_->world_;
+    if(mapInfo.savegame)
+        mapInfo.savegame->sgd.ReadSnapshot(*game_, *this);
+    else
+    {
+        for(unsigned i = 0; i < world.GetNumPlayers(); ++i)
+            world.GetPlayer(i).MakeStartPacts();
+
+        TmpFile mapFile(".swd");
+        mapFile.close();
+        if(!mapInfo.mapData.DecompressToFile(mapFile.filePath))
+            throw std::runtime_error("Could not decompress the map");
+        MapLoader loader(world);
+        if(!loader.Load(mapFile.filePath))
+            throw std::runtime_error("Could not load the map");
+        if(mapInfo.luaData.uncompressedLength)
+        {
+            TmpFile luaFile(".lua");
+            luaFile.close();
+            if(!mapInfo.luaData.DecompressToFile(luaFile.filePath)
+               || !loader.LoadLuaScript(*game_, *this, luaFile.filePath))
+                throw std::runtime_error("Could not load the lua script");
+        }
+        world.SetupResources();
+    }
+    world.InitAfterLoad();
+
+    if(keyframe)
+    {
+        RANDOM.ResetState(keyframe->rngState);
+        replay_.SeekToCommand(keyframe->commandPos);
+    }
+    ReadNextGF();
+    game_->Start(!!mapInfo.savegame);
+    RunUntil(startGF);
+}
+
+HeadlessReplay::~HeadlessReplay() = default;
+
+unsigned HeadlessReplay::RunUntil(const unsigned gf)
+{
+    unsigned numGFs = 0;
+    while(GetCurrentGF() < gf && !IsFinished())
+    {
+        const unsigned curGF = GetCurrentGF();
+        AsyncChecksum checksum;
+        if(nextGF_ == curGF)
+            checksum = AsyncChecksum::create(*game_);
+        bool isAsync = false;
+        while(nextGF_ == curGF)
+        {
+            const auto cmd = replay_.ReadCommand();
+            visit(composeVisitor([](const Replay::ChatCommand&) {},
+                                 [&](const Replay::GameCommand& cmd) {
+                                     for(const gc::GameCommandPtr& gc : cmd.cmds.gcs)
+                                         gc->Execute(game_->world_, cmd.player);
+                                     if(cmd.cmds.checksum.randChecksum != 0 && cmd.cmds.checksum != checksum)
+                                         isAsync = true;
+                                 }),
+                  cmd);
+            ReadNextGF();
+        }
+        if(isAsync)
+            numAsyncGFs_++;
+        game_->RunGF();
+        numGFs++;
+    }
+    return numGFs;
+}
+
+bool HeadlessReplay::IsFinished() const
+{
+    return GetCurrentGF() > replay_.GetLastGF();
+}
+
+unsigned HeadlessReplay::GetCurrentGF() const
+{
+    return game_->em_->GetCurrentGF();
+}
+
+std::string HeadlessReplay::FormatGFTime(const unsigned numGFs) const
+{
+    return std::to_string(numGFs) + " GF";
+}
+
+void HeadlessReplay::ReadNextGF()
+{
+    nextGFPos_ = replay_.GetCommandPos();
+    nextGF_ = replay_.ReadGF();
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "ILocalGameState.h"
+#include "Replay.h"
+#include <boost/filesystem/path.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+
+class Game;
+
+/// Plays a replay without user interface, e.g. to create keyframes for it
+class HeadlessReplay : private ILocalGameState
+{
+public:
+    /// Load the replay and create the game. If startGF is set, the game is loaded from the last keyframe before it (if
+    /// there are any) and run up to that GF. Throws on errors
+    explicit HeadlessReplay(const boost::filesystem::path& replayPath, unsigned startGF = 0);
+    ~HeadlessReplay() override;
+
+    /// Run the game until the GF is reached or the replay ends. Return the number of GFs executed
+    unsigned RunUntil(unsigned gf);
+    /// Return true if all GFs of the replay were executed
+    bool IsFinished() const;
+    unsigned GetCurrentGF() const;
+    /// Position of the first command of the current or a later GF
+    unsigned GetCommandPos() const { return nextGFPos_; }
+    /// Number of GFs at which the game state differed from the one recorded
+    unsigned GetNumAsyncGFs() const { return numAsyncGFs_; }
+
+    Replay& GetReplay() { return replay_; }
+    Game& GetGame() { return *game_; }
+
+private:
+    unsigned GetPlayerId() const override { return 0; }
+    bool IsHost() const override { return false; }
+    std::string FormatGFTime(unsigned numGFs) const override;
+    void SystemChat(const std::string&) override {}
+
+    void ReadNextGF();
+
+    Replay replay_;
+    std::unique_ptr<Game> game_;
+    /// GF of the next command if any
+    std::optional<unsigned> nextGF_;
+    unsigned nextGFPos_ = 0;
+    unsigned numAsyncGFs_ = 0;
+};
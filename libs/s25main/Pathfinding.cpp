@@ -3,9 +3,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GamePlayer.h"
+#include "GlobalGameSettings.h"
+#include "addons/const_addons.h"
 #include "helpers/EnumRange.h"
 #include "pathfinding/FreePathFinder.h"
 #include "pathfinding/FreePathFinderImpl.h"
+#include "pathfinding/HierarchicalPathFinder.h"
 #include "pathfinding/PathConditionHuman.h"
 #include "pathfinding/PathConditionShip.h"
 #include "pathfinding/PathConditionTrade.h"
@@ -20,13 +23,39 @@ helpers::OptionalEnum<Direction> GameWorldBase::FindHumanPath(const MapPoint sta
                                                               unsigned* length, std::vector<Direction>* route) const
 {
     Direction first_dir{};
-    if(GetFreePathFinder().FindPath(start, dest, random_route, max_route, route, length, &first_dir,
-                                    PathConditionHuman(*this)))
+    bool found;
+    if(GetGGS().isEnabled(AddonId::HIERARCHICAL_PATHFINDING))
+        found = humanPathFinder->FindPath(start, dest, random_route, max_route, route, length, &first_dir);
+    else
+    {
+        found = GetFreePathFinder().FindPath(start, dest, random_route, max_route, route, length, &first_dir,
+                                             PathConditionHuman(*this));
+    }
+    if(found)
         return first_dir;
     else
         return boost::none;
 }
 
+std::vector<unsigned> GameWorldBase::FindHumanPathLengths(const MapPoint start, const std::vector<MapPoint>& targets,
+                                                         const unsigned max_route, const unsigned maxHits) const
+{
+    std::vector<unsigned> lengths =
+      GetFreePathFinder().FindPathLengths(start, targets, max_route, PathConditionHuman(*this), maxHits);
+    if(GetGGS().isEnabled(AddonId::HIERARCHICAL_PATHFINDING) && max_route >= humanPathFinder->GetMinDistance())
+    {
+        // FindHumanPath searches long paths hierarchically which may find longer ones, so use its lengths.
+        // It finds a path if and only if there is one, hence only the reachable ones need to be checked
+        for(unsigned i = 0; i < targets.size(); i++)
+        {
+            if(lengths[i] != FreePathFinder::unreachable
+               && CalcDistance(start, targets[i]) >= humanPathFinder->GetMinDistance())
+                humanPathFinder->FindPath(start, targets[i], false, max_route, nullptr, &lengths[i], nullptr);
+        }
+    }
+    return lengths;
+}
+
 /// Wegfindung für Menschen im Straßennetz
 RoadPathDirection GameWorld::FindHumanPathOnRoads(const noRoadNode& start, const noRoadNode& goal, unsigned* length,
                                                   MapPoint* firstPt, const RoadSegment* const forbidden)
@@ -73,6 +102,8 @@ bool GameWorldBase::FindShipPathToHarbor(const MapPoint start, unsigned harborId
 bool GameWorldBase::FindShipPath(const MapPoint start, const MapPoint dest, unsigned maxDistance,
                                  std::vector<Direction>* route, unsigned* length)
 {
+    if(GetGGS().isEnabled(AddonId::HIERARCHICAL_PATHFINDING))
+        return shipPathFinder->FindPath(start, dest, true, maxDistance, route, length, nullptr);
     return GetFreePathFinder().FindPath(start, dest, true, maxDistance, route, length, nullptr,
                                         PathConditionShip(*this));
 }
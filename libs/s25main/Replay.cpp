@@ -88,7 +88,7 @@ bool Replay::StopRecording()
         const auto uncompressedSize = replayDataSize - file.Tell(); // Always positive as there is always some game data
         data.resize(uncompressedSize);
         file.ReadRawData(data.data(), data.size());
-        data = CompressedData::compress(data);
+        data = CompressedData::compress(data, CompressionLevel::Best);
         // If the compressed data turns out to be larger than the uncompressed one, bail out
         // This can happen for very short replays
         if(data.size() >= uncompressedSize)
@@ -284,6 +284,7 @@ bool Replay::LoadGameData(MapInfo& mapInfo)
                 }
                 break;
         }
+        commandsFilePos_ = file_.Tell();
     } catch(std::runtime_error& e)
     {
         lastErrorMsg = e.what();
@@ -353,6 +354,18 @@ boost_variant2<Replay::ChatCommand, Replay::GameCommand> Replay::ReadCommand()
     }
 }
 
+unsigned Replay::GetCommandPos() const
+{
+    RTTR_Assert(IsReplaying());
+    return file_.Tell() - commandsFilePos_;
+}
+
+void Replay::SeekToCommand(unsigned pos)
+{
+    RTTR_Assert(IsReplaying());
+    file_.Seek(commandsFilePos_ + pos, SEEK_SET);
+}
+
 void Replay::UpdateLastGF(unsigned last_gf)
 {
     RTTR_Assert(IsRecording());
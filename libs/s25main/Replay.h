@@ -77,6 +77,10 @@ public:
     /// Read the next GameFrame to which the following replay command applies if there are any left
     std::optional<unsigned> ReadGF();
     boost_variant2<ChatCommand, GameCommand> ReadCommand();
+    /// Return the position of the next GF/command relative to the first command
+    unsigned GetCommandPos() const;
+    /// Continue reading at a position returned by GetCommandPos
+    void SeekToCommand(unsigned pos);
 
     /// Update the (currently) last GameFrame in the file
     void UpdateLastGF(unsigned last_gf);
@@ -96,6 +100,8 @@ protected:
     unsigned lastGF_ = 0;
     /// Position of the last GF value in the file
     unsigned lastGfFilePos_ = 0;
+    /// Position of the first command in the file when replaying
+    unsigned commandsFilePos_ = 0;
     MapType mapType_ = MapType(0);
 
     /// Sub version for backwards compatibility (i.e. allow loading older files with same file version)
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Replay.h"
+#include "ReplayKeyframes.h"
 #include <boost/filesystem/path.hpp>
 #include <optional>
 #include <string>
@@ -20,4 +21,8 @@ struct ReplayInfo
     std::optional<unsigned> next_gf;
     /// FoW deactivated?
     bool all_visible;
+    /// Keyframes of the replay if there are any
+    ReplayKeyframes keyframes;
+    /// GF to jump to after starting the replay
+    unsigned targetGF = 0;
 };
@@ -0,0 +1,182 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayKeyframes.h"
+#include "EventManager.h"
+#include "Game.h"
+#include "RTTR_Assert.h"
+#include "Replay.h"
+#include "Savegame.h"
+#include "world/GameWorld.h"
+#include "s25util/Serializer.h"
+#include <mygettext/mygettext.h>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+constexpr std::array<char, 6> signature = {'R', 'T', 'T', 'R', 'K', 'F'};
+/// Increase when the format changes. Files of other versions are ignored, they can simply be recreated
+constexpr uint16_t keyframesVersion = 1;
+} // namespace
+
+boost::filesystem::path ReplayKeyframes::GetFilePath(const boost::filesystem::path& replayPath)
+{
+    boost::filesystem::path result = replayPath;
+    result += ".kf";
+    return result;
+}
+
+bool ReplayKeyframes::Load(const boost::filesystem::path& filepath, const Replay& replay)
+{
+    Close();
+    if(!file_.Open(filepath, OpenFileMode::Read))
+    {
+        lastErrorMsg_ = _("File could not be opened.");
+        return false;
+    }
+    try
+    {
+        if(!CheckHeader(replay))
+        {
+            Close();
+            return false;
+        }
+        const auto headerEnd = file_.Tell();
+        file_.Seek(0, SEEK_END);
+        const auto fileSize = file_.Tell();
+        file_.Seek(headerEnd, SEEK_SET);
+        // Only read the list of keyframes, the savegames are skipped
+        while(file_.Tell() < fileSize)
+        {
+            Keyframe keyframe;
+            keyframe.gf = file_.ReadUnsignedInt();
+            keyframe.commandPos = file_.ReadUnsignedInt();
+            Serializer ser;
+            ser.ReadFromFile(file_);
+            keyframe.rngState.deserialize(ser);
+            const auto savegameSize = file_.ReadUnsignedInt();
+            keyframe.savegamePos = file_.Tell();
+            if(!keyframes_.empty() && keyframes_.back().gf >= keyframe.gf)
+                throw std::runtime_error(_("Keyframes are not ordered"));
+            keyframes_.push_back(keyframe);
+            file_.Seek(keyframe.savegamePos + savegameSize, SEEK_SET);
+        }
+    } catch(const std::runtime_error& e)
+    {
+        lastErrorMsg_ = e.what();
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool ReplayKeyframes::StartWriting(const boost::filesystem::path& filepath, const Replay& replay)
+{
+    Close();
+    if(!file_.Open(filepath, OpenFileMode::Write))
+    {
+        lastErrorMsg_ = _("File could not be opened.");
+        return false;
+    }
+    file_.WriteRawData(signature.data(), signature.size());
+    file_.WriteUnsignedShort(keyframesVersion);
+    file_.WriteUnsignedInt(replay.getSeed());
+    file_.WriteUnsignedInt(replay.GetLastGF());
+    file_.Flush();
+    return true;
+}
+
+void ReplayKeyframes::AddKeyframe(const Game& game, const unsigned commandPos, const std::string& mapName)
+{
+    RTTR_Assert(file_.IsOpen());
+    Keyframe keyframe;
+    keyframe.gf = game.em_->GetCurrentGF();
+    keyframe.commandPos = commandPos;
+    keyframe.rngState = RANDOM.GetCurrentState();
+    RTTR_Assert(keyframes_.empty() || keyframes_.back().gf < keyframe.gf);
+
+    Savegame save;
+    const GameWorld& world = game.world_;
+    for(unsigned playerId = 0; playerId < world.GetNumPlayers(); ++playerId)
+        save.AddPlayer(world.GetPlayer(playerId));
+    save.ggs = game.ggs_;
+    save.start_gf = keyframe.gf;
+    save.compressionLevel = CompressionLevel::Fast;
+    save.sgd.MakeSnapshot(game);
+
+    file_.WriteUnsignedInt(keyframe.gf);
+    file_.WriteUnsignedInt(keyframe.commandPos);
+    Serializer ser;
+    keyframe.rngState.serialize(ser);
+    ser.WriteToFile(file_);
+    // Size of the savegame is written after it is known
+    const auto sizePos = file_.Tell();
+    file_.WriteUnsignedInt(0);
+    keyframe.savegamePos = file_.Tell();
+    save.Save(file_, mapName);
+    const auto endPos = file_.Tell();
+    file_.Seek(sizePos, SEEK_SET);
+    file_.WriteUnsignedInt(endPos - keyframe.savegamePos);
+    file_.Seek(0, SEEK_END);
+    file_.Flush();
+    keyframes_.push_back(keyframe);
+}
+
+void ReplayKeyframes::Close()
+{
+    file_.Close();
+    keyframes_.clear();
+}
+
+const ReplayKeyframes::Keyframe* ReplayKeyframes::Find(const unsigned gf) const
+{
+    const auto it = std::upper_bound(keyframes_.begin(), keyframes_.end(), gf,
+                                     [](const unsigned gf, const Keyframe& keyframe) { return gf < keyframe.gf; });
+    if(it == keyframes_.begin())
+        return nullptr;
+    return &*std::prev(it);
+}
+
+bool ReplayKeyframes::LoadSavegame(const Keyframe& keyframe, Savegame& savegame)
+{
+    RTTR_Assert(file_.IsOpen());
+    file_.Seek(keyframe.savegamePos, SEEK_SET);
+    if(!savegame.Load(file_, SaveGameDataToLoad::All))
+    {
+        lastErrorMsg_ = savegame.GetLastErrorMsg();
+        return false;
+    }
+    if(savegame.start_gf != keyframe.gf)
+    {
+        lastErrorMsg_ = _("Keyframe has the wrong GF");
+        return false;
+    }
+    return true;
+}
+
+bool ReplayKeyframes::CheckHeader(const Replay& replay)
+{
+    std::array<char, signature.size()> readSignature;
+    file_.ReadRawData(readSignature.data(), readSignature.size());
+    if(readSignature != signature)
+    {
+        lastErrorMsg_ = _("File is not a keyframe file.");
+        return false;
+    }
+    if(file_.ReadUnsignedShort() != keyframesVersion)
+    {
+        lastErrorMsg_ = _("Keyframes were created with another version.");
+        return false;
+    }
+    const auto seed = file_.ReadUnsignedInt();
+    const auto lastGF = file_.ReadUnsignedInt();
+    if(seed != replay.getSeed() || lastGF != replay.GetLastGF())
+    {
+        lastErrorMsg_ = _("Keyframes do not belong to the replay.");
+        return false;
+    }
+    return true;
+}
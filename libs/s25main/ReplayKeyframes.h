@@ -0,0 +1,58 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "random/Random.h"
+#include "s25util/BinaryFile.h"
+#include <boost/filesystem/path.hpp>
+#include <string>
+#include <vector>
+
+class Game;
+class Replay;
+class Savegame;
+
+/// Snapshots of the game state at some GFs of a replay which allow jumping to any GF without simulating it from the
+/// start. They are stored in a separate file next to the replay, so existing replays can get keyframes later on.
+/// Each keyframe consists of the position of the next command in the replay, the state of the RNG and a savegame.
+class ReplayKeyframes
+{
+public:
+    struct Keyframe
+    {
+        unsigned gf;
+        /// Position of the first command at or after this GF (see Replay::GetCommandPos)
+        unsigned commandPos;
+        UsedPRNG rngState;
+        /// Position of the savegame in the keyframe file
+        unsigned savegamePos;
+    };
+
+    /// Return the path of the keyframe file for the given replay
+    static boost::filesystem::path GetFilePath(const boost::filesystem::path& replayPath);
+
+    /// Read the list of keyframes from the file. Fails if it does not belong to the replay
+    bool Load(const boost::filesystem::path& filepath, const Replay& replay);
+    /// Create a new keyframe file for the replay, replacing an existing one
+    bool StartWriting(const boost::filesystem::path& filepath, const Replay& replay);
+    /// Add a keyframe for the current state of the game which must be later than the one of the last keyframe
+    void AddKeyframe(const Game& game, unsigned commandPos, const std::string& mapName);
+    void Close();
+
+    const std::vector<Keyframe>& GetKeyframes() const { return keyframes_; }
+    /// Return the last keyframe at or before the GF or nullptr if there is none
+    const Keyframe* Find(unsigned gf) const;
+    /// Read the savegame of the keyframe
+    bool LoadSavegame(const Keyframe& keyframe, Savegame& savegame);
+
+    const std::string& GetLastErrorMsg() const { return lastErrorMsg_; }
+
+private:
+    bool CheckHeader(const Replay& replay);
+
+    BinaryFile file_;
+    std::vector<Keyframe> keyframes_;
+    std::string lastErrorMsg_;
+};
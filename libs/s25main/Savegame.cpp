@@ -22,7 +22,7 @@ uint16_t Savegame::GetVersion() const
 
 //////////////////////////////////////////////////////////////////////////
 
-Savegame::Savegame() : start_gf(0) {}
+Savegame::Savegame() : start_gf(0), compressionLevel(CompressionLevel::Default) {}
 
 Savegame::~Savegame() = default;
 
@@ -97,7 +97,7 @@ void Savegame::WriteGameData(BinaryFile& file)
     file.WriteUnsignedInt(1); // Compressed flag for compatibility
     std::vector<char> data(sgd.GetData(), sgd.GetData() + sgd.GetLength());
     const unsigned uncompressedLength = data.size();
-    data = CompressedData::compress(data);
+    data = CompressedData::compress(data, compressionLevel);
     file.WriteUnsignedInt(uncompressedLength);
     file.WriteUnsignedInt(data.size());
     file.WriteRawData(data.data(), data.size());
@@ -6,6 +6,7 @@
 
 #include "SavedFile.h"
 #include "SerializedGameData.h"
+#include "gameTypes/CompressedData.h"
 #include <boost/filesystem/path.hpp>
 
 class BinaryFile;
@@ -41,6 +42,8 @@ public:
     unsigned start_gf;
     /// Serialisierte Spieldaten
     SerializedGameData sgd;
+    /// Used when saving the game data
+    CompressionLevel compressionLevel;
 
 protected:
     void WriteGameData(BinaryFile& file);
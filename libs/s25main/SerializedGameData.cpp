@@ -102,7 +102,8 @@
 /// 9: Drop serialization of node BQ
 /// 10: troop_limits state introduced to military buildings
 /// 11:: wineaddon added, three new building types and two new goods
-static const unsigned currentGameDataVersion = 11;
+/// 12: Route of figures walking off-road
+static const unsigned currentGameDataVersion = 12;
 // clang-format on
 
 std::unique_ptr<GameObject> SerializedGameData::Create_GameObject(const GO_Type got, const unsigned obj_id)
@@ -200,8 +201,42 @@ std::unique_ptr<FOWObject> SerializedGameData::Create_FOWObject(const FoW_Type f
     }
 }
 
+namespace {
+void markId(std::vector<bool>& flags, const unsigned id)
+{
+    if(id >= flags.size())
+        flags.resize(id + 1u);
+    flags[id] = true;
+}
+
+bool isIdMarked(const std::vector<bool>& flags, const unsigned id)
+{
+    return id < flags.size() && flags[id];
+}
+
+template<typename T>
+T* getById(const std::vector<T*>& entries, const unsigned id)
+{
+    return id < entries.size() ? entries[id] : nullptr;
+}
+
+template<typename T>
+void setById(std::vector<T*>& entries, const unsigned id, T* entry)
+{
+    if(id >= entries.size())
+        entries.resize(id + 1u);
+    entries[id] = entry;
+}
+
+// Rough sizes of the serialized data used to reserve the buffer
+constexpr unsigned snapshotBytesPerNode = 48;
+constexpr unsigned snapshotBytesPerNodeAndPlayer = 12;
+constexpr unsigned snapshotBytesPerObject = 32;
+} // namespace
+
 SerializedGameData::SerializedGameData()
-    : debugMode(false), expectedNumObjects(0), em(nullptr), writeEm(nullptr), isReading(false)
+    : debugMode(false), numWrittenObjs(0), numWrittenEvents(0), numReadObjs(0), numReadEvents(0),
+      expectedNumObjects(0), em(nullptr), writeEm(nullptr), isReading(false)
 {}
 
 void SerializedGameData::Prepare(bool reading)
@@ -222,17 +257,33 @@ void SerializedGameData::Prepare(bool reading)
         gameDataVersion = currentGameDataVersion;
     }
     writtenObjIds.clear();
+    writtenEventIds.clear();
+    numWrittenObjs = numWrittenEvents = 0;
     readObjects.clear();
+    readEvents.clear();
+    numReadObjs = numReadEvents = 0;
     expectedNumObjects = 0;
     isReading = reading;
 }
 
+unsigned SerializedGameData::EstimateSnapshotSize(const Game& game)
+{
+    const GameWorldBase& gw = game.world_;
+    const unsigned numNodes = prodOfComponents(gw.GetSize());
+    return numNodes * (snapshotBytesPerNode + gw.GetNumPlayers() * snapshotBytesPerNodeAndPlayer)
+           + GameObject::GetNumObjs() * snapshotBytesPerObject;
+}
+
 void SerializedGameData::MakeSnapshot(const Game& game)
 {
     Prepare(false);
+    // Avoid repeated reallocations of the buffer
+    EnsureSize(GetLength() + EstimateSnapshotSize(game));
 
     const GameWorldBase& gw = game.world_;
     writeEm = &gw.GetEvMgr();
+    writtenObjIds.resize(GameObject::GetObjIDCounter() + 1u);
+    writtenEventIds.reserve(writeEm->GetNumActiveEvents());
 
     // Anzahl Objekte reinschreiben (used for safety checks only)
     expectedNumObjects = GameObject::GetNumObjs();
@@ -256,21 +307,22 @@ void SerializedGameData::MakeSnapshot(const Game& game)
             LOG.write("Done serializing player %1% at %2%\n") % i % GetLength();
     }
 
-    if(writtenEventIds.size() != writeEm->GetNumActiveEvents())
+    if(numWrittenEvents != writeEm->GetNumActiveEvents())
     {
         throw Error(helpers::format("Event count mismatch. Expected: %1%, written: %2%", writeEm->GetNumActiveEvents(),
-                                    writtenEventIds.size()));
+                                    numWrittenEvents));
     }
     // If this check fails, we missed some objects or some objects were destroyed without decreasing the obj count
-    if(expectedNumObjects != writtenObjIds.size() + 1) // "Nothing" nodeObj does not get serialized
+    if(expectedNumObjects != numWrittenObjs + 1) // "Nothing" nodeObj does not get serialized
     {
         throw Error(helpers::format("Object count mismatch. Expected: %1%, written: %2%", expectedNumObjects,
-                                    writtenObjIds.size() + 1));
+                                    numWrittenObjs + 1));
     }
 
     writeEm = nullptr;
     writtenObjIds.clear();
     writtenEventIds.clear();
+    numWrittenObjs = numWrittenEvents = 0;
 }
 
 void SerializedGameData::ReadSnapshot(Game& game, ILocalGameState& localGameState)
@@ -294,26 +346,26 @@ void SerializedGameData::ReadSnapshot(Game& game, ILocalGameState& localGameStat
         gw.GetPlayer(i).Deserialize(*this);
 
     // If this check fails, we did not serialize all objects or there was an async
-    if(readEvents.size() != em->GetNumActiveEvents())
+    if(numReadEvents != em->GetNumActiveEvents())
     {
         throw Error(helpers::format("Event count mismatch. Expected: %1%, read: %2%", em->GetNumActiveEvents(),
-                                    readEvents.size()));
+                                    numReadEvents));
     }
     if(expectedNumObjects != GameObject::GetNumObjs())
     {
         throw Error(helpers::format("Object count mismatch. Expected: %1%, Existing: %2%", expectedNumObjects,
                                     GameObject::GetNumObjs()));
     }
-    if(expectedNumObjects != readObjects.size() + 1) // "Nothing" nodeObj does not get serialized
+    if(expectedNumObjects != numReadObjs + 1) // "Nothing" nodeObj does not get serialized
     {
         throw Error(helpers::format("Object count mismatch. Expected: %1%, read: %2%", expectedNumObjects,
-                                    readObjects.size() + 1));
+                                    numReadObjs + 1));
     }
 
     // Sanity check for flag workers. See bug #1449
-    for(const auto& entry : readObjects)
+    for(const GameObject* obj : readObjects)
     {
-        const auto* worker = dynamic_cast<const nofFlagWorker*>(entry.second);
+        const auto* worker = dynamic_cast<const nofFlagWorker*>(obj);
         if(worker && worker->GetFlag() && worker->GetPlayer() != worker->GetFlag()->GetPlayer())
         {
             throw Error(helpers::format("Invalid flag worker at %1%", worker->GetPos()));
@@ -323,6 +375,7 @@ void SerializedGameData::ReadSnapshot(Game& game, ILocalGameState& localGameStat
     em = nullptr;
     readObjects.clear();
     readEvents.clear();
+    numReadObjs = numReadEvents = 0;
 }
 
 void SerializedGameData::PushObject_(const GameObject* go, const bool known)
@@ -358,12 +411,13 @@ void SerializedGameData::PushObject_(const GameObject* go, const bool known)
     }
 
     if(debugMode)
-        LOG.write("Saving objId %u, obj#=%u\n") % objId % writtenObjIds.size();
+        LOG.write("Saving objId %u, obj#=%u\n") % objId % numWrittenObjs;
 
     // Objekt merken
-    writtenObjIds.insert(objId);
+    markId(writtenObjIds, objId);
+    ++numWrittenObjs;
 
-    RTTR_Assert(writtenObjIds.size() < GameObject::GetNumObjs());
+    RTTR_Assert(numWrittenObjs < GameObject::GetNumObjs());
 
     // Objekt nich bekannt? Dann Type-ID noch mit drauf
     if(!known)
@@ -393,6 +447,7 @@ void SerializedGameData::PushEvent(const GameEvent* event)
     if(IsEventSerialized(instanceId))
         return;
     writtenEventIds.insert(instanceId);
+    ++numWrittenEvents;
     if(debugMode)
         LOG.write("Start serializing event %1% at %2%\n") % instanceId % GetLength();
     event->Serialize(*this);
@@ -408,10 +463,12 @@ const GameEvent* SerializedGameData::PopEvent()
         return nullptr;
 
     // Note: em->GetEventInstanceCtr() might not be set yet
-    const auto foundObj = readEvents.find(instanceId);
-    if(foundObj != readEvents.end())
-        return foundObj->second;
-    std::unique_ptr<GameEvent> ev = std::make_unique<GameEvent>(*this, instanceId);
+    const auto itEv = readEvents.find(instanceId);
+    if(itEv != readEvents.end())
+        return itEv->second;
+    // Events are owned by the EventManager
+    RTTR_Assert(em);
+    const GameEvent* ev = em->DeserializeEvent(*this, instanceId);
 
     unsigned short safety_code = PopUnsignedShort();
 
@@ -421,7 +478,7 @@ const GameEvent* SerializedGameData::PopEvent()
           % instanceId;
         throw Error("Invalid safety code after PopEvent");
     }
-    return ev.release();
+    return ev;
 }
 
 /// FoW-Objekt
@@ -507,16 +564,18 @@ SerializedGameData::Error SerializedGameData::makeOutOfRange(unsigned value, uns
 void SerializedGameData::AddObject(GameObject* go)
 {
     RTTR_Assert(isReading);
-    RTTR_Assert(!readObjects[go->GetObjId()]); // Do not call this multiple times per GameObject
-    readObjects[go->GetObjId()] = go;
-    RTTR_Assert(readObjects.size() < expectedNumObjects);
+    RTTR_Assert(!getById(readObjects, go->GetObjId())); // Do not call this multiple times per GameObject
+    setById(readObjects, go->GetObjId(), go);
+    ++numReadObjs;
+    RTTR_Assert(numReadObjs < expectedNumObjects);
 }
 
 unsigned SerializedGameData::AddEvent(unsigned instanceId, GameEvent* ev)
 {
     RTTR_Assert(isReading);
-    RTTR_Assert(!readEvents[instanceId]); // Do not call this multiple times per GameObject
+    RTTR_Assert(!helpers::contains(readEvents, instanceId)); // Do not call this multiple times per GameObject
     readEvents[instanceId] = ev;
+    ++numReadEvents;
     return instanceId;
 }
 
@@ -524,7 +583,7 @@ bool SerializedGameData::IsObjectSerialized(unsigned obj_id) const
 {
     RTTR_Assert(!isReading);
     RTTR_Assert(obj_id <= GameObject::GetObjIDCounter());
-    return helpers::contains(writtenObjIds, obj_id);
+    return isIdMarked(writtenObjIds, obj_id);
 }
 
 bool SerializedGameData::IsEventSerialized(unsigned evInstanceid) const
@@ -538,9 +597,5 @@ GameObject* SerializedGameData::GetReadGameObject(const unsigned obj_id) const
 {
     RTTR_Assert(isReading);
     RTTR_Assert(obj_id <= GameObject::GetObjIDCounter());
-    auto foundObj = readObjects.find(obj_id);
-    if(foundObj == readObjects.end())
-        return nullptr;
-    else
-        return foundObj->second;
+    return getById(readObjects, obj_id);
 }
@@ -22,6 +22,9 @@
 #include <set>
 #include <stdexcept>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 class GameObject;
 class EventManager;
@@ -186,12 +189,18 @@ private:
     /// Version of the game data that is read. Gets set to the current version for writing
     unsigned gameDataVersion;
 
-    /// Stores the ids of all written objects (-> only valid during writing)
-    std::set<unsigned> writtenObjIds;
-    std::set<unsigned> writtenEventIds;
-    /// Maps already read object ids to GameObjects (-> only valid during reading)
-    std::map<unsigned, GameObject*> readObjects;
-    std::map<unsigned, GameEvent*> readEvents;
+    /// Flags for the ids of all written objects (-> only valid during writing).
+    /// Object ids are dense (up to the id counter), so this is faster than a set
+    std::vector<bool> writtenObjIds;
+    /// Instance ids of all written events (-> only valid during writing).
+    /// Only few of the instance ids used so far belong to active events, so they are not indexed by id
+    std::unordered_set<unsigned> writtenEventIds;
+    unsigned numWrittenObjs, numWrittenEvents;
+    /// Already read GameObjects indexed by their id (-> only valid during reading)
+    std::vector<GameObject*> readObjects;
+    /// Maps already read event instance ids to events (-> only valid during reading)
+    std::unordered_map<unsigned, GameEvent*> readEvents;
+    unsigned numReadObjs, numReadEvents;
 
     /// Expected number of objects to be read/written
     unsigned expectedNumObjects;
@@ -205,6 +214,8 @@ private:
 
     /// Starts reading or writing according to the param
     void Prepare(bool reading);
+    /// Return a rough estimate of the size of the snapshot of the game in bytes
+    static unsigned EstimateSnapshotSize(const Game& game);
     /// Erzeugt GameObject
     std::unique_ptr<GameObject> Create_GameObject(GO_Type got, unsigned obj_id);
     /// Erzeugt FOWObject
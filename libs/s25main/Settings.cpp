@@ -19,6 +19,7 @@
 #include "s25util/System.h"
 #include "s25util/error.h"
 #include <boost/filesystem/operations.hpp>
+#include <algorithm>
 
 const int Settings::VERSION = 13;
 const std::array<std::string, 10> Settings::SECTION_NAMES = {
@@ -76,6 +77,7 @@ void Settings::LoadDefaults()
     global.smartCursor = true;
     global.debugMode = false;
     global.showGFInfo = false;
+    global.numAIThreads = 1;
     // }
 
     // video
@@ -218,6 +220,7 @@ void Settings::Load()
         global.smartCursor = iniGlobal->getValue("smartCursor", true);
         global.debugMode = iniGlobal->getValue("debugMode", false);
         global.showGFInfo = iniGlobal->getValue("showGFInfo", false);
+        global.numAIThreads = std::max(1, iniGlobal->getValue("numAIThreads", 1));
         // };
 
         // video
@@ -404,6 +407,7 @@ void Settings::Save()
     iniGlobal->setValue("smartCursor", global.smartCursor);
     iniGlobal->setValue("debugMode", global.debugMode);
     iniGlobal->setValue("showGFInfo", global.showGFInfo);
+    iniGlobal->setValue("numAIThreads", global.numAIThreads);
     // };
 
     // video
@@ -54,6 +54,8 @@ public:
     {
         uint8_t submit_debug_data;
         bool use_upnp, smartCursor, debugMode, showGFInfo;
+        /// Number of threads used to run the AI players. <=1 runs them sequentially
+        unsigned numAIThreads;
     } global;
 
     struct
@@ -824,6 +824,7 @@ void TerrainRenderer::Draw(const Position& firstPt, const Position& lastPt, cons
             RTTR_Assert(texture.tileOffset + texture.count <= size_.x * size_.y * 2u);
             glDrawArrays(GL_TRIANGLES, texture.tileOffset * 3,
                          texture.count * 3); // Arguments are in Elements. 1 triangle has 3 values
+            VIDEODRIVER.CountDrawCall();
         }
     }
     glPopMatrix();
@@ -849,6 +850,7 @@ void TerrainRenderer::Draw(const Position& firstPt, const Position& lastPt, cons
             RTTR_Assert(texture.tileOffset + texture.count <= gl_vertices.size());
             glDrawArrays(GL_TRIANGLES, texture.tileOffset * 3,
                          texture.count * 3); // Arguments are in elements. 1 triangle has 3 values
+            VIDEODRIVER.CountDrawCall();
         }
     }
     glPopMatrix();
@@ -1027,6 +1029,7 @@ void TerrainRenderer::DrawWays(const PreparedRoads& sorted_roads) const
 
         VIDEODRIVER.BindTexture(texture.GetTextureNoCreate());
         glDrawArrays(GL_QUADS, 0, itRoad.value().size() * 4);
+        VIDEODRIVER.CountDrawCall();
     }
     // Note: No glDisableClientState as we did not enable it
 }
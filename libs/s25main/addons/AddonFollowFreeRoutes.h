@@ -0,0 +1,22 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "AddonBool.h"
+#include "mygettext/mygettext.h"
+
+/**
+ *  Figures walking off-road keep the path found once and only search a new one when it gets blocked.
+ *  Otherwise they search the path again at every node which may lead to other paths when new ones open up.
+ */
+class AddonFollowFreeRoutes : public AddonBool
+{
+public:
+    AddonFollowFreeRoutes()
+        : AddonBool(AddonId::FOLLOW_FREE_ROUTES, AddonGroup::Other, _("Figures keep their path"),
+                    _("Figures walking off-road follow the path they found until it gets blocked instead of searching "
+                      "a new path at every step"))
+    {}
+};
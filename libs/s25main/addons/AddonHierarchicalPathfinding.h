@@ -0,0 +1,21 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "AddonBool.h"
+#include "mygettext/mygettext.h"
+
+/**
+ *  Use a faster, hierarchical search for long paths of figures and ships.
+ *  The paths found may be slightly longer than the shortest ones.
+ */
+class AddonHierarchicalPathfinding : public AddonBool
+{
+public:
+    AddonHierarchicalPathfinding()
+        : AddonBool(AddonId::HIERARCHICAL_PATHFINDING, AddonGroup::Other, _("Fast long distance pathfinding"),
+                    _("Figures and ships use a faster search for long paths which may find slightly longer paths"))
+    {}
+};
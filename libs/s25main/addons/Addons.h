@@ -49,6 +49,8 @@
 
 #include "addons/AddonMilitaryHitpoints.h"
 
+#include "addons/AddonFollowFreeRoutes.h"
+#include "addons/AddonHierarchicalPathfinding.h"
 #include "addons/AddonNumScoutsExploration.h"
 
 #include "addons/AddonCoinsCapturedBld.h"
@@ -65,7 +65,8 @@ ENUM_WITH_STRING(AddonId, LIMIT_CATAPULTS = 0x00000000, INEXHAUSTIBLE_MINES = 0x
 
                  MILITARY_HITPOINTS = 0x00B00000,
 
-                 NUM_SCOUTS_EXPLORATION = 0x00C00000,
+                 NUM_SCOUTS_EXPLORATION = 0x00C00000, HIERARCHICAL_PATHFINDING = 0x00C00001,
+                 FOLLOW_FREE_ROUTES = 0x00C00002,
 
                  FRONTIER_DISTANCE_REACHABLE = 0x00D0000, COINS_CAPTURED_BLD = 0x00D0001,
                  DEMOLISH_BLD_WO_RES = 0x00D0002,
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "AIInterface.h"
+#include "RttrForeachPt.h"
 #include "buildings/noBuilding.h"
 #include "buildings/noBuildingSite.h"
 #include "buildings/nobHQ.h"
@@ -12,13 +13,14 @@
 #include "helpers/containerUtils.h"
 #include "network/GameMessage_Chat.h"
 #include "pathfinding/FreePathFinder.h"
+#include "pathfinding/FreePathFinderImpl.h"
+#include "pathfinding/PathConditionHuman.h"
 #include "pathfinding/PathConditionRoad.h"
 #include "pathfinding/RoadPathFinder.h"
 #include "nodeObjs/noFlag.h"
 #include "nodeObjs/noTree.h"
 #include "gameData/TerrainDesc.h"
 #include <limits>
-#include <numeric>
 
 class noRoadNode;
 
@@ -47,8 +49,11 @@ bool IsPointOK_RoadPathEvenStep(const GameWorldBase& gwb, const MapPoint pt, con
 } // namespace
 
 AIInterface::AIInterface(const GameWorldBase& gwb, std::vector<gc::GameCommandPtr>& gcs, unsigned char playerID)
-    : gwb(gwb), player_(gwb.GetPlayer(playerID)), gcs(gcs), playerID_(playerID)
+    : gwb(gwb), player_(gwb.GetPlayer(playerID)), gcs(gcs), playerID_(playerID),
+      freePathFinder_(std::make_unique<FreePathFinder>(gwb)), roadPathFinder_(std::make_unique<RoadPathFinder>(gwb))
 {
+    freePathFinder_->Init(gwb.GetSize());
+    roadPathFinder_->Init(gwb.GetSize());
     for(unsigned curHarborId = 1; curHarborId <= gwb.GetNumHarborPoints(); curHarborId++)
     {
         bool hasOtherHarbor = false;
@@ -171,10 +176,11 @@ int AIInterface::CalcResourceValue(const MapPoint pt, AIResource res, helpers::O
     const unsigned resRadius = RES_RADIUS[res];
     if(!direction) // calculate complete value from scratch (3n^2+3n+1)
     {
-        std::vector<MapPoint> pts = gwb.GetPointsInRadiusWithCenter(pt, resRadius);
-        return std::accumulate(pts.begin(), pts.end(), 0, [this, res](int lhs, const auto& curPt) {
-            return lhs + this->GetResourceRating(curPt, res);
-        });
+        int value = 0;
+        gwb.VisitPointsInRadius(
+          pt, resRadius,
+          [this, res, &value](const MapPoint curPt, unsigned) { value += GetResourceRating(curPt, res); }, true);
+        return value;
     } else // calculate different nodes only (4n+2 ?anyways much faster)
     {
         const auto iDirection = rttr::enum_cast(*direction);
@@ -223,13 +229,22 @@ int AIInterface::CalcResourceValue(const MapPoint pt, AIResource res, helpers::O
     // lastval);
 }
 
+std::vector<int> AIInterface::CalcResourceValues(AIResource res) const
+{
+    std::vector<int> ratings;
+    ratings.reserve(prodOfComponents(gwb.GetSize()));
+    RTTR_FOREACH_PT(MapPoint, gwb.GetSize())
+        ratings.push_back(GetResourceRating(pt, res));
+    return gwb.SumValuesInRadius(ratings, RES_RADIUS[res]);
+}
+
 bool AIInterface::FindFreePathForNewRoad(MapPoint start, MapPoint target, std::vector<Direction>* route /*= nullptr*/,
                                          unsigned* length /*= nullptr*/) const
 {
     bool boat = false;
-    return gwb.GetFreePathFinder().FindPathAlternatingConditions(start, target, false, 100, route, length, nullptr,
-                                                                 IsPointOK_RoadPath, IsPointOK_RoadPathEvenStep,
-                                                                 nullptr, (void*)&boat);
+    return freePathFinder_->FindPathAlternatingConditions(start, target, false, 100, route, length, nullptr,
+                                                          IsPointOK_RoadPath, IsPointOK_RoadPathEvenStep, nullptr,
+                                                          (void*)&boat);
 }
 
 bool AIInterface::CalcBQSumDifference(const MapPoint pt1, const MapPoint pt2) const
@@ -250,10 +265,20 @@ BuildingQuality AIInterface::GetBuildingQualityAnyOwner(const MapPoint pt) const
 bool AIInterface::FindPathOnRoads(const noRoadNode& start, const noRoadNode& target, unsigned* length) const
 {
     if(length)
-        return gwb.GetRoadPathFinder().FindPath(start, target, false, std::numeric_limits<unsigned>::max(), nullptr,
-                                                length);
+        return roadPathFinder_->FindPath(start, target, false, std::numeric_limits<unsigned>::max(), nullptr, length);
     else
-        return gwb.GetRoadPathFinder().PathExists(start, target, false);
+        return roadPathFinder_->PathExists(start, target, false);
+}
+
+bool AIInterface::FindHumanPath(const MapPoint start, const MapPoint dest, const unsigned maxLength) const
+{
+    return freePathFinder_->FindPath(start, dest, false, maxLength, nullptr, nullptr, nullptr, PathConditionHuman(gwb));
+}
+
+std::vector<unsigned> AIInterface::FindHumanPathLengths(const MapPoint start, const std::vector<MapPoint>& targets,
+                                                        const unsigned maxLength, const unsigned maxHits) const
+{
+    return freePathFinder_->FindPathLengths(start, targets, maxLength, PathConditionHuman(gwb), maxHits);
 }
 
 const nobHQ* AIInterface::GetHeadquarter() const
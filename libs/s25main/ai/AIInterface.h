@@ -16,8 +16,10 @@
 #include <memory>
 #include <vector>
 
+class FreePathFinder;
 class nobHQ;
 class nobShipYard;
+class RoadPathFinder;
 class RoadSegment;
 class noBuilding;
 class noBuildingSite;
@@ -50,6 +52,8 @@ public:
     /// when given a direction and lastvalue the calculation will be much faster O(n) vs O(n^2)
     int CalcResourceValue(MapPoint pt, AIResource res, helpers::OptionalEnum<Direction> direction = boost::none,
                           int lastval = 0xffff) const;
+    /// Calculate the resource value of all points at once (indexed by the map index)
+    std::vector<int> CalcResourceValues(AIResource res) const;
     /// Calculate the resource value for a given point
     int GetResourceRating(MapPoint pt, AIResource res) const;
     /// Test whether a given point is part of the border or not
@@ -89,6 +93,12 @@ public:
                                 unsigned* length = nullptr) const;
     /// Tries to find a route from start to target, returning length of that route if it exists
     bool FindPathOnRoads(const noRoadNode& start, const noRoadNode& target, unsigned* length = nullptr) const;
+    /// Return true if a figure can walk from start to dest with at most maxLength steps
+    bool FindHumanPath(MapPoint start, MapPoint dest, unsigned maxLength) const;
+    /// Like GameWorldBase::FindHumanPathLengths. Only uses the regular search, so with the hierarchical pathfinding
+    /// the lengths of long paths may differ but the same targets are reachable
+    std::vector<unsigned> FindHumanPathLengths(MapPoint start, const std::vector<MapPoint>& targets, unsigned maxLength,
+                                               unsigned maxHits) const;
     /// Checks if it is allowed to build catapults
     bool CanBuildCatapult() const { return player_.CanBuildCatapult(); }
     /// checks if the player is allowed to build the building type (lua maybe later addon?)
@@ -101,7 +111,8 @@ public:
                                     bool use_boat_roads, unsigned* length = nullptr,
                                     const RoadSegment* forbidden = nullptr) const
     {
-        return player_.FindWarehouse(start, isWarehouseGood, to_wh, use_boat_roads, length, forbidden);
+        return player_.FindWarehouse(start, isWarehouseGood, to_wh, use_boat_roads, length, forbidden,
+                                     roadPathFinder_.get());
     }
     /// Return the headquarter of the player (or null if destroyed)
     const nobHQ* GetHeadquarter() const;
@@ -213,4 +224,7 @@ private:
     const unsigned char playerID_;
     /// Harbor ids which have at least one other harbor at the same sea
     std::vector<unsigned> usableHarbors_;
+    /// Own path finders, so the AIs can search in parallel as the path finders of the world are used by the game
+    std::unique_ptr<FreePathFinder> freePathFinder_;
+    std::unique_ptr<RoadPathFinder> roadPathFinder_;
 };
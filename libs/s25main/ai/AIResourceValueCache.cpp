@@ -0,0 +1,44 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AIResourceValueCache.h"
+#include "EventManager.h"
+#include "RTTR_Assert.h"
+#include "ai/AIInterface.h"
+#include "world/GameWorldBase.h"
+
+AIResourceValueCache::AIResourceValueCache(const GameWorldBase& gwb) : gwb_(gwb) {}
+
+bool AIResourceValueCache::IsPlayerIndependent(AIResource res)
+{
+    // Those only depend on resources and objects on the map but not on buildings or territory
+    switch(res)
+    {
+        case AIResource::Gold:
+        case AIResource::Ironore:
+        case AIResource::Coal:
+        case AIResource::Granite:
+        case AIResource::Fish:
+        case AIResource::Stones: return true;
+        case AIResource::Wood:
+        case AIResource::Plantspace:
+        case AIResource::Borderland: return false;
+    }
+    return false;
+}
+
+std::shared_ptr<const std::vector<int>> AIResourceValueCache::GetValues(const AIInterface& aii, AIResource res)
+{
+    RTTR_Assert(IsPlayerIndependent(res));
+    RTTR_Assert(&aii.gwb == &gwb_);
+    const unsigned curGF = gwb_.GetEvMgr().GetCurrentGF();
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[res];
+    if(!entry.values || entry.gf != curGF)
+    {
+        entry.values = std::make_shared<const std::vector<int>>(aii.CalcResourceValues(res));
+        entry.gf = curGF;
+    }
+    return entry.values;
+}
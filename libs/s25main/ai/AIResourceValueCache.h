@@ -0,0 +1,41 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "ai/AIResource.h"
+#include "helpers/EnumArray.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class AIInterface;
+class GameWorldBase;
+
+/// Shares the resource values of all points (see AIInterface::CalcResourceValues) between the AI players for
+/// resources whose value does not depend on the player.
+/// The values are calculated at most once per GF,
+/// so AIs started together (e.g. at game start) calculate them only once.
+/// Changes of the world within the same GF are not detected, so users should update the values they actually use.
+class AIResourceValueCache
+{
+public:
+    explicit AIResourceValueCache(const GameWorldBase& gwb);
+
+    /// True if the value of the resource is the same for all players
+    static bool IsPlayerIndependent(AIResource res);
+    /// Return the values of all points for the given (player independent) resource, calculating them via the
+    /// interface if required. Thread safe
+    std::shared_ptr<const std::vector<int>> GetValues(const AIInterface& aii, AIResource res);
+
+private:
+    const GameWorldBase& gwb_;
+    std::mutex mutex_;
+    struct Entry
+    {
+        std::shared_ptr<const std::vector<int>> values;
+        unsigned gf = 0;
+    };
+    helpers::EnumArray<Entry, AIResource> entries_;
+};
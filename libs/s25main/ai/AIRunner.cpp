@@ -0,0 +1,113 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AIRunner.h"
+#include "AIPlayer.h"
+#include "GameObject.h"
+#include "RTTR_Assert.h"
+#include <utility>
+
+AIRunner::AIRunner(GameWorld& world) : world_(world) {}
+
+AIRunner::~AIRunner()
+{
+    StopWorkers();
+}
+
+void AIRunner::SetNumThreads(unsigned numThreads)
+{
+    if(numThreads == GetNumThreads())
+        return;
+    StopWorkers();
+    if(numThreads <= 1)
+        return;
+    // The calling thread works too
+    workers_.reserve(numThreads - 1);
+    for(unsigned i = 1; i < numThreads; i++)
+        workers_.emplace_back([this]() { WorkerMain(); });
+}
+
+void AIRunner::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    startCond_.notify_all();
+    for(std::thread& worker : workers_)
+        worker.join();
+    workers_.clear();
+    stop_ = false;
+}
+
+void AIRunner::RunGF(std::vector<AIPlayer*> ais, unsigned gf, bool isNWF)
+{
+    if(workers_.empty() || ais.size() <= 1u)
+    {
+        for(AIPlayer* ai : ais)
+            ai->RunGF(gf, isNWF);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ais_ = std::move(ais);
+        curGF_ = gf;
+        curIsNWF_ = isNWF;
+        nextAI_ = 0;
+        numPendingAIs_ = ais_.size();
+        error_ = nullptr;
+        ++batchId_;
+    }
+    startCond_.notify_all();
+    ProcessAIs();
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCond_.wait(lock, [this]() { return numPendingAIs_ == 0u; });
+    if(error_)
+        std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+void AIRunner::WorkerMain()
+{
+    // The world is per thread, see GameObject
+    GameObject::AttachWorld(&world_);
+    unsigned lastBatchId = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(true)
+    {
+        startCond_.wait(lock, [&]() { return stop_ || batchId_ != lastBatchId; });
+        if(stop_)
+            break;
+        lastBatchId = batchId_;
+        lock.unlock();
+        ProcessAIs();
+        lock.lock();
+    }
+    GameObject::DetachWorld(&world_);
+}
+
+void AIRunner::ProcessAIs()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(nextAI_ < ais_.size())
+    {
+        AIPlayer& ai = *ais_[nextAI_++];
+        const unsigned gf = curGF_;
+        const bool isNWF = curIsNWF_;
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+            ai.RunGF(gf, isNWF);
+        } catch(...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if(error && !error_)
+            error_ = error;
+        RTTR_Assert(numPendingAIs_ > 0u);
+        if(--numPendingAIs_ == 0u)
+            doneCond_.notify_one();
+    }
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class AIPlayer;
+class GameWorld;
+
+/// Executes the GF of all AI players.
+/// The AIs only read the world and create GameCommands which are executed later, so they can run in parallel.
+/// The commands are fetched per player and each AI uses its own RNG, hence the order of execution does not matter.
+class AIRunner
+{
+public:
+    explicit AIRunner(GameWorld& world);
+    AIRunner(const AIRunner&) = delete;
+    AIRunner& operator=(const AIRunner&) = delete;
+    ~AIRunner();
+
+    /// Set the number of threads used to run the AIs. 0 or 1 runs them sequentially in the calling thread
+    void SetNumThreads(unsigned numThreads);
+    /// Number of threads running the AIs including the calling thread
+    unsigned GetNumThreads() const { return static_cast<unsigned>(workers_.size()) + 1u; }
+
+    /// Run the GF of all AIs in the range and wait for them to finish
+    template<class T_Range>
+    void RunGF(T_Range& ais, unsigned gf, bool isNWF)
+    {
+        std::vector<AIPlayer*> aiPtrs;
+        for(AIPlayer& ai : ais)
+            aiPtrs.push_back(&ai);
+        RunGF(std::move(aiPtrs), gf, isNWF);
+    }
+    /// Overload for containers of (smart) pointers
+    template<class T_Ptr>
+    void RunGF(std::vector<T_Ptr>& ais, unsigned gf, bool isNWF)
+    {
+        std::vector<AIPlayer*> aiPtrs;
+        for(T_Ptr& ai : ais)
+            aiPtrs.push_back(&*ai);
+        RunGF(std::move(aiPtrs), gf, isNWF);
+    }
+
+private:
+    void RunGF(std::vector<AIPlayer*> ais, unsigned gf, bool isNWF);
+    void StopWorkers();
+    void WorkerMain();
+    /// Run AIs from the current batch until none is left
+    void ProcessAIs();
+
+    GameWorld& world_;
+    std::vector<std::thread> workers_;
+    /// AIs of the current batch
+    std::vector<AIPlayer*> ais_;
+
+    /// Protects all members below and ais_
+    std::mutex mutex_;
+    /// Signals the workers that a new batch is ready or they should stop
+    std::condition_variable startCond_;
+    /// Signals the main thread that all AIs of the batch are done
+    std::condition_variable doneCond_;
+    /// Increased for each new batch
+    unsigned batchId_ = 0;
+    bool stop_ = false;
+    unsigned curGF_ = 0;
+    bool curIsNWF_ = false;
+    /// Index of the next AI to run in the current batch
+    size_t nextAI_ = 0;
+    /// Number of AIs of the current batch not yet finished
+    size_t numPendingAIs_ = 0;
+    /// First exception thrown by an AI in the current batch
+    std::exception_ptr error_;
+};
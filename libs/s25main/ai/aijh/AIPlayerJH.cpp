@@ -11,6 +11,7 @@
 #include "RttrForeachPt.h"
 #include "addons/const_addons.h"
 #include "ai/AIEvents.h"
+#include "ai/AIResourceValueCache.h"
 #include "boost/filesystem/fstream.hpp"
 #include "buildings/noBuildingSite.h"
 #include "buildings/nobHarborBuilding.h"
@@ -25,7 +26,9 @@
 #include "notifications/ResourceNote.h"
 #include "notifications/RoadNote.h"
 #include "notifications/ShipNote.h"
+#include "pathfinding/FreePathFinder.h"
 #include "pathfinding/PathConditionRoad.h"
+#include "random/Random.h"
 #include "nodeObjs/noAnimal.h"
 #include "nodeObjs/noFlag.h"
 #include "nodeObjs/noShip.h"
@@ -160,13 +163,22 @@ static auto createResourceMaps(const AIInterface& aii, const AIMap& aiMap)
     return createResourceMaps(aii, aiMap, std::make_index_sequence<helpers::NumEnumValues_v<AIResource>>{});
 }
 
-AIPlayerJH::AIPlayerJH(const unsigned char playerId, const GameWorldBase& gwb, const AI::Level level)
+/// Create the RNG of the AI seeded from the player and the state of the game RNG (and hence the seed of the game)
+static XorShift createRng(const unsigned playerId)
+{
+    std::seed_seq seedSeq{UsedRandom::CalcChecksum(RANDOM.GetCurrentState()), playerId};
+    return XorShift(seedSeq);
+}
+
+AIPlayerJH::AIPlayerJH(const unsigned char playerId, const GameWorldBase& gwb, const AI::Level level,
+                       AIResourceValueCache* valueCache)
     : AIPlayer(playerId, gwb, level), UpgradeBldPos(MapPoint::Invalid()), resourceMaps(createResourceMaps(aii, aiMap)),
-      isInitGfCompleted(false), defeated(player.IsDefeated()), bldPlanner(std::make_unique<BuildingPlanner>(*this)),
+      isInitGfCompleted(false), defeated(player.IsDefeated()), rng_(createRng(playerId)),
+      bldPlanner(std::make_unique<BuildingPlanner>(*this)),
       construction(std::make_unique<AIConstruction>(*this))
 {
     InitNodes();
-    InitResourceMaps();
+    InitResourceMaps(valueCache);
 #ifdef DEBUG_AI
     SaveResourceMapsToFile();
 #endif
@@ -307,6 +319,12 @@ void AIPlayerJH::RunGF(const unsigned gf, bool gfisnwf)
     }
 }
 
+unsigned AIPlayerJH::GetRandomNumber(const unsigned maxExcl)
+{
+    RTTR_Assert(maxExcl > 0u);
+    return static_cast<unsigned>(rng_() % maxExcl);
+}
+
 void AIPlayerJH::OnChatMessage(unsigned /*sendPlayerId*/, ChatDestination, const std::string& /*msg*/) {}
 
 void AIPlayerJH::PlanNewBuildings(const unsigned gf)
@@ -344,7 +362,7 @@ void AIPlayerJH::PlanNewBuildings(const unsigned gf)
         DistributeGoodsByBlocking(GoodType::Boards, 30);
         DistributeGoodsByBlocking(GoodType::Stones, 50);
         // go to the picked random warehouse and try to build around it
-        int randomStore = rand() % (storehouses.size());
+        int randomStore = GetRandomNumber(storehouses.size());
         auto it = storehouses.begin();
         std::advance(it, randomStore);
         const MapPoint whPos = (*it)->GetPos();
@@ -365,7 +383,7 @@ void AIPlayerJH::PlanNewBuildings(const unsigned gf)
     const std::list<nobMilitary*>& militaryBuildings = aii.GetMilitaryBuildings();
     if(militaryBuildings.empty())
         return;
-    int randomMiliBld = rand() % militaryBuildings.size();
+    int randomMiliBld = GetRandomNumber(militaryBuildings.size());
     auto it2 = militaryBuildings.begin();
     std::advance(it2, randomMiliBld);
     MapPoint bldPos = (*it2)->GetPos();
@@ -650,10 +668,10 @@ void AIPlayerJH::UpdateNodesAround(const MapPoint pt, unsigned radius)
     }
 }
 
-void AIPlayerJH::InitResourceMaps()
+void AIPlayerJH::InitResourceMaps(AIResourceValueCache* valueCache)
 {
-    for(auto& resMap : resourceMaps)
-        resMap.init();
+    for(const auto res : helpers::EnumRange<AIResource>{})
+        resourceMaps[res].init(AIResourceValueCache::IsPlayerIndependent(res) ? valueCache : nullptr);
 }
 
 void AIPlayerJH::SetFarmedNodes(const MapPoint pt, bool set)
@@ -662,9 +680,7 @@ void AIPlayerJH::SetFarmedNodes(const MapPoint pt, bool set)
     const unsigned radius = 3;
 
     aiMap[pt].farmed = set;
-    std::vector<MapPoint> pts = gwb.GetPointsInRadius(pt, radius);
-    for(const MapPoint& curPt : pts)
-        aiMap[curPt].farmed = set;
+    gwb.VisitPointsInRadius(pt, radius, [this, set](const MapPoint curPt, unsigned) { aiMap[curPt].farmed = set; });
 }
 
 MapPoint AIPlayerJH::FindBestPosition(const MapPoint& pt, AIResource res, BuildingQuality size, unsigned radius,
@@ -1209,7 +1225,7 @@ void AIPlayerJH::HandleExpedition(const noShip* ship)
         aii.FoundColony(ship);
     else
     {
-        const unsigned offset = rand() % helpers::MaxEnumValue_v<ShipDirection>;
+        const unsigned offset = GetRandomNumber(helpers::MaxEnumValue_v<ShipDirection>);
         for(auto dir : helpers::EnumRange<ShipDirection>{})
         {
             dir = ShipDirection((rttr::enum_cast(dir) + offset) % helpers::MaxEnumValue_v<ShipDirection>);
@@ -1254,9 +1270,7 @@ void AIPlayerJH::HandleTreeChopped(const MapPoint pt)
 
     UpdateNodesAround(pt, 3);
 
-    int random = rand();
-
-    if(random % 2 == 0)
+    if(GetRandomNumber(2) == 0)
         AddMilitaryBuildJob(pt);
     else // if (random % 12 == 0)
         AddBuildJob(BuildingType::Woodcutter, pt);
@@ -1538,7 +1552,7 @@ void AIPlayerJH::TryToAttack()
         // We skip the current building with a probability of limit/numMilBlds
         // -> For twice the number of blds as the limit we will most likely skip every 2nd building
         // This way we check roughly (at most) limit buildings but avoid any preference for one building over an other
-        if(rand() % numMilBlds > limit)
+        if(GetRandomNumber(numMilBlds) > limit)
             continue;
 
         if(milBld->GetFrontierDistance() == FrontierDistance::Far) // inland building? -> skip it
@@ -1570,8 +1584,7 @@ void AIPlayerJH::TryToAttack()
     }
 
     // shuffle everything but headquarters and harbors without any troops in them
-    std::shuffle(potentialTargets.begin() + hq_or_harbor_without_soldiers, potentialTargets.end(),
-                 std::mt19937(std::random_device()()));
+    std::shuffle(potentialTargets.begin() + hq_or_harbor_without_soldiers, potentialTargets.end(), rng_);
 
     // check for each potential attacking target the number of available attacking soldiers
     for(const nobBaseMilitary* target : potentialTargets)
@@ -1684,11 +1697,10 @@ void AIPlayerJH::TrySeaAttack()
             // \n",gwb.GetHarborPoint(i).x,gwb.GetHarborPoint(i).y);
         }
     }
-    auto prng = std::mt19937(std::random_device()());
     // any undefendedTargets? -> pick one by random
     if(!undefendedTargets.empty())
     {
-        std::shuffle(undefendedTargets.begin(), undefendedTargets.end(), prng);
+        std::shuffle(undefendedTargets.begin(), undefendedTargets.end(), rng_);
         for(const nobBaseMilitary* targetMilBld : undefendedTargets)
         {
             std::vector<GameWorldBase::PotentialSeaAttacker> attackers =
@@ -1704,7 +1716,7 @@ void AIPlayerJH::TrySeaAttack()
     unsigned limit = 15;
     unsigned skip = 0;
     if(searcharoundharborspots.size() > 15)
-        skip = std::max<int>(rand() % (searcharoundharborspots.size() / 15 + 1) * 15, 1) - 1;
+        skip = std::max<int>(GetRandomNumber(searcharoundharborspots.size() / 15 + 1) * 15, 1) - 1;
     for(unsigned i = skip; i < searcharoundharborspots.size() && limit > 0; i++)
     {
         limit--;
@@ -1741,7 +1753,7 @@ void AIPlayerJH::TrySeaAttack()
     // random
     if(!undefendedTargets.empty())
     {
-        std::shuffle(undefendedTargets.begin(), undefendedTargets.end(), prng);
+        std::shuffle(undefendedTargets.begin(), undefendedTargets.end(), rng_);
         for(const nobBaseMilitary* targetMilBld : undefendedTargets)
         {
             std::vector<GameWorldBase::PotentialSeaAttacker> attackers =
@@ -1753,7 +1765,7 @@ void AIPlayerJH::TrySeaAttack()
             }
         }
     }
-    std::shuffle(potentialTargets.begin(), potentialTargets.end(), prng);
+    std::shuffle(potentialTargets.begin(), potentialTargets.end(), rng_);
     for(const nobBaseMilitary* ship : potentialTargets)
     {
         // TODO: decide if it is worth attacking the target and not just "possible"
@@ -1991,7 +2003,7 @@ bool AIPlayerJH::HuntablesinRange(const MapPoint pt, unsigned min)
     unsigned maxrange = 25;
     unsigned short fx, fy, lx, ly;
     const unsigned short SQUARE_SIZE = 19;
-    unsigned huntablecount = 0;
+    std::vector<MapPoint> animalPositions;
     if(pt.x > SQUARE_SIZE)
         fx = pt.x - SQUARE_SIZE;
     else
@@ -2021,18 +2033,15 @@ bool AIPlayerJH::HuntablesinRange(const MapPoint pt, unsigned min)
                     // Ist das Tier überhaupt zum Jagen geeignet?
                     if(!static_cast<const noAnimal&>(fig).CanHunted())
                         continue;
-                    // Und komme ich hin?
-                    if(gwb.FindHumanPath(pt, static_cast<const noAnimal&>(fig).GetPos(), maxrange))
-                    // Dann nehmen wir es
-                    {
-                        if(++huntablecount >= min)
-                            return true;
-                    }
+                    animalPositions.push_back(static_cast<const noAnimal&>(fig).GetPos());
                 }
             }
         }
     }
-    return false;
+    // Und komme ich hin?
+    const std::vector<unsigned> pathLengths = aii.FindHumanPathLengths(pt, animalPositions, maxrange, min);
+    return helpers::count_if(pathLengths, [](unsigned length) { return length != FreePathFinder::unreachable; })
+           >= min;
 }
 
 void AIPlayerJH::InitStoreAndMilitarylists()
@@ -2124,6 +2133,7 @@ void AIPlayerJH::InitDistribution()
 bool AIPlayerJH::ValidTreeinRange(const MapPoint pt)
 {
     unsigned max_radius = 6;
+    std::vector<MapPoint> treePts;
     for(MapCoord tx = gwb.GetXA(pt, Direction::West), r = 1; r <= max_radius;
         tx = gwb.GetXA(MapPoint(tx, pt.y), Direction::West), ++r)
     {
@@ -2137,20 +2147,19 @@ bool AIPlayerJH::ValidTreeinRange(const MapPoint pt)
                 {
                     // not already getting cut down or a freaking pineapple thingy?
                     if(!gwb.GetNode(t2).reserved && gwb.GetSpecObj<noTree>(t2)->ProducesWood())
-                    {
-                        if(gwb.FindHumanPath(pt, t2, 20))
-                            return true;
-                    }
+                        treePts.push_back(t2);
                 }
             }
         }
     }
-    return false;
+    return helpers::contains_if(aii.FindHumanPathLengths(pt, treePts, 20, 1),
+                                [](unsigned length) { return length != FreePathFinder::unreachable; });
 }
 
 bool AIPlayerJH::ValidStoneinRange(const MapPoint pt)
 {
     unsigned max_radius = 8;
+    std::vector<MapPoint> stonePts;
     for(MapCoord tx = gwb.GetXA(pt, Direction::West), r = 1; r <= max_radius;
         tx = gwb.GetXA(MapPoint(tx, pt.y), Direction::West), ++r)
     {
@@ -2161,14 +2170,12 @@ bool AIPlayerJH::ValidStoneinRange(const MapPoint pt)
             {
                 // point has tree & path is available?
                 if(gwb.GetNO(t2)->GetType() == NodalObjectType::Granite)
-                {
-                    if(gwb.FindHumanPath(pt, t2, 20))
-                        return true;
-                }
+                    stonePts.push_back(t2);
             }
         }
     }
-    return false;
+    return helpers::contains_if(aii.FindHumanPathLengths(pt, stonePts, 20, 1),
+                                [](unsigned length) { return length != FreePathFinder::unreachable; });
 }
 
 void AIPlayerJH::ExecuteLuaConstructionOrder(const MapPoint pt, BuildingType bt, bool forced)
@@ -2321,7 +2328,7 @@ bool AIPlayerJH::ValidFishInRange(const MapPoint pt)
               // try to find a path to a neighboring node on the coast
               for(const MapPoint nb : gwb.GetNeighbours(curPt))
               {
-                  if(gwb.FindHumanPath(pt, nb, 10))
+                  if(aii.FindHumanPath(pt, nb, 10))
                       return true;
               }
           }
@@ -9,12 +9,14 @@
 #include "ai/aijh/AIMap.h"
 #include "ai/aijh/AIResourceMap.h"
 #include "helpers/OptionalEnum.h"
+#include "random/XorShift.h"
 #include "gameTypes/MapCoordinates.h"
 #include <boost/container/static_vector.hpp>
 #include <list>
 #include <memory>
 #include <queue>
 
+class AIResourceValueCache;
 class noFlag;
 class noShip;
 class nobBaseWarehouse;
@@ -35,7 +37,9 @@ Subscription recordBQsToUpdate(const GameWorldBase& gw, std::vector<MapPoint>& b
 class AIPlayerJH final : public AIPlayer
 {
 public:
-    AIPlayerJH(unsigned char playerId, const GameWorldBase& gwb, AI::Level level);
+    /// The value cache (if any) is only used during construction
+    AIPlayerJH(unsigned char playerId, const GameWorldBase& gwb, AI::Level level,
+               AIResourceValueCache* valueCache = nullptr);
     ~AIPlayerJH() override;
 
     AIInterface& GetInterface() { return aii; }
@@ -48,6 +52,8 @@ public:
     unsigned GetNumJobs() const;
 
     void RunGF(unsigned gf, bool gfisnwf) override;
+    /// Return a random number in [0, maxExcl) from the RNG of this AI
+    unsigned GetRandomNumber(unsigned maxExcl);
     void OnChatMessage(unsigned sendPlayerId, ChatDestination, const std::string& msg) override;
 
     /// Test whether the player should resign or not
@@ -117,7 +123,7 @@ public:
     /// Returns the resource on a specific point
     AINodeResource CalcResource(MapPoint pt);
     /// Initialize the resource maps
-    void InitResourceMaps();
+    void InitResourceMaps(AIResourceValueCache* valueCache);
     /// Initialize the Store and Military building lists (only required when loading games but the AI doesnt know
     /// whether its a load game or new game so this runs when the ai starts in both cases)
     // now used to init farm space around farms ... lazy legacy
@@ -233,6 +239,8 @@ private:
     /// resigned yes/no
     bool defeated;
     AIEventManager eventManager;
+    /// RNG used for the decisions of this AI. Independent of the other AIs, so they can run in parallel reproducibly
+    XorShift rng_;
     std::unique_ptr<BuildingPlanner> bldPlanner;
     std::unique_ptr<AIConstruction> construction;
 
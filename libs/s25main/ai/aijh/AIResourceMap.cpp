@@ -5,6 +5,7 @@
 #include "AIResourceMap.h"
 #include "RttrForeachPt.h"
 #include "ai/AIInterface.h"
+#include "ai/AIResourceValueCache.h"
 #include "ai/aijh/AIMap.h"
 #include "buildings/noBuildingSite.h"
 #include "buildings/nobUsual.h"
@@ -36,7 +37,7 @@ AIResourceMap::AIResourceMap(const AIResource res, bool isInfinite, const AIInte
 
 AIResourceMap::~AIResourceMap() = default;
 
-void AIResourceMap::init()
+void AIResourceMap::init(AIResourceValueCache* valueCache)
 {
     const MapExtent mapSize = aiMap.GetSize();
 
@@ -56,12 +57,19 @@ void AIResourceMap::init()
               res));
             requiredTerrain = ETerrain::Mineable;
         }
+        // Calculate the values of all points at once which is a lot faster than doing it per point
+        std::shared_ptr<const std::vector<int>> values;
+        if(valueCache)
+            values = valueCache->GetValues(aii, res);
+        else
+            values = std::make_shared<const std::vector<int>>(aii.CalcResourceValues(res));
         RTTR_FOREACH_PT(MapPoint, mapSize)
         {
-            // Calculate only if we can build there
+            // Use only if we can build there
             const bool isValid =
               aii.gwb.IsOfTerrain(pt, [requiredTerrain](const TerrainDesc& desc) { return desc.Is(requiredTerrain); });
-            map[pt] = isValid ? aii.CalcResourceValue(pt, res) : 0;
+            const unsigned idx = map.GetIdx(pt);
+            map[idx] = isValid ? (*values)[idx] : 0;
         }
     }
 }
@@ -79,33 +87,34 @@ MapPoint AIResourceMap::findBestPosition(const MapPoint& pt, BuildingQuality siz
     MapPoint best = MapPoint::Invalid();
     int best_value = (minimum == std::numeric_limits<int>::min()) ? minimum : minimum - 1;
 
-    std::vector<MapPoint> pts = aii.gwb.GetPointsInRadiusWithCenter(pt, radius);
-    for(const MapPoint& curPt : pts)
-    {
-        const unsigned idx = map.GetIdx(curPt);
-        if(map[idx] > best_value)
-        {
-            if(!aiMap[idx].reachable || !aiMap[idx].owned || aiMap[idx].farmed)
-                continue;
-            RTTR_Assert(aii.GetBuildingQuality(curPt)
-                        == aiMap[curPt].bq); // Temporary, to check if aiMap is correctly update, see below
-            if(!canUseBq(aii.GetBuildingQuality(curPt), size)) // map[idx].bq; TODO: Update nodes BQ and use that
-                continue;
-            // special case fish -> check for other fishery buildings
-            if(res == AIResource::Fish && aii.isBuildingNearby(BuildingType::Fishery, curPt, 5))
-                continue;
-            if(res == AIResource::Borderland
-               && (aii.gwb.IsOnRoad(aii.gwb.GetNeighbour(curPt, Direction::SouthEast))
-                   || aii.gwb.IsInsideComputerBarrier(curPt)))
-                continue;
-            // dont build next to empty harborspots
-            if(aii.isHarborPosClose(curPt, 2, true))
-                continue;
-            best = curPt;
-            best_value = map[idx];
-            // TODO: calculate "perfect" rating and instantly return if we got that already
-        }
-    }
+    aii.gwb.VisitPointsInRadius(
+      pt, radius,
+      [&](const MapPoint curPt, unsigned) {
+          const unsigned idx = map.GetIdx(curPt);
+          if(map[idx] > best_value)
+          {
+              if(!aiMap[idx].reachable || !aiMap[idx].owned || aiMap[idx].farmed)
+                  return;
+              RTTR_Assert(aii.GetBuildingQuality(curPt)
+                          == aiMap[curPt].bq); // Temporary, to check if aiMap is correctly update, see below
+              if(!canUseBq(aii.GetBuildingQuality(curPt), size)) // map[idx].bq; TODO: Update nodes BQ and use that
+                  return;
+              // special case fish -> check for other fishery buildings
+              if(res == AIResource::Fish && aii.isBuildingNearby(BuildingType::Fishery, curPt, 5))
+                  return;
+              if(res == AIResource::Borderland
+                 && (aii.gwb.IsOnRoad(aii.gwb.GetNeighbour(curPt, Direction::SouthEast))
+                     || aii.gwb.IsInsideComputerBarrier(curPt)))
+                  return;
+              // dont build next to empty harborspots
+              if(aii.isHarborPosClose(curPt, 2, true))
+                  return;
+              best = curPt;
+              best_value = map[idx];
+              // TODO: calculate "perfect" rating and instantly return if we got that already
+          }
+      },
+      true);
 
     return best;
 }
@@ -11,6 +11,7 @@
 #include "gameTypes/BuildingType.h"
 
 class AIInterface;
+class AIResourceValueCache;
 namespace AIJH {
 
 class AIResourceMap
@@ -19,8 +20,8 @@ public:
     AIResourceMap(AIResource res, bool isInfinite, const AIInterface& aii, const AIMap& aiMap);
     ~AIResourceMap();
 
-    /// Initialize the resource map
-    void init();
+    /// Initialize the resource map. Values shared with other AIs are taken from the cache if given
+    void init(AIResourceValueCache* valueCache = nullptr);
 
     void updateAround(const MapPoint& pt, int radius);
 
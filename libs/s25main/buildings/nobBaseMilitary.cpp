@@ -14,6 +14,7 @@
 #include "figures/nofDefender.h"
 #include "helpers/containerUtils.h"
 #include "nobMilitary.h"
+#include "pathfinding/FreePathFinder.h"
 #include "random/Random.h"
 #include "world/GameWorld.h"
 #include "gameData/BuildingProperties.h"
@@ -183,19 +184,29 @@ MapPoint nobBaseMilitary::FindAnAttackerPlace(unsigned short& ret_radius, const
     const auto nodes = world->GetPointsInRadius(flagPos, 3, ReturnMapPointWithRadius{});
 
     // Weg zu allen möglichen Punkten berechnen und den mit den kürzesten Weg nehmen
+    std::vector<std::pair<MapPoint, unsigned>> validNodes;
+    std::vector<MapPoint> validPts;
+    for(const auto& node : nodes)
+    {
+        if(world->ValidWaitingAroundBuildingPoint(node.first, pos))
+        {
+            validNodes.push_back(node);
+            validPts.push_back(node.first);
+        }
+    }
+    const std::vector<unsigned> pathLengths = world->FindHumanPathLengths(soldierPos, validPts, 100);
+
     // Die bisher kürzeste gefundene Länge
     unsigned min_length = std::numeric_limits<unsigned>::max();
     MapPoint minPt = MapPoint::Invalid();
     ret_radius = 100;
-    for(const auto& node : nodes)
+    for(unsigned i = 0; i < validNodes.size(); i++)
     {
+        const auto& node = validNodes[i];
         // We found a point with a better radius
         if(node.second > ret_radius)
             break;
 
-        if(!world->ValidWaitingAroundBuildingPoint(node.first, pos))
-            continue;
-
         // Derselbe Punkt? Dann können wir gleich abbrechen, finden ja sowieso keinen kürzeren Weg mehr
         if(soldierPos == node.first)
         {
@@ -203,17 +214,12 @@ MapPoint nobBaseMilitary::FindAnAttackerPlace(unsigned short& ret_radius, const
             return node.first;
         }
 
-        unsigned length = 0;
-        // Gültiger Weg gefunden
-        if(world->FindHumanPath(soldierPos, node.first, 100, false, &length))
+        // Gültiger Weg gefunden, der kürzer als der bisher kürzeste ist? --> Dann nehmen wir diesen Punkt (vorerst)
+        if(pathLengths[i] != FreePathFinder::unreachable && pathLengths[i] < min_length)
         {
-            // Kürzer als bisher kürzester Weg? --> Dann nehmen wir diesen Punkt (vorerst)
-            if(length < min_length)
-            {
-                minPt = node.first;
-                ret_radius = node.second;
-                min_length = length;
-            }
+            minPt = node.first;
+            ret_radius = node.second;
+            min_length = pathLengths[i];
         }
     }
     return minPt;
@@ -19,6 +19,7 @@
 #include "ogl/glArchivItem_Bitmap.h"
 #include "ogl/glArchivItem_Bitmap_Player.h"
 #include "ogl/glSmartBitmap.h"
+#include "pathfinding/FreePathFinder.h"
 #include "pathfinding/RoadPathFinder.h"
 #include "postSystem/PostMsgWithBuilding.h"
 #include "random/Random.h"
@@ -1122,32 +1123,43 @@ void nobHarborBuilding::CancelFigure(noFigure* figure)
         nobBaseWarehouse::CancelFigure(figure);
 }
 
+std::vector<nobMilitary*> nobHarborBuilding::GetMilitaryBuildingsInAttackRange() const
+{
+    std::vector<nobMilitary*> buildings;
+    std::vector<MapPoint> bldPositions;
+    for(nobBaseMilitary* bld : world->LookForMilitaryBuildings(pos, 3))
+    {
+        // Liegt er auch im groben Raster und handelt es sich um den gleichen Besitzer?
+        if(bld->GetGOT() != GO_Type::NobMilitary || bld->GetPlayer() != player
+           || world->CalcDistance(bld->GetPos(), pos) > BASE_ATTACKING_DISTANCE)
+            continue;
+        buildings.push_back(static_cast<nobMilitary*>(bld));
+        bldPositions.push_back(bld->GetPos());
+    }
+    // Weg vom Hafen zu allen Militärgebäuden berechnen. Da die Bedingungen für Menschen in beide Richtungen gelten,
+    // entspricht das dem Weg vom Gebäude zum Hafen
+    const std::vector<unsigned> pathLengths =
+      world->FindHumanPathLengths(pos, bldPositions, MAX_ATTACKING_RUN_DISTANCE);
+    std::vector<nobMilitary*> result;
+    for(unsigned i = 0; i < buildings.size(); i++)
+    {
+        if(pathLengths[i] != FreePathFinder::unreachable)
+            result.push_back(buildings[i]);
+    }
+    return result;
+}
+
 /// Gibt verfügbare Angreifer zurück
 std::vector<nobHarborBuilding::SeaAttackerBuilding> nobHarborBuilding::GetAttackerBuildingsForSeaIdAttack()
 {
     std::vector<nobHarborBuilding::SeaAttackerBuilding> buildings;
-    sortedMilitaryBlds all_buildings = world->LookForMilitaryBuildings(pos, 3);
-    // Und zählen
-    for(nobBaseMilitary* all_building : all_buildings)
+    for(nobMilitary* bld : GetMilitaryBuildingsInAttackRange())
     {
-        if(all_building->GetGOT() != GO_Type::NobMilitary)
-            continue;
-
-        // Liegt er auch im groben Raster und handelt es sich um den gleichen Besitzer?
-        if(all_building->GetPlayer() != player
-           || world->CalcDistance(all_building->GetPos(), pos) > BASE_ATTACKING_DISTANCE)
-            continue;
-        // Gebäude suchen, vielleicht schon vorhanden? Dann können wir uns den pathfinding Aufwand sparen!
-        if(helpers::contains(buildings, static_cast<nobMilitary*>(all_building)))
-        {
-            // Dann zum nächsten test
-            continue;
-        }
-        // Weg vom Hafen zum Militärgebäude berechnen
-        if(!world->FindHumanPath(all_building->GetPos(), pos, MAX_ATTACKING_RUN_DISTANCE))
+        // Gebäude suchen, vielleicht schon vorhanden?
+        if(helpers::contains(buildings, bld))
             continue;
         // neues Gebäude mit weg und allem -> in die Liste!
-        SeaAttackerBuilding sab = {static_cast<nobMilitary*>(all_building), this, 0};
+        SeaAttackerBuilding sab = {bld, this, 0};
         buildings.push_back(sab);
     }
     return buildings;
@@ -1157,22 +1169,8 @@ std::vector<nobHarborBuilding::SeaAttackerBuilding>
 nobHarborBuilding::GetAttackerBuildingsForSeaAttack(const std::vector<unsigned>& defender_harbors)
 {
     std::vector<nobHarborBuilding::SeaAttackerBuilding> buildings;
-    sortedMilitaryBlds all_buildings = world->LookForMilitaryBuildings(pos, 3);
-    // Und zählen
-    for(nobBaseMilitary* all_building : all_buildings)
+    for(nobMilitary* bld : GetMilitaryBuildingsInAttackRange())
     {
-        if(all_building->GetGOT() != GO_Type::NobMilitary)
-            continue;
-
-        // Liegt er auch im groben Raster und handelt es sich um den gleichen Besitzer?
-        if(all_building->GetPlayer() != player
-           || world->CalcDistance(all_building->GetPos(), pos) > BASE_ATTACKING_DISTANCE)
-            continue;
-
-        // Weg vom Hafen zum Militärgebäude berechnen
-        if(!world->FindHumanPath(all_building->GetPos(), pos, MAX_ATTACKING_RUN_DISTANCE))
-            continue;
-
         // Entfernung zwischen Hafen und möglichen Zielhafenpunkt ausrechnen
         unsigned min_distance = 0xffffffff;
         for(unsigned int defender_harbor : defender_harbors)
@@ -1181,12 +1179,12 @@ nobHarborBuilding::GetAttackerBuildingsForSeaAttack(const std::vector<unsigned>&
         }
 
         // Gebäude suchen, vielleicht schon vorhanden?
-        auto it2 = helpers::find(buildings, static_cast<nobMilitary*>(all_building));
+        auto it2 = helpers::find(buildings, bld);
         // Noch nicht vorhanden?
         if(it2 == buildings.end())
         {
             // Dann neu hinzufügen
-            SeaAttackerBuilding sab = {static_cast<nobMilitary*>(all_building), this, min_distance};
+            SeaAttackerBuilding sab = {bld, this, min_distance};
             buildings.push_back(sab);
         }
         // Oder vorhanden und jetzige Distanz ist kleiner?
@@ -90,6 +90,8 @@ private:
     void CancelFigure(noFigure* figure) override;
     /// Bestellt ein Schiff zum Hafen, sofern dies nötig ist
     void OrderShip();
+    /// Returns own military buildings close enough to attack from this harbor and from which it can be reached
+    std::vector<nobMilitary*> GetMilitaryBuildingsInAttackRange() const;
 
     /// Stellt Verteidiger zur Verfügung
     std::unique_ptr<nofDefender> ProvideDefender(nofAttacker& attacker) override;
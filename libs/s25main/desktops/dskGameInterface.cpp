@@ -855,7 +855,7 @@ bool dskGameInterface::Msg_KeyDown(const KeyEvent& ke)
             return true;
         case 'j': // GFs überspringen
             if(game_->world_.IsSinglePlayer() || GAMECLIENT.IsReplayModeOn())
-                WINDOWMANAGER.ToggleWindow(std::make_unique<iwSkipGFs>(gwv));
+                WINDOWMANAGER.ToggleWindow(std::make_unique<iwSkipGFs>());
             return true;
         case 'l': // Minimap anzeigen
             WINDOWMANAGER.ToggleWindow(std::make_unique<iwMinimap>(minimap, gwv));
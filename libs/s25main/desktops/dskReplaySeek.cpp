@@ -0,0 +1,56 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "dskReplaySeek.h"
+#include "Loader.h"
+#include "WindowManager.h"
+#include "controls/ctrlTimer.h"
+#include "dskGameLoader.h"
+#include "dskMainMenu.h"
+#include "files.h"
+#include "ingameWindows/iwMsgbox.h"
+#include "network/GameClient.h"
+#include <cstdlib>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+dskReplaySeek::dskReplaySeek(boost::filesystem::path replayPath, const unsigned targetGF)
+    : Desktop(LOADER.GetImageN(ResourceId(LOAD_SCREENS[rand() % LOAD_SCREENS.size()]), 0)),
+      replayPath_(std::move(replayPath)), targetGF_(targetGF)
+{
+    WINDOWMANAGER.SetCursor(Cursor::None);
+}
+
+dskReplaySeek::~dskReplaySeek()
+{
+    WINDOWMANAGER.SetCursor();
+    GAMECLIENT.RemoveInterface(this);
+}
+
+void dskReplaySeek::SetActive(bool activate)
+{
+    Desktop::SetActive(activate);
+    // Start loading once this desktop is shown, i.e. the previous one with the old game is gone
+    if(activate && !GetCtrl<ctrlTimer>(0))
+        AddTimer(0, 1ms);
+}
+
+void dskReplaySeek::Msg_Timer(const unsigned ctrl_id)
+{
+    GetCtrl<ctrlTimer>(ctrl_id)->Stop();
+    GAMECLIENT.SetInterface(this);
+    if(!GAMECLIENT.StartReplay(replayPath_, targetGF_))
+    {
+        WINDOWMANAGER.Switch(std::make_unique<dskMainMenu>());
+        WINDOWMANAGER.ShowAfterSwitch(std::make_unique<iwMsgbox>(_("Error while playing replay!"),
+                                                                 _("Invalid Replay!"), nullptr, MsgboxButton::Ok,
+                                                                 MsgboxIcon::ExclamationRed));
+    }
+}
+
+void dskReplaySeek::CI_GameLoading(std::shared_ptr<Game> game)
+{
+    WINDOWMANAGER.Switch(std::make_unique<dskGameLoader>(std::move(game)));
+}
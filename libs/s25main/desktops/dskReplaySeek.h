@@ -0,0 +1,28 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Desktop.h"
+#include "network/ClientInterface.h"
+#include <boost/filesystem/path.hpp>
+#include <memory>
+
+/// Restarts a replay to jump to a GF before the current one or to one of its keyframes.
+/// The replay is loaded after the game desktop was destroyed as only one game can exist at a time.
+class dskReplaySeek : public Desktop, public ClientInterface
+{
+public:
+    dskReplaySeek(boost::filesystem::path replayPath, unsigned targetGF);
+    ~dskReplaySeek() override;
+
+    void SetActive(bool activate) override;
+    void CI_GameLoading(std::shared_ptr<Game> game) override;
+
+private:
+    void Msg_Timer(unsigned ctrl_id) override;
+
+    boost::filesystem::path replayPath_;
+    unsigned targetGF_;
+};
@@ -12,6 +12,7 @@
 #include "mygettext/mygettext.h"
 #include "ogl/DummyRenderer.h"
 #include "ogl/OpenGLRenderer.h"
+#include "ogl/SpriteBatch.h"
 #include "openglCfg.hpp"
 #include "s25util/Log.h"
 #include "s25util/error.h"
@@ -30,7 +31,8 @@ using SwapIntervalExt_t = int(int);
 SwapIntervalExt_t* wglSwapIntervalEXT = nullptr;
 
 VideoDriverWrapper::VideoDriverWrapper()
-    : videodriver(nullptr, nullptr), renderer_(nullptr), enableMouseWarping(true), texture_current(0)
+    : videodriver(nullptr, nullptr), renderer_(nullptr), spriteBatch_(std::make_unique<SpriteBatch>()),
+      enableMouseWarping(true), texture_current(0)
 {}
 
 VideoDriverWrapper::~VideoDriverWrapper()
@@ -203,6 +205,7 @@ unsigned VideoDriverWrapper::GetFPS() const
  */
 void VideoDriverWrapper::CleanUp()
 {
+    spriteBatch_->Flush();
     if(!texture_list.empty())
     {
         glDeleteTextures(texture_list.size(), static_cast<const GLuint*>(texture_list.data()));
@@ -226,10 +229,13 @@ unsigned VideoDriverWrapper::GenerateTexture()
 
 void VideoDriverWrapper::BindTexture(unsigned t)
 {
+    // Whoever binds a texture draws afterwards, so pending sprites must be drawn first
+    spriteBatch_->Flush();
     if(t != texture_current)
     {
         texture_current = t;
         glBindTexture(GL_TEXTURE_2D, t);
+        ++drawStats_.numTextureBinds;
     }
 }
 
@@ -237,6 +243,7 @@ void VideoDriverWrapper::DeleteTexture(unsigned t)
 {
     if(!t)
         return;
+    spriteBatch_->Flush();
     if(t == texture_current)
         texture_current = 0;
     auto it = helpers::find(texture_list, t);
@@ -262,6 +269,7 @@ void VideoDriverWrapper::SwapBuffers()
         s25util::fatal_error("No video driver selected!");
         return;
     }
+    spriteBatch_->Flush();
     frameLimiter_->sleepTillNextFrame(FrameCounter::clock::now());
     videodriver->SwapBuffers();
     FrameCounter::clock::time_point now = FrameCounter::clock::now();
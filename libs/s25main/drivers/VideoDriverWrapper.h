@@ -17,6 +17,14 @@ class IVideoDriver;
 class IRenderer;
 class FrameCounter;
 class FrameLimiter;
+class SpriteBatch;
+
+/// Number of OpenGL calls which are relevant for the performance
+struct DrawStats
+{
+    unsigned numDrawCalls = 0;
+    unsigned numTextureBinds = 0;
+};
 
 ///////////////////////////////////////////////////////////////////////////////
 // DriverWrapper
@@ -47,10 +55,17 @@ public:
     void CleanUp();
     /// erstellt eine Textur
     unsigned GenerateTexture();
+    /// Bind the texture for drawing. Flushes the sprite batch
     void BindTexture(unsigned t);
     void DeleteTexture(unsigned t);
 
     IRenderer* GetRenderer() { return renderer_.get(); }
+    SpriteBatch& GetSpriteBatch() { return *spriteBatch_; }
+
+    void CountDrawCall() { ++drawStats_.numDrawCalls; }
+    /// Get the number of draw calls and texture binds since the last reset
+    const DrawStats& GetDrawStats() const { return drawStats_; }
+    void ResetDrawStats() { drawStats_ = DrawStats(); }
 
     /// Swapped den Buffer
     void SwapBuffers();
@@ -123,6 +138,8 @@ private:
     drivers::DriverWrapper driver_wrapper;
     Handle videodriver;
     std::unique_ptr<IRenderer> renderer_;
+    std::unique_ptr<SpriteBatch> spriteBatch_;
+    DrawStats drawStats_;
     std::unique_ptr<FrameCounter> frameCtr_;
     std::unique_ptr<FrameLimiter> frameLimiter_;
     bool enableMouseWarping;
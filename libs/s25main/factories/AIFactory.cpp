@@ -7,12 +7,13 @@
 #include "ai/aijh/AIPlayerJH.h"
 #include "gameTypes/AIInfo.h"
 
-std::unique_ptr<AIPlayer> AIFactory::Create(const AI::Info& aiInfo, unsigned playerId, const GameWorldBase& world)
+std::unique_ptr<AIPlayer> AIFactory::Create(const AI::Info& aiInfo, unsigned playerId, const GameWorldBase& world,
+                                            AIResourceValueCache* valueCache)
 {
     switch(aiInfo.type)
     {
         case AI::Type::Dummy: return std::make_unique<DummyAI>(playerId, world, aiInfo.level); break;
         case AI::Type::Default:
-        default: return std::make_unique<AIJH::AIPlayerJH>(playerId, world, aiInfo.level); break;
+        default: return std::make_unique<AIJH::AIPlayerJH>(playerId, world, aiInfo.level, valueCache); break;
     }
 }
@@ -8,6 +8,7 @@
 
 class GameWorldBase;
 class AIPlayer;
+class AIResourceValueCache;
 namespace AI {
 struct Info;
 }
@@ -17,5 +18,7 @@ class AIFactory
 public:
     AIFactory() = delete;
 
-    static std::unique_ptr<AIPlayer> Create(const AI::Info& aiInfo, unsigned playerId, const GameWorldBase& world);
+    /// Create an AI. The value cache is optional and allows sharing calculations between the AIs of a game
+    static std::unique_ptr<AIPlayer> Create(const AI::Info& aiInfo, unsigned playerId, const GameWorldBase& world,
+                                            AIResourceValueCache* valueCache = nullptr);
 };
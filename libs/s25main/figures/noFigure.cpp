@@ -6,9 +6,11 @@
 #include "EventManager.h"
 #include "FindWhConditions.h"
 #include "GamePlayer.h"
+#include "GlobalGameSettings.h"
 #include "Loader.h"
 #include "SerializedGameData.h"
 #include "WineLoader.h"
+#include "addons/const_addons.h"
 #include "buildings/nobBaseWarehouse.h"
 #include "buildings/nobHarborBuilding.h"
 #include "helpers/containerUtils.h"
@@ -18,6 +20,8 @@
 #include "ogl/glArchivItem_Bitmap_Player.h"
 #include "ogl/glArchivItem_Bob.h"
 #include "ogl/glSmartBitmap.h"
+#include "pathfinding/FreePathFinder.h"
+#include "pathfinding/FreePathFinderImpl.h"
 #include "pathfinding/PathConditionHuman.h"
 #include "random/Random.h"
 #include "world/GameWorld.h"
@@ -46,7 +50,8 @@ const unsigned short WANDER_RADIUS_SOLDIERS = 15;
 noFigure::noFigure(const Job job, const MapPoint pos, const unsigned char player, noRoadNode* const goal)
     : noMovable(NodalObjectType::Figure, pos), fs(FigureState::GotToGoal), job_(job), player(player), cur_rs(nullptr),
       rs_pos(0), rs_dir(false), on_ship(false), goal_(goal), waiting_for_free_node(false), wander_way(0),
-      wander_tryings(0), flagPos_(MapPoint::Invalid()), flag_obj_id(0), burned_wh_id(0xFFFFFFFF), last_id(0xFFFFFFFF)
+      wander_tryings(0), flagPos_(MapPoint::Invalid()), flag_obj_id(0), burned_wh_id(0xFFFFFFFF), last_id(0xFFFFFFFF),
+      freeRoutePos_(0), freeRouteStart_(MapPoint::Invalid()), freeRouteDest_(MapPoint::Invalid())
 {
     // Haben wir ein Ziel?
     // Gehen wir in ein Lagerhaus? Dann dürfen wir da nicht unsere Arbeit ausführen, sondern
@@ -60,7 +65,8 @@ noFigure::noFigure(const Job job, const MapPoint pos, const unsigned char player
 noFigure::noFigure(const Job job, const MapPoint pos, const unsigned char player)
     : noMovable(NodalObjectType::Figure, pos), fs(FigureState::Job), job_(job), player(player), cur_rs(nullptr),
       rs_pos(0), rs_dir(false), on_ship(false), goal_(nullptr), waiting_for_free_node(false), wander_way(0),
-      wander_tryings(0), flagPos_(MapPoint::Invalid()), flag_obj_id(0), burned_wh_id(0xFFFFFFFF), last_id(0xFFFFFFFF)
+      wander_tryings(0), flagPos_(MapPoint::Invalid()), flag_obj_id(0), burned_wh_id(0xFFFFFFFF), last_id(0xFFFFFFFF),
+      freeRoutePos_(0), freeRouteStart_(MapPoint::Invalid()), freeRouteDest_(MapPoint::Invalid())
 {}
 
 void noFigure::Destroy()
@@ -97,12 +103,21 @@ void noFigure::Serialize(SerializedGameData& sgd) const
         sgd.PushUnsignedInt(flag_obj_id);
         sgd.PushUnsignedInt(burned_wh_id);
     }
+
+    helpers::pushContainer(sgd, freeRoute_);
+    if(!freeRoute_.empty())
+    {
+        sgd.PushUnsignedInt(freeRoutePos_);
+        helpers::pushPoint(sgd, freeRouteStart_);
+        helpers::pushPoint(sgd, freeRouteDest_);
+    }
 }
 
 noFigure::noFigure(SerializedGameData& sgd, const unsigned obj_id)
     : noMovable(sgd, obj_id), fs(sgd.Pop<FigureState>()), job_(sgd.Pop<Job>()), player(sgd.PopUnsignedChar()),
       cur_rs(sgd.PopObject<RoadSegment>(GO_Type::Roadsegment)), rs_pos(sgd.PopUnsignedShort()), rs_dir(sgd.PopBool()),
-      on_ship(sgd.PopBool()), last_id(0xFFFFFFFF)
+      on_ship(sgd.PopBool()), last_id(0xFFFFFFFF), freeRoutePos_(0), freeRouteStart_(MapPoint::Invalid()),
+      freeRouteDest_(MapPoint::Invalid())
 {
     if(fs == FigureState::GotToGoal || fs == FigureState::GoHome)
         goal_ = sgd.PopObject<noRoadNode>();
@@ -119,6 +134,17 @@ noFigure::noFigure(SerializedGameData& sgd, const unsigned obj_id)
         flag_obj_id = sgd.PopUnsignedInt();
         burned_wh_id = sgd.PopUnsignedInt();
     }
+
+    if(sgd.GetGameDataVersion() >= 12)
+    {
+        helpers::popContainer(sgd, freeRoute_);
+        if(!freeRoute_.empty())
+        {
+            freeRoutePos_ = sgd.PopUnsignedInt();
+            freeRouteStart_ = sgd.PopMapPoint();
+            freeRouteDest_ = sgd.PopMapPoint();
+        }
+    }
 }
 
 bool noFigure::IsSoldier() const
@@ -620,6 +646,39 @@ bool noFigure::WalkInRandomDir()
     return false;
 }
 
+helpers::OptionalEnum<Direction> noFigure::FindFreePathDir(const MapPoint dest, const unsigned maxLength,
+                                                           const bool randomRoute)
+{
+    if(!world->GetGGS().isEnabled(AddonId::FOLLOW_FREE_ROUTES))
+        return world->FindHumanPath(pos, dest, maxLength, randomRoute);
+
+    // Follow the current route if we are at its start, it leads to the same destination and is still passable
+    const bool canFollowRoute = freeRoutePos_ < freeRoute_.size() && freeRouteStart_ == pos && freeRouteDest_ == dest
+                                && freeRoute_.size() - freeRoutePos_ <= maxLength
+                                && world->GetFreePathFinder().CheckRoute(pos, freeRoute_, freeRoutePos_,
+                                                                         PathConditionHuman(*world), nullptr);
+    if(!canFollowRoute)
+    {
+        freeRoutePos_ = 0;
+        if(!world->FindHumanPath(pos, dest, maxLength, randomRoute, nullptr, &freeRoute_))
+        {
+            freeRoute_.clear();
+            return boost::none;
+        }
+    }
+
+    const Direction dir = freeRoute_[freeRoutePos_++];
+    freeRouteStart_ = world->GetNeighbour(pos, dir);
+    freeRouteDest_ = dest;
+    // Nothing left to follow
+    if(freeRoutePos_ == freeRoute_.size())
+    {
+        freeRoute_.clear();
+        freeRoutePos_ = 0;
+    }
+    return dir;
+}
+
 void noFigure::WanderFailedTrade()
 {
     DieFailedTrade();
@@ -664,7 +723,7 @@ void noFigure::WanderToFlag()
 
     // Weiter zur Flagge gehen
     // Gibts noch nen Weg dahin bzw. existiert die Flagge noch?
-    const auto dir = world->FindHumanPath(pos, flagPos_, 60, false);
+    const auto dir = FindFreePathDir(flagPos_, 60);
     if(dir)
     {
         // weiter hinlaufen
@@ -9,6 +9,7 @@
 #include "gameTypes/MapCoordinates.h"
 #include "gameTypes/RoadPathDirection.h"
 #include <cstdint>
+#include <vector>
 
 class ResourceId;
 class RoadSegment;
@@ -74,6 +75,13 @@ protected:
     /// Speichert letzten Animationsframes (zum Abspielen von Sounds)
     unsigned last_id;
 
+    /// Path followed when walking off-road (see FindFreePathDir)
+    std::vector<Direction> freeRoute_;
+    /// Index of the next step in freeRoute_
+    unsigned freeRoutePos_;
+    /// Node at which the remaining route starts and its destination
+    MapPoint freeRouteStart_, freeRouteDest_;
+
     explicit noFigure(const noFigure&) = default;
 
 private:
@@ -109,6 +117,10 @@ protected:
 
     virtual void AbrogateWorkplace() = 0;
 
+    /// Returns the direction to walk in to reach dest off-road, like GameWorldBase::FindHumanPath from the current
+    /// position. If enabled by the addon the path found is kept and followed as long as it is passable
+    helpers::OptionalEnum<Direction> FindFreePathDir(MapPoint dest, unsigned maxLength, bool randomRoute = false);
+
 public:
     /// Konstruktor für Figuren, die auf dem Wegenetz starten
     noFigure(Job job, MapPoint pos, unsigned char player, noRoadNode* goal);
@@ -91,7 +91,7 @@ void nofActiveSoldier::WalkingHome()
         building->AddActiveSoldier(world->RemoveFigure(pos, *this));
     else
     {
-        const auto dir = world->FindHumanPath(pos, building->GetFlagPos(), 100);
+        const auto dir = FindFreePathDir(building->GetFlagPos(), 100);
 
         if(dir)
         {
@@ -299,7 +299,7 @@ void nofActiveSoldier::MeetingEnemy()
     } else
     {
         // Not at the fighting spot yet, continue walking there
-        const auto dir = world->FindHumanPath(pos, fightSpot_, MAX_ATTACKING_RUN_DISTANCE);
+        const auto dir = FindFreePathDir(fightSpot_, MAX_ATTACKING_RUN_DISTANCE);
         if(dir)
             StartWalking(*dir);
         else
@@ -223,7 +223,7 @@ void nofAggressiveDefender::MissAggressiveDefendingWalk()
     RTTR_Assert(pos != attacker->GetPos()); // If so, why was it not found?
 
     // Calc next walking direction
-    const auto dir = world->FindHumanPath(pos, attacker->GetPos(), 100, true);
+    const auto dir = FindFreePathDir(attacker->GetPos(), 100, true);
 
     if(dir)
     {
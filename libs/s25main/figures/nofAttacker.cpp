@@ -162,7 +162,7 @@ void nofAttacker::Walked()
                 }
             } else
             {
-                const auto dir = world->FindHumanPath(pos, goalFlagPos, 5, true);
+                const auto dir = FindFreePathDir(goalFlagPos, 5, true);
                 if(dir)
                     StartWalking(*dir);
                 else
@@ -261,8 +261,7 @@ void nofAttacker::Walked()
                     StartWalking(Direction::NorthWest);
                 else
                 {
-                    const auto dir =
-                      world->FindHumanPath(pos, harborFlagPos, MAX_ATTACKING_RUN_DISTANCE, false, nullptr);
+                    const auto dir = FindFreePathDir(harborFlagPos, MAX_ATTACKING_RUN_DISTANCE);
                     if(dir)
                         StartWalking(*dir);
                     else
@@ -431,7 +430,7 @@ void nofAttacker::MissAttackingWalk()
 
         TryToOrderAggressiveDefender();
 
-        const auto dir = world->FindHumanPath(pos, goal, MAX_ATTACKING_RUN_DISTANCE, true);
+        const auto dir = FindFreePathDir(goal, MAX_ATTACKING_RUN_DISTANCE, true);
         if(dir)
             StartWalking(*dir);
         else
@@ -604,7 +603,7 @@ void nofAttacker::AttackedGoalDestroyed()
 bool nofAttacker::AttackDefenderAtFlag()
 {
     // Walk to flag if possible
-    const auto dir = world->FindHumanPath(pos, attacked_goal->GetFlagPos(), 3, true);
+    const auto dir = FindFreePathDir(attacked_goal->GetFlagPos(), 3, true);
     if(!dir)
         return false;
 
@@ -704,7 +703,7 @@ void nofAttacker::CapturingWalking()
     } else
     {
         // Our home still exists so walk to the flag of the building if possible
-        const auto dir = world->FindHumanPath(pos, attFlagPos, 10, true);
+        const auto dir = FindFreePathDir(attFlagPos, 10, true);
         if(dir)
             StartWalking(*dir);
         else
@@ -905,7 +904,7 @@ void nofAttacker::HandleState_SeaAttack_ReturnToShip()
         Wander();
     } else
     {
-        const auto dir = world->FindHumanPath(pos, shipPos, MAX_ATTACKING_RUN_DISTANCE);
+        const auto dir = FindFreePathDir(shipPos, MAX_ATTACKING_RUN_DISTANCE);
         if(dir)
             StartWalking(*dir);
         else
@@ -8,6 +8,7 @@
 #include "SoundManager.h"
 #include "buildings/nobUsual.h"
 #include "notifications/BuildingNote.h"
+#include "pathfinding/FreePathFinder.h"
 #include "random/Random.h"
 #include "world/GameWorld.h"
 #include "gameData/JobConsts.h"
@@ -98,28 +99,47 @@ void nofFarmhand::HandleDerivedEvent(const unsigned /*id*/)
 
             helpers::EnumArray<std::vector<MapPoint>, PointQuality> available_points;
 
+            // Collect possible points by radius and check which are reachable with one search
+            std::vector<MapPoint> possiblePts;
+            std::vector<PointQuality> possiblePtQualities;
+            // Index of the first point of each radius
+            std::vector<unsigned> radiusStartIdxs;
             for(MapCoord tx = world->GetXA(pos, Direction::West), r = 1; r <= max_radius;
                 tx = world->GetXA(MapPoint(tx, pos.y), Direction::West), ++r)
             {
-                bool pointFound = false;
-
+                radiusStartIdxs.push_back(possiblePts.size());
                 MapPoint pt(tx, pos.y);
                 for(const auto dir : helpers::enumRange(Direction::NorthEast))
                 {
                     for(MapCoord r2 = 0; r2 < r; pt = world->GetNeighbour(pt, dir), ++r2)
                     {
                         const auto quality = GetPointQuality(pt, true);
-                        if(quality != PointQuality::NotPossible && world->FindHumanPath(this->pos, pt, 20))
+                        if(quality != PointQuality::NotPossible)
                         {
-                            if(!world->GetNode(pt).reserved)
-                            {
-                                available_points[quality].push_back(pt);
-                                pointFound = true;
-                            } else if(job_ == Job::Stonemason)
-                                wait = true;
+                            possiblePts.push_back(pt);
+                            possiblePtQualities.push_back(quality);
                         }
                     }
                 }
+            }
+            radiusStartIdxs.push_back(possiblePts.size());
+            const std::vector<unsigned> pathLengths = world->FindHumanPathLengths(pos, possiblePts, 20);
+
+            for(unsigned r = 0; r + 1 < radiusStartIdxs.size(); ++r)
+            {
+                bool pointFound = false;
+
+                for(unsigned i = radiusStartIdxs[r]; i < radiusStartIdxs[r + 1]; ++i)
+                {
+                    if(pathLengths[i] == FreePathFinder::unreachable)
+                        continue;
+                    if(!world->GetNode(possiblePts[i]).reserved)
+                    {
+                        available_points[possiblePtQualities[i]].push_back(possiblePts[i]);
+                        pointFound = true;
+                    } else if(job_ == Job::Stonemason)
+                        wait = true;
+                }
 
                 // Stop if we found enough radii with points
                 if(pointFound)
@@ -194,7 +214,7 @@ void nofFarmhand::WalkToWorkpoint()
     } else
     {
         // Keep on walking if possible
-        const auto dir = world->FindHumanPath(pos, dest, 20);
+        const auto dir = FindFreePathDir(dest, 20);
         if(dir)
             StartWalking(*dir);
         else
@@ -226,7 +246,7 @@ void nofFarmhand::WalkHome()
         return;
     }
 
-    const auto dir = world->FindHumanPath(pos, dest, 40);
+    const auto dir = FindFreePathDir(dest, 40);
     // Weg suchen und ob wir überhaupt noch nach Hause kommen
     if(!dir)
     {
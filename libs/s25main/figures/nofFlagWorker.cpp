@@ -90,7 +90,7 @@ void nofFlagWorker::GoToFlag()
     } else
     {
         // Weg suchen
-        const auto dir = world->FindHumanPath(pos, flag->GetPos(), 40);
+        const auto dir = FindFreePathDir(flag->GetPos(), 40);
 
         // Wenns keinen gibt, rumirren, ansonsten hinlaufen
         if(dir)
@@ -241,7 +241,7 @@ void nofGeologist::Walked()
         } else
         {
             // Weg zum nächsten Punkt suchen
-            const auto dir = world->FindHumanPath(pos, node_goal, 20);
+            const auto dir = FindFreePathDir(node_goal, 20);
 
             // Wenns keinen gibt
             if(!dir)
@@ -359,7 +359,7 @@ helpers::OptionalEnum<Direction> nofGeologist::GetNextNode()
             helpers::OptionalEnum<Direction> ret_dir;
             if(pos != node_goal)
             {
-                ret_dir = world->FindHumanPath(pos, node_goal, 20);
+                ret_dir = FindFreePathDir(node_goal, 20);
                 if(!ret_dir)
                     continue;
             }
@@ -15,6 +15,7 @@
 #include "network/GameClient.h"
 #include "notifications/BuildingNote.h"
 #include "ogl/glArchivItem_Bitmap_Player.h"
+#include "pathfinding/FreePathFinder.h"
 #include "pathfinding/PathConditionHuman.h"
 #include "random/Random.h"
 #include "world/GameWorld.h"
@@ -135,7 +136,8 @@ void nofHunter::TryStartHunting()
     const int SQUARE_SIZE = 19;
 
     // Liste mit den gefundenen Tieren
-    std::vector<noAnimal*> available_animals;
+    std::vector<noAnimal*> huntable_animals;
+    std::vector<MapPoint> animalPositions;
 
     // Durchgehen und nach Tieren suchen
     Position curPos;
@@ -155,16 +157,21 @@ void nofHunter::TryStartHunting()
                 if(!animal.CanHunted())
                     continue;
 
-                // Und komme ich hin?
-                if(pos == animal.GetPos() || world->FindHumanPath(pos, animal.GetPos(), MAX_HUNTING_DISTANCE))
-                {
-                    // Dann nehmen wir es
-                    available_animals.push_back(&animal);
-                }
+                huntable_animals.push_back(&animal);
+                animalPositions.push_back(animal.GetPos());
             }
         }
     }
 
+    // Und komme ich hin? Dann nehmen wir es
+    std::vector<noAnimal*> available_animals;
+    const std::vector<unsigned> pathLengths = world->FindHumanPathLengths(pos, animalPositions, MAX_HUNTING_DISTANCE);
+    for(unsigned i = 0; i < huntable_animals.size(); i++)
+    {
+        if(pathLengths[i] != FreePathFinder::unreachable)
+            available_animals.push_back(huntable_animals[i]);
+    }
+
     // Gibt es überhaupt ein Tier, das ich jagen kann?
     if(!available_animals.empty())
     {
@@ -224,7 +231,8 @@ void nofHunter::HandleStateChasing()
 
         // Nun müssen wir drumherum einen Punkt suchen, von dem wir schießen, der natürlich direkt dem Standort
         // des Tieres gegenüberliegen muss (mit zufälliger Richtung beginnen)
-        shootingPos = MapPoint::Invalid();
+        std::vector<Direction> shootingDirs;
+        std::vector<MapPoint> shootingPositions;
         for(const Direction d : helpers::enumRange(RANDOM_ENUM(Direction)))
         {
             Position delta;
@@ -257,12 +265,20 @@ void nofHunter::HandleStateChasing()
                 default: throw std::logic_error("Wrong value?");
             }
 
-            MapPoint curShootingPos = world->MakeMapPoint(animalPos + delta);
-            if(curShootingPos == pos || world->FindHumanPath(pos, curShootingPos, 6))
+            shootingDirs.push_back(d);
+            shootingPositions.push_back(world->MakeMapPoint(animalPos + delta));
+        }
+
+        // Den ersten nehmen, den wir erreichen können
+        const std::vector<unsigned> pathLengths = world->FindHumanPathLengths(pos, shootingPositions, 6);
+        shootingPos = MapPoint::Invalid();
+        for(unsigned i = 0; i < shootingPositions.size(); i++)
+        {
+            if(pathLengths[i] != FreePathFinder::unreachable)
             {
-                shootingPos = curShootingPos;
+                shootingPos = shootingPositions[i];
                 // Richtung, in die geschossen wird, bestimmen (natürlich die entgegengesetzte nehmen)
-                shooting_dir = d + 3u;
+                shooting_dir = shootingDirs[i] + 3u;
                 break;
             }
         }
@@ -282,7 +298,7 @@ void nofHunter::HandleStateChasing()
     } else
     {
         // Weg dorthin suchen
-        const auto dir = world->FindHumanPath(pos, animal->GetPos(), MAX_HUNTING_DISTANCE);
+        const auto dir = FindFreePathDir(animal->GetPos(), MAX_HUNTING_DISTANCE);
         if(dir)
         {
             // Weg gefunden, dann hinlaufen
@@ -305,7 +321,7 @@ void nofHunter::HandleStateFindingShootingPoint()
     } else
     {
         // Weg dorthin suchen
-        const auto dir = world->FindHumanPath(pos, shootingPos, 6);
+        const auto dir = FindFreePathDir(shootingPos, 6);
         if(dir)
         {
             // Weg gefunden, dann hinlaufen
@@ -355,7 +371,7 @@ void nofHunter::HandleStateWalkingToCadaver()
     } else
     {
         // Weg dorthin suchen
-        const auto dir = world->FindHumanPath(pos, animal->GetPos(), 6);
+        const auto dir = FindFreePathDir(animal->GetPos(), 6);
         if(dir)
         {
             // Weg gefunden, dann hinlaufen
@@ -410,7 +426,7 @@ void nofHunter::HandleStateWalkingHome()
 
     // Weg suchen und ob wir überhaupt noch nach Hause kommen (Toleranz bei dem Weg mit einberechnen,
     // damit er nicht einfach rumirrt und wegstirbt, wenn er einmal ein paar Felder zu weit gelaufen ist)
-    const auto dir = world->FindHumanPath(pos, homeFlagPos, MAX_HUNTING_DISTANCE + MAX_HUNTING_DISTANCE / 4);
+    const auto dir = FindFreePathDir(homeFlagPos, MAX_HUNTING_DISTANCE + MAX_HUNTING_DISTANCE / 4);
     if(dir)
     {
         // All good, let's start walking there
@@ -102,7 +102,7 @@ void nofScout_Free::Scout()
     } else
     {
         // Weg suchen
-        const auto dir = world->FindHumanPath(pos, nextPos, 30);
+        const auto dir = FindFreePathDir(nextPos, 30);
 
         // Wenns keinen gibt, neuen suchen, ansonsten hinlaufen
         if(dir)
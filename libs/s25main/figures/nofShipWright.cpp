@@ -11,6 +11,7 @@
 #include "buildings/nobShipYard.h"
 #include "network/GameClient.h"
 #include "ogl/glArchivItem_Bitmap_Player.h"
+#include "pathfinding/FreePathFinder.h"
 #include "random/Random.h"
 #include "world/GameWorld.h"
 #include "nodeObjs/noShipBuildingSite.h"
@@ -57,10 +58,21 @@ void nofShipWright::HandleDerivedEvent(const unsigned /*id*/)
                 const std::vector<MapPoint> possiblePts =
                   world->GetMatchingPointsInRadius(flagPos, SHIPWRIGHT_RADIUS, IsNotReserved(*world));
 
-                // Verfügbare Punkte, die geeignete Plätze darstellen würden
-                std::vector<MapPoint> available_points;
+                // Return the points which can be reached from the flag
+                const auto getReachablePts = [flagPos](const std::vector<MapPoint>& pts) {
+                    const std::vector<unsigned> pathLengths =
+                      world->FindHumanPathLengths(flagPos, pts, SHIPWRIGHT_WALKING_DISTANCE);
+                    std::vector<MapPoint> result;
+                    for(unsigned i = 0; i < pts.size(); i++)
+                    {
+                        if(pathLengths[i] != FreePathFinder::unreachable)
+                            result.push_back(pts[i]);
+                    }
+                    return result;
+                };
 
                 // Besitze ich noch ein Schiff, was gebaut werden muss?
+                std::vector<MapPoint> shipPts;
                 for(const auto& pt : possiblePts)
                 {
                     noBase* obj = world->GetNode(pt).obj;
@@ -72,20 +84,23 @@ void nofShipWright::HandleDerivedEvent(const unsigned /*id*/)
                     if(obj->GetGOT() == GO_Type::Shipbuildingsite
                        && static_cast<noShipBuildingSite*>(obj)->GetPlayer() == player)
                     {
-                        if(world->FindHumanPath(flagPos, pt, SHIPWRIGHT_WALKING_DISTANCE))
-                            available_points.push_back(pt);
+                        shipPts.push_back(pt);
                     }
                 }
+                // Verfügbare Punkte, die geeignete Plätze darstellen würden
+                std::vector<MapPoint> available_points = getReachablePts(shipPts);
 
                 // Kein Schiff im Bau gefunden? Dann Plätzchen für ein neues Schiff suchen
                 if(available_points.empty())
                 {
+                    std::vector<MapPoint> goodPts;
                     for(const auto& pt : possiblePts)
                     {
                         // Dieser Punkt geeignet?
-                        if(IsPointGood(pt) && world->FindHumanPath(flagPos, pt, SHIPWRIGHT_WALKING_DISTANCE))
-                            available_points.push_back(pt);
+                        if(IsPointGood(pt))
+                            goodPts.push_back(pt);
                     }
+                    available_points = getReachablePts(goodPts);
                 }
 
                 // Punkte gefunden?
@@ -193,7 +208,7 @@ void nofShipWright::WalkToWorkpoint()
         current_ev = GetEvMgr().AddEvent(this, WORKING_TIME_SHIPS, 1);
         return;
     }
-    const auto dir = world->FindHumanPath(pos, curShipBuildPos, 20);
+    const auto dir = FindFreePathDir(curShipBuildPos, 20);
     // Weg suchen und gucken ob der Punkt noch in Ordnung ist
     if(!dir || (!IsPointGood(curShipBuildPos) && world->GetGOT(curShipBuildPos) != GO_Type::Shipbuildingsite))
     {
@@ -227,7 +242,7 @@ void nofShipWright::WalkHome()
         WorkingReady();
         return;
     }
-    const auto dir = world->FindHumanPath(pos, curShipBuildPos, SHIPWRIGHT_WALKING_DISTANCE);
+    const auto dir = FindFreePathDir(curShipBuildPos, SHIPWRIGHT_WALKING_DISTANCE);
     // Weg suchen und ob wir überhaupt noch nach Hause kommen
     if(dir)
     {
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,9 +7,110 @@
 #include "helpers/format.hpp"
 #include "s25util/Log.h"
 #include <boost/nowide/fstream.hpp>
+#include <algorithm>
+#include <array>
 #include <bzlib.h>
 #include <cmath>
+#include <memory>
 #include <stdexcept>
+#include <thread>
+#include <zstd.h>
+
+namespace {
+constexpr std::array<char, 3> bzip2Magic = {'B', 'Z', 'h'};
+// Little endian 0xFD2FB528
+constexpr std::array<char, 4> zstdMagic = {'\x28', '\xB5', '\x2F', '\xFD'};
+
+template<size_t N>
+bool startsWith(const std::vector<char>& data, const std::array<char, N>& magic)
+{
+    return data.size() >= magic.size() && std::equal(magic.begin(), magic.end(), data.begin());
+}
+
+std::vector<char> compressBZip2(const std::vector<char>& data, const CompressionLevel level)
+{
+    // Buffer should be at most 1% bigger + 600 Bytes according to docu
+    auto compressedLen = static_cast<unsigned>(std::ceil(data.size() * 1.01)) + 600u;
+    std::vector<char> compressedData(compressedLen);
+
+    const int blockSize100k = (level == CompressionLevel::Fast) ? 1 : 9;
+    const int err = BZ2_bzBuffToBuffCompress(compressedData.data(), &compressedLen, const_cast<char*>(data.data()),
+                                             data.size(), blockSize100k, 0, 250);
+    if(err != BZ_OK)
+        throw std::runtime_error(helpers::format("BZ2_bzBuffToBuffCompress failed with error: %1%", err));
+    compressedData.resize(compressedLen);
+    return compressedData;
+}
+
+std::vector<char> decompressBZip2(const std::vector<char>& data, size_t const uncompressedSize)
+{
+    std::vector<char> uncompressedData(uncompressedSize);
+
+    unsigned outLength = uncompressedSize;
+
+    const int err = BZ2_bzBuffToBuffDecompress(uncompressedData.data(), &outLength, const_cast<char*>(data.data()),
+                                               data.size(), 0, 0);
+    if(err != BZ_OK)
+        throw std::runtime_error(helpers::format("BZ2_bzBuffToBuffDecompress failed with error: %1%", err));
+
+    if(outLength != uncompressedSize)
+        throw std::runtime_error(
+          helpers::format("Length mismatch after decompressing. Expected: %1%, got %2%", uncompressedSize, outLength));
+
+    return uncompressedData;
+}
+
+int getZstdLevel(const CompressionLevel level)
+{
+    switch(level)
+    {
+        case CompressionLevel::Fast: return 1;
+        case CompressionLevel::Default: return 6;
+        case CompressionLevel::Best: return 19;
+    }
+    return ZSTD_CLEVEL_DEFAULT; // LCOV_EXCL_LINE
+}
+
+std::vector<char> compressZstd(const std::vector<char>& data, const CompressionLevel level)
+{
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+    if(!ctx)
+        throw std::runtime_error("ZSTD_createCCtx failed");
+    ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_compressionLevel, getZstdLevel(level));
+    // The slow levels profit from multiple threads for big data. Fails (harmlessly) if zstd was built without them
+    if(level == CompressionLevel::Best)
+        ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_nbWorkers, static_cast<int>(std::thread::hardware_concurrency()));
+
+    std::vector<char> compressedData(ZSTD_compressBound(data.size()));
+    const size_t compressedLen =
+      ZSTD_compress2(ctx.get(), compressedData.data(), compressedData.size(), data.data(), data.size());
+    if(ZSTD_isError(compressedLen))
+    {
+        throw std::runtime_error(
+          helpers::format("ZSTD_compress2 failed with error: %1%", ZSTD_getErrorName(compressedLen)));
+    }
+    compressedData.resize(compressedLen);
+    return compressedData;
+}
+
+std::vector<char> decompressZstd(const std::vector<char>& data, size_t const uncompressedSize)
+{
+    std::vector<char> uncompressedData(uncompressedSize);
+    const size_t outLength =
+      ZSTD_decompress(uncompressedData.data(), uncompressedData.size(), data.data(), data.size());
+    if(ZSTD_isError(outLength))
+    {
+        throw std::runtime_error(
+          helpers::format("ZSTD_decompress failed with error: %1%", ZSTD_getErrorName(outLength)));
+    }
+
+    if(outLength != uncompressedSize)
+        throw std::runtime_error(
+          helpers::format("Length mismatch after decompressing. Expected: %1%, got %2%", uncompressedSize, outLength));
+
+    return uncompressedData;
+}
+} // namespace
 
 bool CompressedData::DecompressToFile(const boost::filesystem::path& filePath, unsigned* checksum) const
 {
@@ -69,34 +170,32 @@ bool CompressedData::CompressFromFile(const boost::filesystem::path& filePath, u
     return true;
 }
 
-std::vector<char> CompressedData::compress(const std::vector<char>& data)
+std::vector<char> CompressedData::compress(const std::vector<char>& data, const CompressionLevel level,
+                                           const CompressionCodec codec)
 {
-    // Buffer should be at most 1% bigger + 600 Bytes according to docu
-    auto compressedLen = static_cast<unsigned>(std::ceil(data.size() * 1.01)) + 600u;
-    std::vector<char> compressedData(compressedLen);
-
-    const int err = BZ2_bzBuffToBuffCompress(compressedData.data(), &compressedLen, const_cast<char*>(data.data()),
-                                             data.size(), 9, 0, 250);
-    if(err != BZ_OK)
-        throw std::runtime_error(helpers::format("BZ2_bzBuffToBuffCompress failed with error: %1%", err));
-    compressedData.resize(compressedLen);
-    return compressedData;
+    switch(codec)
+    {
+        case CompressionCodec::BZip2: return compressBZip2(data, level);
+        case CompressionCodec::Zstd: return compressZstd(data, level);
+    }
+    throw std::logic_error("Invalid compression codec"); // LCOV_EXCL_LINE
 }
 
 std::vector<char> CompressedData::decompress(const std::vector<char>& data, size_t const uncompressedSize)
 {
-    std::vector<char> uncompressedData(uncompressedSize);
-
-    unsigned outLength = uncompressedSize;
-
-    const int err = BZ2_bzBuffToBuffDecompress(uncompressedData.data(), &outLength, const_cast<char*>(data.data()),
-                                               data.size(), 0, 0);
-    if(err != BZ_OK)
-        throw std::runtime_error(helpers::format("BZ2_bzBuffToBuffDecompress failed with error: %1%", err));
-
-    if(outLength != uncompressedSize)
-        throw std::runtime_error(
-          helpers::format("Length mismatch after decompressing. Expected: %1%, got %2%", uncompressedSize, outLength));
+    switch(getCodec(data))
+    {
+        case CompressionCodec::BZip2: return decompressBZip2(data, uncompressedSize);
+        case CompressionCodec::Zstd: return decompressZstd(data, uncompressedSize);
+    }
+    throw std::logic_error("Invalid compression codec"); // LCOV_EXCL_LINE
+}
 
-    return uncompressedData;
+CompressionCodec CompressedData::getCodec(const std::vector<char>& data)
+{
+    if(startsWith(data, zstdMagic))
+        return CompressionCodec::Zstd;
+    if(startsWith(data, bzip2Magic))
+        return CompressionCodec::BZip2;
+    throw std::runtime_error("Unknown compression format");
 }
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -8,6 +8,22 @@
 #include <string>
 #include <vector>
 
+/// Algorithm used for compressing data.
+/// The compressed data starts with the magic number of the codec, so decompressing detects it automatically.
+enum class CompressionCodec
+{
+    BZip2, /// Used by old versions, slow
+    Zstd
+};
+
+/// Trade-off between compression speed and size
+enum class CompressionLevel
+{
+    Fast,    /// E.g. for autosaves and snapshots which should not interrupt the game
+    Default, /// E.g. for savegames and maps
+    Best     /// Smallest size, e.g. for replays which are archived
+};
+
 /// Holds compressed data
 struct CompressedData
 {
@@ -25,6 +41,9 @@ struct CompressedData
     /// Actual data
     std::vector<char> data;
 
-    static std::vector<char> compress(const std::vector<char>& data);
+    static std::vector<char> compress(const std::vector<char>& data, CompressionLevel level = CompressionLevel::Default,
+                                      CompressionCodec codec = CompressionCodec::Zstd);
     static std::vector<char> decompress(const std::vector<char>& data, size_t uncompressedSize);
+    /// Return the codec the data was compressed with. Throws if it is unknown
+    static CompressionCodec getCodec(const std::vector<char>& data);
 };
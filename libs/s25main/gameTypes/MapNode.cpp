@@ -17,7 +17,8 @@ MapNode::MapNode()
     std::fill(boundary_stones.begin(), boundary_stones.end(), 0);
 }
 
-void MapNode::Serialize(SerializedGameData& sgd, const unsigned numPlayers, const WorldDescription& desc) const
+void MapNode::Serialize(SerializedGameData& sgd, const WorldDescription& desc,
+                        const std::function<void()>& serializeFoW) const
 {
     helpers::pushContainer(sgd, roads);
     sgd.PushUnsignedChar(altitude);
@@ -28,17 +29,16 @@ void MapNode::Serialize(SerializedGameData& sgd, const unsigned numPlayers, cons
     sgd.PushBool(reserved);
     sgd.PushUnsignedChar(owner);
     helpers::pushContainer(sgd, boundary_stones);
-    RTTR_Assert(numPlayers <= fow.size());
-    for(unsigned z = 0; z < numPlayers; ++z)
-        fow[z].Serialize(sgd);
+    serializeFoW();
     sgd.PushObject(obj);
     sgd.PushObjectContainer(figures);
     sgd.PushUnsignedShort(seaId);
     sgd.PushUnsignedInt(harborId);
 }
 
-void MapNode::Deserialize(SerializedGameData& sgd, const unsigned numPlayers, const WorldDescription& desc,
-                          const std::vector<DescIdx<TerrainDesc>>& landscapeTerrains)
+void MapNode::Deserialize(SerializedGameData& sgd, const WorldDescription& desc,
+                          const std::vector<DescIdx<TerrainDesc>>& landscapeTerrains,
+                          const std::function<void()>& deserializeFoW)
 {
     helpers::popContainer(sgd, roads);
 
@@ -67,9 +67,7 @@ void MapNode::Deserialize(SerializedGameData& sgd, const unsigned numPlayers, co
     helpers::popContainer(sgd, boundary_stones);
     if(sgd.GetGameDataVersion() < 9)
         bq = sgd.Pop<BuildingQuality>();
-    RTTR_Assert(numPlayers <= fow.size());
-    for(unsigned z = 0; z < numPlayers; ++z)
-        fow[z].Deserialize(sgd);
+    deserializeFoW();
     obj = sgd.PopObject<noBase>();
     sgd.PopObjectContainer(figures);
     seaId = sgd.PopUnsignedShort();
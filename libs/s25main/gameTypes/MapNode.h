@@ -10,8 +10,8 @@
 #include "gameTypes/FoWNode.h"
 #include "gameTypes/MapTypes.h"
 #include "gameData/DescIdx.h"
-#include "gameData/MaxPlayers.h"
 #include <array>
+#include <functional>
 #include <list>
 #include <memory>
 #include <vector>
@@ -22,6 +22,7 @@ struct TerrainDesc;
 struct WorldDescription;
 
 /// Eigenschaften von einem Punkt auf der Map
+/// The FoW state per player is stored separately in the World, see World::GetFoWNode
 struct MapNode
 {
     /// Roads from this point: E, SE, SW
@@ -41,8 +42,6 @@ struct MapNode
     unsigned char owner;
     BoundaryStones boundary_stones;
     BuildingQuality bq;
-    /// How the players see the point in FoW
-    std::array<FoWNode, MAX_PLAYERS> fow;
 
     /// To which sea this belongs to (0=None)
     unsigned short seaId;
@@ -59,7 +58,11 @@ struct MapNode
     MapNode(MapNode&&) = default;
     MapNode& operator=(const MapNode&) = delete;
     MapNode& operator=(MapNode&&) = default;
-    void Serialize(SerializedGameData& sgd, unsigned numPlayers, const WorldDescription& desc) const;
-    void Deserialize(SerializedGameData& sgd, unsigned numPlayers, const WorldDescription& desc,
-                     const std::vector<DescIdx<TerrainDesc>>& landscapeTerrains);
+    /// Serialize the node. serializeFoW is called where the FoW state of all players belongs in the data
+    void Serialize(SerializedGameData& sgd, const WorldDescription& desc,
+                   const std::function<void()>& serializeFoW) const;
+    /// Deserialize the node. deserializeFoW is called where the FoW state of all players belongs in the data
+    void Deserialize(SerializedGameData& sgd, const WorldDescription& desc,
+                     const std::vector<DescIdx<TerrainDesc>>& landscapeTerrains,
+                     const std::function<void()>& deserializeFoW);
 };
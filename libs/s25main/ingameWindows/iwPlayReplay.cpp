@@ -6,6 +6,7 @@
 #include "ListDir.h"
 #include "Loader.h"
 #include "Replay.h"
+#include "ReplayKeyframes.h"
 #include "RttrConfig.h"
 #include "WindowManager.h"
 #include "controls/ctrlTable.h"
@@ -194,6 +195,7 @@ void iwPlayReplay::Msg_MsgBoxResult(const unsigned msgbox_id, const MsgboxResult
         {
             boost::system::error_code ec;
             bfs::remove(replay, ec);
+            bfs::remove(ReplayKeyframes::GetFilePath(replay), ec);
         }
 
         // Tabelle leeren
@@ -209,6 +211,7 @@ void iwPlayReplay::Msg_MsgBoxResult(const unsigned msgbox_id, const MsgboxResult
                 replay.Close();
                 boost::system::error_code ec;
                 bfs::remove(it, ec);
+                bfs::remove(ReplayKeyframes::GetFilePath(it), ec);
             }
         }
 
@@ -218,8 +221,10 @@ void iwPlayReplay::Msg_MsgBoxResult(const unsigned msgbox_id, const MsgboxResult
         auto* table = GetCtrl<ctrlTable>(0);
         if(table->GetSelection())
         {
+            const bfs::path replayPath = table->GetItemText(*table->GetSelection(), 4);
             boost::system::error_code ec;
-            bfs::remove(table->GetItemText(*table->GetSelection(), 4), ec);
+            bfs::remove(replayPath, ec);
+            bfs::remove(ReplayKeyframes::GetFilePath(replayPath), ec);
             PopulateTable();
         }
     }
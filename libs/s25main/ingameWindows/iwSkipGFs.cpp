@@ -4,16 +4,17 @@
 
 #include "iwSkipGFs.h"
 #include "Loader.h"
+#include "WindowManager.h"
 #include "controls/ctrlEdit.h"
+#include "desktops/dskReplaySeek.h"
 #include "network/GameClient.h"
 #include "gameData/const_gui_ids.h"
 #include "s25util/StringConversion.h"
 #include "s25util/colors.h"
 
-iwSkipGFs::iwSkipGFs(GameWorldView& gwv)
+iwSkipGFs::iwSkipGFs()
     : IngameWindow(CGI_SKIPGFS, IngameWindow::posLastOrCenter, Extent(300, 110), _("Skip GameFrames"),
-                   LOADER.GetImageN("resource", 41)),
-      gwv(gwv)
+                   LOADER.GetImageN("resource", 41))
 {
     // Text vor Editfeld
     AddText(0, DrawPoint(50, 36), _("to GameFrame:"), COLOR_YELLOW, FontStyle{}, NormalFont);
@@ -29,7 +30,13 @@ iwSkipGFs::iwSkipGFs(GameWorldView& gwv)
 void iwSkipGFs::SkipGFs()
 {
     int gf = s25util::fromStringClassicDef(GetCtrl<ctrlEdit>(1)->GetText(), 0);
-    GAMECLIENT.SkipGF(gf, gwv);
+    if(gf >= 0 && GAMECLIENT.IsReplayRestartRequired(gf))
+    {
+        const auto replayPath = GAMECLIENT.GetReplayPath();
+        GAMECLIENT.Stop();
+        WINDOWMANAGER.Switch(std::make_unique<dskReplaySeek>(replayPath, gf));
+    } else
+        GAMECLIENT.SkipGF(gf);
 }
 
 void iwSkipGFs::Msg_ButtonClick(const unsigned /*ctrl_id*/)
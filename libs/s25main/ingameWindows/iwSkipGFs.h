@@ -6,16 +6,12 @@
 
 #include "IngameWindow.h"
 
-class GameWorldView;
-
 class iwSkipGFs : public IngameWindow
 {
 public:
-    iwSkipGFs(GameWorldView& gwv);
+    iwSkipGFs();
 
 private:
-    GameWorldView& gwv;
-
     /// Teilt dem GameClient den Wert mit
     void SkipGFs();
 
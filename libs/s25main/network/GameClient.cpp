@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GameClient.h"
+#include "AsyncSavegameWriter.h"
 #include "CreateServerInfo.h"
 #include "EventManager.h"
 #include "Game.h"
@@ -20,6 +21,7 @@
 #include "Savegame.h"
 #include "SerializedGameData.h"
 #include "Settings.h"
+#include "Timer.h"
 #include "ai/AIPlayer.h"
 #include "drivers/VideoDriverWrapper.h"
 #include "factories/AIFactory.h"
@@ -31,15 +33,11 @@
 #include "network/ClientInterface.h"
 #include "network/GameMessages.h"
 #include "network/GameServer.h"
-#include "ogl/FontStyle.h"
 #include "ogl/glArchivItem_Bitmap.h"
-#include "ogl/glFont.h"
 #include "random/Random.h"
 #include "random/randomIO.h"
 #include "world/GameWorld.h"
-#include "world/GameWorldView.h"
 #include "world/MapLoader.h"
-#include "gameTypes/RoadBuildState.h"
 #include "gameData/GameConsts.h"
 #include "libsiedler2/ArchivItem_Map.h"
 #include "libsiedler2/ArchivItem_Map_Header.h"
@@ -51,6 +49,7 @@
 #include "s25util/strFuncs.h"
 #include "s25util/utf8.h"
 #include <boost/filesystem.hpp>
+#include <boost/format.hpp>
 #include <helpers/chronoIO.h>
 #include <memory>
 
@@ -192,7 +191,7 @@ void GameClient::Run()
         if(nwfInfo->isReady())
             OnGameStart();
     } else if(state == ClientState::Game)
-        ExecuteGameFrame();
+        ExecuteDueGameFrames();
 
     // maximal 10 Pakete verschicken
     mainPlayer.sendMsgs(10);
@@ -232,6 +231,7 @@ void GameClient::Stop()
 
     // clear jump target
     skiptogf = 0;
+    replaySkipStartTicks_.reset();
 
     // Consistency check: No game, no lobby remaining
     RTTR_Assert(!game);
@@ -287,8 +287,8 @@ void GameClient::StartGame(const unsigned random_init)
         return;
     }
 
-    // If we have a savegame, start at its first GF, else at 0
-    unsigned startGF = (mapinfo.type == MapType::Savegame) ? mapinfo.savegame->start_gf : 0;
+    // If we have a savegame (or a keyframe of a replay), start at its first GF, else at 0
+    unsigned startGF = mapinfo.savegame ? mapinfo.savegame->start_gf : 0;
     // Create the game
     game =
       std::make_shared<Game>(std::move(gameLobby->getSettings()), startGF,
@@ -369,6 +369,7 @@ void GameClient::GameLoaded()
             }
             if(IsAIBattleModeOn())
                 ToggleHumanAIPlayer(aiBattlePlayers_[GetPlayerId()]);
+            game->SetNumAIThreads(SETTINGS.global.numAIThreads);
         }
         SendNothingNC();
     }
@@ -433,6 +434,12 @@ bool GameClient::OnGameMessage(const GameMessage_Player_List& msg)
         OnError(ClientError::InvalidMessage);
         return true;
     }
+    // We joined a dedicated server with its host password and are responsible for the lobby and the AIs now
+    if(state == ClientState::Connect && !IsHost() && msg.playerInfos[GetPlayerId()].isHost)
+    {
+        SetIsHost(true);
+        gameLobby = std::make_shared<GameLobby>(gameLobby->isSavegame(), true, gameLobby->getNumPlayers());
+    }
 
     for(unsigned i = 0; i < gameLobby->getNumPlayers(); ++i)
         gameLobby->getPlayer(i) = msg.playerInfos[i];
@@ -1263,6 +1270,26 @@ bool GameClient::OnGameMessage(const GameMessage_GetAsyncLog& /*msg*/)
     return true;
 }
 
+void GameClient::ExecuteDueGameFrames()
+{
+    // After a slow frame run the GFs that are due back to back instead of one GF per frame, so the GF timing does not
+    // depend on the frame rate. Limit it, so a slow simulation can't prevent drawing
+    constexpr unsigned maxGFsPerCall = 5;
+    for(unsigned i = 0; i < maxGFsPerCall; i++)
+    {
+        const unsigned oldGF = GetGFNumber();
+        ExecuteGameFrame();
+        // Stop if no GF was executed (e.g. paused), when skipping (handled by the GameManager) or the game ended
+        if(state != ClientState::Game || GetGFNumber() == oldGF || skiptogf)
+            break;
+        if(FramesInfo::UsedClock::now() - framesinfo.lastTime < framesinfo.gf_length)
+            break;
+        // Receive the commands for the next NWF first instead of pausing the game for them
+        if(!replayMode && GetGFNumber() == nwfInfo->getNextNWF() && !nwfInfo->isReady())
+            break;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// testet ob ein Netwerkframe abgelaufen ist und führt dann ggf die Befehle aus
 void GameClient::ExecuteGameFrame()
@@ -1349,16 +1376,26 @@ void GameClient::ExecuteGameFrame()
             OnError(ClientError::InvalidMap);
         }
         if(skiptogf == GetGFNumber())
+        {
+            // Stop at the GF jumped to in replays
+            if(replayMode && skiptogf)
+                framesinfo.isPaused = true;
+            if(replaySkipStartTicks_)
+            {
+                const unsigned ticks = VIDEODRIVER.GetTickCount() - *replaySkipStartTicks_;
+                SystemChat((boost::format(_("Jump finished (%1$.3g seconds).")) % (ticks / 1000.0)).str());
+                replaySkipStartTicks_.reset();
+            }
             skiptogf = 0;
+        }
     }
     framesinfo.frameTime = std::chrono::duration_cast<FramesInfo::milliseconds32_t>(currentTime - framesinfo.lastTime);
     // Check remaining time until next GF
     if(framesinfo.frameTime >= framesinfo.gf_length)
     {
         // This can happen, if we don't call this method in intervalls less than gf_length or gf_length has changed
-        // TODO: Run multiple GFs per call.
-        // For now just make sure it is less than gf_length by skipping some simulation time,
-        // until we are only a bit less than 1 GF behind
+        // ExecuteDueGameFrames catches up a few GFs per call. If we are still behind, make sure it is less than
+        // gf_length by skipping some simulation time, until we are only a bit less than 1 GF behind
         // However we allow the simulation to lack behind for a few frames, so if there was a single spike we can still
         // catch up in the next visual frames
         using DurationType = decltype(framesinfo.gf_length);
@@ -1381,24 +1418,53 @@ void GameClient::HandleAutosave()
     if(!SETTINGS.interface.autosave_interval || replayMode)
         return;
 
+    if(autosaveWriter_)
+    {
+        for(const std::string& error : autosaveWriter_->TakeErrors())
+            SystemChat(std::string("Error during saving: ") + error);
+    }
+
     // Alle .... GF
     if(GetGFNumber() % SETTINGS.interface.autosave_interval == 0)
     {
+        if(!autosaveWriter_)
+            autosaveWriter_ = std::make_unique<AsyncSavegameWriter>();
+        else if(autosaveWriter_->IsBusy())
+        {
+            LOG.write("Autosave at GF %1% skipped as the previous one is still being written\n") % GetGFNumber();
+            return;
+        }
+
         std::string filename;
         if(mapinfo.title.empty())
             filename = std::string(_("Auto-Save")) + ".sav";
         else
             filename = mapinfo.title + " (" + _("Auto-Save") + ").sav";
 
-        SaveToFile(RTTRCONFIG.ExpandPath(s25::folders::save) / filename);
+        mainPlayer.sendMsg(GameMessage_Chat(GetPlayerId(), ChatDestination::System, "Saving game..."));
+
+        // Only the snapshot is taken in the game thread, compressing and writing is done in the background
+        const Timer timer(true);
+        auto save = std::make_unique<Savegame>();
+        save->compressionLevel = CompressionLevel::Fast;
+        try
+        {
+            FillSavegame(*save);
+        } catch(std::exception& e)
+        {
+            SystemChat(std::string("Error during saving: ") + e.what());
+            return;
+        }
+        autosaveWriter_->Write(std::move(save), RTTRCONFIG.ExpandPath(s25::folders::save) / filename, mapinfo.title);
+        LOG.writeToFile("Autosave at GF %1%: Game paused for %2%\n") % GetGFNumber()
+          % helpers::withUnit(std::chrono::duration_cast<std::chrono::milliseconds>(timer.getElapsed()));
     }
 }
 
 /// Führt notwendige Dinge für nächsten GF aus
 void GameClient::NextGF(bool wasNWF)
 {
-    for(AIPlayer& ai : game->aiPlayers_)
-        ai.RunGF(GetGFNumber(), wasNWF);
+    game->RunAIs(GetGFNumber(), wasNWF);
     game->RunGF();
 }
 
@@ -1435,6 +1501,12 @@ void GameClient::OnGameStart()
     {
         framesinfo.isPaused = replayMode;
         game->Start(!!mapinfo.savegame);
+        // Run up to the GF the replay was started at
+        if(replayMode && replayinfo->targetGF > GetGFNumber())
+        {
+            skiptogf = replayinfo->targetGF;
+            framesinfo.isPaused = false;
+        }
     }
 }
 
@@ -1454,7 +1526,7 @@ void GameClient::StartReplayRecording(const unsigned random_init)
     }
 }
 
-bool GameClient::StartReplay(const boost::filesystem::path& path)
+bool GameClient::StartReplay(const boost::filesystem::path& path, const unsigned startGF)
 {
     RTTR_Assert(state == ClientState::Stopped);
     mapinfo.Clear();
@@ -1470,6 +1542,21 @@ bool GameClient::StartReplay(const boost::filesystem::path& path)
     }
     replayinfo->filename = path.filename();
 
+    // Keyframes are optional, so just continue without them
+    const ReplayKeyframes::Keyframe* keyframe = nullptr;
+    if(replayinfo->keyframes.Load(ReplayKeyframes::GetFilePath(path), replayinfo->replay) && startGF > 0)
+    {
+        keyframe = replayinfo->keyframes.Find(startGF);
+        auto savegame = std::make_unique<Savegame>();
+        if(keyframe && replayinfo->keyframes.LoadSavegame(*keyframe, *savegame))
+            mapinfo.savegame = std::move(savegame);
+        else if(keyframe)
+        {
+            LOG.write(_("Failed to load keyframe of replay: %1%\n")) % replayinfo->keyframes.GetLastErrorMsg();
+            keyframe = nullptr;
+        }
+    }
+
     gameLobby = std::make_shared<GameLobby>(true, true, replayinfo->replay.GetNumPlayers());
 
     for(unsigned i = 0; i < replayinfo->replay.GetNumPlayers(); ++i)
@@ -1544,7 +1631,14 @@ bool GameClient::StartReplay(const boost::filesystem::path& path)
         return false;
     }
 
+    if(keyframe)
+    {
+        // Continue with the state of the original game at the keyframe
+        RANDOM.ResetState(keyframe->rngState);
+        replayinfo->replay.SeekToCommand(keyframe->commandPos);
+    }
     replayinfo->next_gf = replayinfo->replay.ReadGF();
+    replayinfo->targetGF = startGF;
 
     return true;
 }
@@ -1605,52 +1699,51 @@ void GameClient::ServerLost()
  *
  *  @param[in] dest_gf Zielgameframe
  */
-void GameClient::SkipGF(unsigned gf, GameWorldView& gwv)
+void GameClient::SkipGF(unsigned gf)
 {
     if(gf <= GetGFNumber())
         return;
 
-    unsigned start_ticks = VIDEODRIVER.GetTickCount();
-
+    // unpause before skipping
+    SetPause(false);
     if(!replayMode)
     {
-        // unpause before skipping
-        SetPause(false);
         mainPlayer.sendMsgAsync(new GameMessage_SkipToGF(gf));
         return;
     }
 
-    SetPause(false);
+    // The replay is paused again when the GF is reached
     skiptogf = gf;
+    replaySkipStartTicks_ = VIDEODRIVER.GetTickCount();
+}
 
-    // GFs überspringen
-    for(unsigned i = GetGFNumber(); i < skiptogf; ++i)
+void GameClient::ExecuteSkippedGFs(const FramesInfo::UsedClock::time_point deadline)
+{
+    // All commands are in the replay, so there are no messages to wait for
+    RTTR_Assert(replayMode);
+    while(state == ClientState::Game && skiptogf > GetGFNumber() && !framesinfo.isPaused
+          && FramesInfo::UsedClock::now() < deadline)
     {
-        if(i % 1000 == 0)
-        {
-            RoadBuildState road;
-            road.mode = RoadBuildMode::Disabled;
-
-            // spiel aktualisieren
-            gwv.Draw(road, MapPoint::Invalid(), false);
-
-            // text oben noch hinschreiben
-            boost::format nwfString(_("current GF: %u - still fast forwarding: %d GFs left (%d %%)"));
-            nwfString % GetGFNumber() % (gf - i) % (i * 100 / gf);
-            LargeFont->Draw(DrawPoint(VIDEODRIVER.GetRenderSize() / 2u), nwfString.str(), FontStyle::CENTER,
-                            COLOR_YELLOW);
-
-            VIDEODRIVER.SwapBuffers();
-        }
         ExecuteGameFrame();
     }
+}
 
-    // Spiel pausieren & text ausgabe wie lang das jetzt gedauert hat
-    unsigned ticks = VIDEODRIVER.GetTickCount() - start_ticks;
-    boost::format text(_("Jump finished (%1$.3g seconds)."));
-    text % (ticks / 1000.0);
-    SystemChat(text.str());
-    SetPause(true);
+bool GameClient::IsReplayRestartRequired(const unsigned gf) const
+{
+    if(!replayMode || !replayinfo)
+        return false;
+    const unsigned curGF = GetGFNumber();
+    if(gf < curGF)
+        return true;
+    // Loading the game takes a while, so only do it when it saves simulating a lot of GFs
+    constexpr unsigned minSkippedGFs = 5000;
+    const ReplayKeyframes::Keyframe* keyframe = replayinfo->keyframes.Find(gf);
+    return keyframe && keyframe->gf > curGF + minSkippedGFs;
+}
+
+boost::filesystem::path GameClient::GetReplayPath() const
+{
+    return replayinfo ? replayinfo->replay.GetPath() : boost::filesystem::path();
 }
 
 void GameClient::SystemChat(const std::string& text)
@@ -1675,7 +1768,20 @@ bool GameClient::SaveToFile(const boost::filesystem::path& filepath)
     VIDEODRIVER.SwapBuffers();
 
     Savegame save;
+    try
+    {
+        FillSavegame(save);
+        // Und alles speichern
+        return save.Save(filepath, mapinfo.title);
+    } catch(std::exception& e)
+    {
+        SystemChat(std::string("Error during saving: ") + e.what());
+        return false;
+    }
+}
 
+void GameClient::FillSavegame(Savegame& save)
+{
     WritePlayerInfo(save);
 
     // GGS-Daten
@@ -1686,17 +1792,8 @@ bool GameClient::SaveToFile(const boost::filesystem::path& filepath)
     // Enable/Disable debugging of savegames
     save.sgd.debugMode = SETTINGS.global.debugMode;
 
-    try
-    {
-        // Spiel serialisieren
-        save.sgd.MakeSnapshot(*game);
-        // Und alles speichern
-        return save.Save(filepath, mapinfo.title);
-    } catch(std::exception& e)
-    {
-        SystemChat(std::string("Error during saving: ") + e.what());
-        return false;
-    }
+    // Spiel serialisieren
+    save.sgd.MakeSnapshot(*game);
 }
 
 void GameClient::ResetVisualSettings()
@@ -1769,7 +1866,7 @@ GamePlayer& GameClient::GetPlayer(const unsigned id)
 
 std::unique_ptr<AIPlayer> GameClient::CreateAIPlayer(unsigned playerId, const AI::Info& aiInfo)
 {
-    return AIFactory::Create(aiInfo, playerId, game->world_);
+    return AIFactory::Create(aiInfo, playerId, game->world_, &game->GetAIResourceValueCache());
 }
 
 /// Wandelt eine GF-Angabe in eine Zeitangabe um (HH:MM:SS oder MM:SS wenn Stunden = 0)
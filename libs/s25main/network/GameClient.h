@@ -20,6 +20,7 @@
 #include "gameTypes/TeamTypes.h"
 #include "gameTypes/VisualSettings.h"
 #include "s25util/Singleton.h"
+#include <boost/optional.hpp>
 #include <memory>
 #include <vector>
 
@@ -28,15 +29,16 @@ struct Info;
 }
 
 class AIPlayer;
+class AsyncSavegameWriter;
 class ClientInterface;
 class Game;
 class GameEvent;
 class GameLobby;
 class GamePlayer;
-class GameWorldView;
 class NWFInfo;
 class Replay;
 class SavedFile;
+class Savegame;
 enum class ConnectState;
 struct CreateServerInfo;
 struct PlayerGameCommands;
@@ -131,7 +133,8 @@ public:
     void DecreaseSpeed();
 
     /// Lädt ein Replay und startet dementsprechend das Spiel
-    bool StartReplay(const boost::filesystem::path& path);
+    /// If startGF is set the game is loaded from the last keyframe before it (if any) and run up to that GF
+    bool StartReplay(const boost::filesystem::path& path, unsigned startGF = 0);
 
     /// When a non-empty vector is given then an AI battle with the given AIs is started
     void SetAIBattlePlayers(std::vector<AI::Info> aiInfos);
@@ -157,7 +160,15 @@ public:
     /// Is tournament mode activated (0 if not)? Returns the durations of the tournament mode in gf otherwise
     unsigned GetTournamentModeDuration() const;
 
-    void SkipGF(unsigned gf, GameWorldView& gwv);
+    /// Jump to the GF. The GFs are executed by the main loop in batches, see GameManager
+    void SkipGF(unsigned gf);
+    /// Execute GFs of the replay until the skip target or the deadline is reached
+    void ExecuteSkippedGFs(FramesInfo::UsedClock::time_point deadline);
+    /// Return true if the replay needs to be restarted to get to the GF, i.e. when it is before the current GF or a
+    /// keyframe allows to skip many GFs
+    bool IsReplayRestartRequired(unsigned gf) const;
+    /// Path of the replay currently played
+    boost::filesystem::path GetReplayPath() const;
 
     /// Changes the player ingame (for replay or debugging)
     void ChangePlayerIngame(unsigned char playerId1, unsigned char playerId2);
@@ -189,6 +200,8 @@ private:
     /// Liefert einen Player zurück
     GamePlayer& GetPlayer(unsigned id);
 
+    /// Execute all GFs that are due, up to a limit
+    void ExecuteDueGameFrames();
     /// Versucht einen neuen GameFrame auszuführen, falls die Zeit dafür gekommen ist
     void ExecuteGameFrame();
     void ExecuteGameFrame_Replay();
@@ -203,6 +216,8 @@ private:
     void NextGF(bool wasNWF);
     /// Checks if its time for autosaving (if enabled) and does it
     void HandleAutosave();
+    /// Fill the savegame with the players, settings and a snapshot of the current game
+    void FillSavegame(Savegame& save);
 
     //  Netzwerknachrichten
     RTTR_IGNORE_OVERLOADED_VIRTUAL
@@ -273,6 +288,8 @@ public:
     unsigned skiptogf;
 
 private:
+    /// Start of the jump requested by SkipGF in a replay (ticks)
+    boost::optional<unsigned> replaySkipStartTicks_;
     NetworkPlayer mainPlayer;
 
     ClientState state;
@@ -311,6 +328,9 @@ private:
     std::unique_ptr<ReplayInfo> replayinfo;
     bool replayMode;
 
+    /// Writes the autosaves in the background
+    std::unique_ptr<AsyncSavegameWriter> autosaveWriter_;
+
     /// Configured players for an AI battle.
     std::vector<AI::Info> aiBattlePlayers_;
 };
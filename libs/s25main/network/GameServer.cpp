@@ -101,7 +101,10 @@ bool GameServer::CountDown::Update()
 
 ///////////////////////////////////////////////////////////////////////////////
 //
-GameServer::GameServer() : skiptogf(0), state(ServerState::Stopped), currentGF(0), lanAnnouncer(LAN_DISCOVERY_CFG) {}
+GameServer::GameServer()
+    : skiptogf(0), autoStart_(false), autoStartCountdown_(0), state(ServerState::Stopped), currentGF(0),
+      lanAnnouncer(LAN_DISCOVERY_CFG)
+{}
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -225,6 +228,45 @@ bool GameServer::Start(const CreateServerInfo& csi, const MapDescription& map, c
     return true;
 }
 
+bool GameServer::SetGGS(const GlobalGameSettings& ggs)
+{
+    if(state != ServerState::Config || mapinfo.type == MapType::Savegame)
+        return false;
+    ggs_ = ggs;
+    SendToAll(GameMessage_GGSChange(ggs_));
+    CancelCountdown();
+    return true;
+}
+
+bool GameServer::SetAIPlayer(unsigned playerIdx, const AI::Info& aiInfo)
+{
+    if(state != ServerState::Config || playerIdx >= playerInfos.size()
+       || playerInfos[playerIdx].ps != PlayerState::Free)
+        return false;
+    JoinPlayerInfo& player = playerInfos[playerIdx];
+    player.ps = PlayerState::AI;
+    player.aiInfo = aiInfo;
+    player.isReady = true;
+    player.SetAIName(playerIdx);
+    CheckAndSetColor(playerIdx, player.color);
+    SendToAll(GameMessage_Player_State(playerIdx, player.ps, player.aiInfo));
+    SendToAll(GameMessage_Player_Name(playerIdx, player.name));
+    PlayerDataChanged(playerIdx);
+    AnnounceStatusChange();
+    return true;
+}
+
+void GameServer::SetAutoStart(bool autoStart, unsigned countdownSecs)
+{
+    autoStart_ = autoStart;
+    autoStartCountdown_ = countdownSecs;
+}
+
+bool GameServer::HasAIPlayers() const
+{
+    return helpers::contains_if(playerInfos, [](const JoinPlayerInfo& player) { return player.ps == PlayerState::AI; });
+}
+
 unsigned GameServer::GetNumFilledSlots() const
 {
     unsigned numFilled = 0;
@@ -312,12 +354,25 @@ void GameServer::Run()
     }
     helpers::erase_if(networkPlayers, [](const auto& player) { return !player.socket.isValid(); });
 
+    // Everyone left the running game -> Nothing more to do
+    if((state == ServerState::Loading || state == ServerState::Game) && networkPlayers.empty())
+    {
+        LOG.write("SERVER: All players left the game\n");
+        Stop();
+        return;
+    }
+
     lanAnnouncer.Run();
 }
 
 void GameServer::RunStateConfig()
 {
     WaitForClients();
+    if(autoStart_ && !countdown.IsActive() && !networkPlayers.empty() && !HasHost() && ArePlayersReady())
+    {
+        SendToAll(GameMessage_Player_List(playerInfos));
+        StartCountdown(autoStartCountdown_);
+    }
     if(countdown.IsActive() && countdown.Update())
     {
         // nun echt starten
@@ -629,6 +684,7 @@ void GameServer::KickPlayer(uint8_t playerId, KickReason cause, uint32_t param)
     if(!playerInfo.isUsed())
         return;
     playerInfo.ps = PlayerState::Free;
+    playerInfo.isHost = false;
 
     SendToAll(GameMessage_Player_Kicked(playerId, cause, param));
 
@@ -949,7 +1005,8 @@ bool GameServer::OnGameMessage(const GameMessage_Server_Password& msg)
         return true;
 
     std::string passwordok = (config.password == msg.password ? "true" : "false");
-    if(msg.password == config.hostPassword)
+    // There can only be 1 host as it runs the AIs. An empty host password would make everyone the host
+    if(!config.hostPassword.empty() && msg.password == config.hostPassword && !HasHost())
     {
         passwordok = "true";
         playerInfos[msg.senderPlayerID].isHost = true;
@@ -1381,11 +1438,8 @@ bool GameServer::OnGameMessage(const GameMessage_Countdown& msg)
         SendToAll(GameMessage_Player_List(playerInfos));
         // Start countdown (except its single player)
         if(networkPlayers.size() > 1)
-        {
-            countdown.Start(msg.countdown);
-            SendToAll(GameMessage_Countdown(countdown.GetRemainingSecs()));
-            LOG.writeToFile("SERVER >>> Countdown started(%d)\n") % countdown.GetRemainingSecs();
-        } else if(!StartGame())
+            StartCountdown(msg.countdown);
+        else if(!StartGame())
             Stop();
     }
 
@@ -1434,6 +1488,13 @@ bool GameServer::OnGameMessage(const GameMessage_GGSChange& msg)
     return true;
 }
 
+void GameServer::StartCountdown(unsigned countdownSecs)
+{
+    countdown.Start(countdownSecs);
+    SendToAll(GameMessage_Countdown(countdown.GetRemainingSecs()));
+    LOG.writeToFile("SERVER >>> Countdown started(%d)\n") % countdown.GetRemainingSecs();
+}
+
 void GameServer::CancelCountdown()
 {
     if(!countdown.IsActive())
@@ -1740,6 +1801,11 @@ bool GameServer::IsHost(unsigned playerIdx) const
     return playerIdx < playerInfos.size() && playerInfos[playerIdx].isHost;
 }
 
+bool GameServer::HasHost() const
+{
+    return helpers::contains_if(playerInfos, [](const JoinPlayerInfo& player) { return player.isHost; });
+}
+
 int GameServer::GetTargetPlayer(const GameMessageWithPlayer& msg)
 {
     if(msg.player != 0xFF)
@@ -42,6 +42,16 @@ public:
     bool Start(const CreateServerInfo& csi, const MapDescription& map, const std::string& hostPw);
 
     void Run();
+    bool IsRunning() const { return state != ServerState::Stopped; }
+
+    /// Replace the settings of the game. Only possible while in config state (e.g. for a dedicated server)
+    bool SetGGS(const GlobalGameSettings& ggs);
+    /// Put an AI on a free slot. Only possible while in config state
+    bool SetAIPlayer(unsigned playerIdx, const AI::Info& aiInfo);
+    /// Start the countdown automatically when all players are ready and no host is connected
+    void SetAutoStart(bool autoStart, unsigned countdownSecs = 5);
+    /// Return true if any slot is used by an AI, e.g. set via SetAIPlayer or from a savegame
+    bool HasAIPlayers() const;
 
     void RunStateGame();
 
@@ -106,6 +116,7 @@ private:
     bool OnGameMessage(const GameMessage_SkipToGF& msg) override;
     RTTR_POP_DIAGNOSTIC
 
+    void StartCountdown(unsigned countdownSecs);
     void CancelCountdown();
     bool ArePlayersReady() const;
     /// Some player data has changed. Set non-ready and cancel countdown
@@ -129,10 +140,14 @@ private:
 
     /// Is the player with the given idx the host?
     bool IsHost(unsigned playerIdx) const;
+    bool HasHost() const;
     /// Get the player this message concerns. which is msg.player, msg.senderPlayer or -1 on error/wrong values
     int GetTargetPlayer(const GameMessageWithPlayer& msg);
 
     unsigned skiptogf;
+    /// Start the game without a host (dedicated server)
+    bool autoStart_;
+    unsigned autoStartCountdown_;
 
     enum class ServerState
     {
@@ -15,7 +15,6 @@ noRoadNode::noRoadNode(const NodalObjectType nop, const MapPoint pos, const unsi
 {
     for(const auto dir : helpers::EnumRange<Direction>{})
         routes[dir] = nullptr;
-    last_visit = 0;
 }
 
 noRoadNode::~noRoadNode() = default;
@@ -26,6 +25,12 @@ void noRoadNode::Destroy()
     noCoordBase::Destroy();
 }
 
+void noRoadNode::SetRoute(const Direction dir, RoadSegment* route)
+{
+    routes[dir] = route;
+    world->GetPlayer(player).RoadNetworkChanged();
+}
+
 void noRoadNode::Serialize(SerializedGameData& sgd) const
 {
     noCoordBase::Serialize(sgd);
@@ -59,8 +64,6 @@ noRoadNode::noRoadNode(SerializedGameData& sgd, const unsigned obj_id)
     {
         routes[dir] = sgd.PopObject<RoadSegment>(GO_Type::Roadsegment);
     }
-
-    last_visit = 0;
 }
 
 void noRoadNode::UpgradeRoad(const Direction dir) const
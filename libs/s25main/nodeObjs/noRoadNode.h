@@ -23,18 +23,6 @@ private:
     helpers::EnumArray<RoadSegment*, Direction> routes;
 
 public:
-    // For Pathfinding
-    // cost from start
-    mutable unsigned cost; //-V730_NOINIT
-    // distance to target
-    mutable unsigned targetDistance; //-V730_NOINIT
-    // estimated total distance (cost + distance)
-    mutable unsigned estimate; //-V730_NOINIT
-    mutable unsigned last_visit;
-    mutable const noRoadNode* prev; //-V730_NOINIT
-    /// Direction to previous node, includes SHIP_DIR
-    mutable RoadPathDirection dir_; //-V730_NOINIT
-
     noRoadNode(NodalObjectType nop, MapPoint pos, unsigned char player);
     noRoadNode(SerializedGameData& sgd, unsigned obj_id);
     noRoadNode(const noRoadNode&) = delete;
@@ -44,7 +32,8 @@ public:
     void Serialize(SerializedGameData& sgd) const override;
 
     RoadSegment* GetRoute(const Direction dir) const { return routes[dir]; }
-    void SetRoute(const Direction dir, RoadSegment* route) { routes[dir] = route; }
+    /// Set the road in the given direction. Notifies the owner about the changed road network
+    void SetRoute(Direction dir, RoadSegment* route);
     const auto& getRoutes() const { return routes; }
     noRoadNode* GetNeighbour(Direction dir) const;
 
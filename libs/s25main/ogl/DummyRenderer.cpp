@@ -25,6 +25,11 @@ void APIENTRY glVertexPointer(GLint, GLenum, GLsizei, const GLvoid*) {}
 void APIENTRY glTexCoordPointer(GLint, GLenum, GLsizei, const GLvoid*) {}
 void APIENTRY glColor4ub(GLubyte, GLubyte, GLubyte, GLubyte) {}
 void APIENTRY glDrawArrays(GLenum, GLint, GLsizei) {}
+void APIENTRY glEnableClientState(GLenum) {}
+void APIENTRY glDisableClientState(GLenum) {}
+void APIENTRY glColorPointer(GLint, GLenum, GLsizei, const GLvoid*) {}
+void APIENTRY glPushClientAttrib(GLbitfield) {}
+void APIENTRY glPopClientAttrib() {}
 void APIENTRY glGetTexLevelParameteriv(GLenum, GLint, GLenum, GLint* params)
 {
     *params = 1;
@@ -47,6 +52,11 @@ bool DummyRenderer::initOpenGL(OpenGL_Loader_Proc)
     MOCK(glTexCoordPointer);
     MOCK(glColor4ub);
     MOCK(glDrawArrays);
+    MOCK(glEnableClientState);
+    MOCK(glDisableClientState);
+    MOCK(glColorPointer);
+    MOCK(glPushClientAttrib);
+    MOCK(glPopClientAttrib);
     MOCK(glGetTexLevelParameteriv);
     return true;
 }
@@ -4,6 +4,7 @@
 
 #include "OpenGLRenderer.h"
 #include "DrawPoint.h"
+#include "SpriteBatch.h"
 #include "drivers/VideoDriverWrapper.h"
 #include "glArchivItem_Bitmap.h"
 #include "openglCfg.hpp"
@@ -38,6 +39,7 @@ void OpenGLRenderer::Draw3DBorder(const Rect& rect, bool elevated, glArchivItem_
     texture.DrawPart(Rect(vertImgBorderPos, Extent(2, rectSize.y)));
 
     // Draw black borders over the img borders
+    VIDEODRIVER.GetSpriteBatch().Flush();
     glDisable(GL_TEXTURE_2D);
     glColor3f(0.0f, 0.0f, 0.0f);
     glBegin(GL_TRIANGLE_STRIP);
@@ -63,6 +65,7 @@ void OpenGLRenderer::Draw3DBorder(const Rect& rect, bool elevated, glArchivItem_
         glVertex2i(lbPt.x - 1, origin.y + 2);
     }
     glEnd();
+    VIDEODRIVER.CountDrawCall();
     glEnable(GL_TEXTURE_2D);
 }
 
@@ -71,6 +74,8 @@ void OpenGLRenderer::Draw3DContent(const Rect& rect, bool elevated, glArchivItem
 {
     if(illuminated)
     {
+        // The texture environment applies to all pending sprites
+        VIDEODRIVER.GetSpriteBatch().Flush();
         // Modulate2x anmachen
         glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
         glTexEnvf(GL_TEXTURE_ENV, GL_RGB_SCALE, 2.0f);
@@ -86,6 +91,7 @@ void OpenGLRenderer::Draw3DContent(const Rect& rect, bool elevated, glArchivItem
 
     if(illuminated)
     {
+        VIDEODRIVER.GetSpriteBatch().Flush();
         // Modulate2x wieder ausmachen
         glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
     }
@@ -93,6 +99,7 @@ void OpenGLRenderer::Draw3DContent(const Rect& rect, bool elevated, glArchivItem
 
 void OpenGLRenderer::DrawRect(const Rect& rect, unsigned color)
 {
+    VIDEODRIVER.GetSpriteBatch().Flush();
     glDisable(GL_TEXTURE_2D);
 
     glColor4ub(GetRed(color), GetGreen(color), GetBlue(color), GetAlpha(color));
@@ -103,12 +110,14 @@ void OpenGLRenderer::DrawRect(const Rect& rect, unsigned color)
     glVertex2i(rect.right, rect.bottom);
     glVertex2i(rect.right, rect.top);
     glEnd();
+    VIDEODRIVER.CountDrawCall();
 
     glEnable(GL_TEXTURE_2D);
 }
 
 void OpenGLRenderer::DrawLine(DrawPoint pt1, DrawPoint pt2, unsigned width, unsigned color)
 {
+    VIDEODRIVER.GetSpriteBatch().Flush();
     glDisable(GL_TEXTURE_2D);
     glColor4ub(GetRed(color), GetGreen(color), GetBlue(color), GetAlpha(color));
 
@@ -117,6 +126,7 @@ void OpenGLRenderer::DrawLine(DrawPoint pt1, DrawPoint pt2, unsigned width, unsi
     glVertex2i(pt1.x, pt1.y);
     glVertex2i(pt2.x, pt2.y);
     glEnd();
+    VIDEODRIVER.CountDrawCall();
 
     glEnable(GL_TEXTURE_2D);
 }
@@ -0,0 +1,66 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "SpriteBatch.h"
+#include "RTTR_Assert.h"
+#include "drivers/VideoDriverWrapper.h"
+#include "s25util/colors.h"
+#include <glad/glad.h>
+#include <cstddef>
+
+SpriteBatch::SpriteBatch() : isActive_(false), isFlushing_(false), texture_(0)
+{
+    // Enough for the sprites of a zoomed out view to avoid reallocations in the first frames
+    vertices_.reserve(4 * 4096);
+}
+
+void SpriteBatch::Begin()
+{
+    RTTR_Assert(!isActive_);
+    isActive_ = true;
+}
+
+void SpriteBatch::End()
+{
+    RTTR_Assert(isActive_);
+    Flush();
+    isActive_ = false;
+}
+
+void SpriteBatch::AddQuad(unsigned texture, const PointF* vertices, const PointF* texCoords, unsigned color)
+{
+    RTTR_Assert(isActive_);
+    if(texture != texture_)
+    {
+        Flush();
+        texture_ = texture;
+    }
+    const std::array<uint8_t, 4> rgba{
+      {static_cast<uint8_t>(GetRed(color)), static_cast<uint8_t>(GetGreen(color)),
+       static_cast<uint8_t>(GetBlue(color)), static_cast<uint8_t>(GetAlpha(color))}};
+    for(unsigned i = 0; i < 4; i++)
+        vertices_.push_back(Vertex{vertices[i], texCoords[i], rgba});
+}
+
+void SpriteBatch::Flush()
+{
+    // Binding the texture below flushes again
+    if(vertices_.empty() || isFlushing_)
+        return;
+    isFlushing_ = true;
+
+    // Someone else may be about to draw with the arrays already set up
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &vertices_[0].pos);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &vertices_[0].texCoord);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), vertices_[0].color.data());
+    VIDEODRIVER.BindTexture(texture_);
+    glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(vertices_.size()));
+    VIDEODRIVER.CountDrawCall();
+    glPopClientAttrib();
+
+    vertices_.clear();
+    isFlushing_ = false;
+}
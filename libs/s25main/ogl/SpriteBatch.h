@@ -0,0 +1,46 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Point.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/// Collects textured quads and draws consecutive quads with the same texture in a single draw call.
+/// As most sprites are packed into few shared textures this merges most of the sprites drawn for the map.
+/// Batching is only done between Begin and End, otherwise the sprites are drawn immediately.
+/// Everything else drawing must flush the batch first to keep the order, which is done by
+/// VideoDriverWrapper::BindTexture and the renderer.
+class SpriteBatch
+{
+public:
+    SpriteBatch();
+
+    void Begin();
+    /// Draw all pending quads and stop batching
+    void End();
+    bool IsActive() const { return isActive_; }
+
+    /// Add a quad with the 4 vertices and texture coordinates in the given color.
+    void AddQuad(unsigned texture, const PointF* vertices, const PointF* texCoords, unsigned color);
+    /// Draw all pending quads
+    void Flush();
+
+    unsigned GetNumPendingQuads() const { return static_cast<unsigned>(vertices_.size() / 4); }
+
+private:
+    struct Vertex
+    {
+        PointF pos;
+        PointF texCoord;
+        std::array<uint8_t, 4> color;
+    };
+
+    bool isActive_;
+    bool isFlushing_;
+    unsigned texture_;
+    std::vector<Vertex> vertices_;
+};
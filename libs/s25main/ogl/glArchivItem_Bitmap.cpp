@@ -5,6 +5,7 @@
 #include "glArchivItem_Bitmap.h"
 #include "Point.h"
 #include "drivers/VideoDriverWrapper.h"
+#include "ogl/SpriteBatch.h"
 #include "libsiedler2/PixelBufferBGRA.h"
 #include <glad/glad.h>
 
@@ -56,11 +57,19 @@ void glArchivItem_Bitmap::Draw(Rect dstArea, Rect srcArea, unsigned color /*= CO
     texCoords[0].y = texCoords[3].y = srcOrig.y;
     texCoords[1].y = texCoords[2].y = srcEndPt.y;
 
+    SpriteBatch& batch = VIDEODRIVER.GetSpriteBatch();
+    if(batch.IsActive())
+    {
+        batch.AddQuad(GetTexture(), vertices.data(), texCoords.data(), color);
+        return;
+    }
+
     glVertexPointer(2, GL_FLOAT, 0, vertices.data());
     glTexCoordPointer(2, GL_FLOAT, 0, texCoords.data());
     VIDEODRIVER.BindTexture(GetTexture());
     glColor4ub(GetRed(color), GetGreen(color), GetBlue(color), GetAlpha(color));
     glDrawArrays(GL_QUADS, 0, 4);
+    VIDEODRIVER.CountDrawCall();
 }
 
 void glArchivItem_Bitmap::DrawFull(const Rect& destArea, unsigned color)
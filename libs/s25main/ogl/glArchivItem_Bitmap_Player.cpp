@@ -6,6 +6,7 @@
 #include "Loader.h"
 #include "Point.h"
 #include "drivers/VideoDriverWrapper.h"
+#include "ogl/SpriteBatch.h"
 #include "libsiedler2/PixelBufferBGRA.h"
 #include <glad/glad.h>
 
@@ -88,6 +89,14 @@ void glArchivItem_Bitmap_Player::Draw(Rect dstArea, Rect srcArea, unsigned color
     texCoords[6].x += 0.5f;
     texCoords[7].x += 0.5f;
 
+    SpriteBatch& batch = VIDEODRIVER.GetSpriteBatch();
+    if(batch.IsActive())
+    {
+        batch.AddQuad(GetTexture(), vertices.data(), texCoords.data(), color);
+        batch.AddQuad(GetTexture(), &vertices[4], &texCoords[4], player_color);
+        return;
+    }
+
     std::array<GL_RGBAColor, 8> colors;
     colors[0].r = GetRed(color);
     colors[0].g = GetGreen(color);
@@ -107,6 +116,7 @@ void glArchivItem_Bitmap_Player::Draw(Rect dstArea, Rect srcArea, unsigned color
     glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors.data());
     VIDEODRIVER.BindTexture(GetTexture());
     glDrawArrays(GL_QUADS, 0, 8);
+    VIDEODRIVER.CountDrawCall();
     glDisableClientState(GL_COLOR_ARRAY);
 }
 
@@ -16,12 +16,27 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/nowide/detail/utf.hpp>
 #include <cmath>
+#include <functional>
 #include <vector>
 
 constexpr bool RTTR_PRINT_FONTS = false;
 namespace utf = boost::nowide::detail::utf;
 using utf8 = utf::utf_traits<char>;
 
+namespace {
+/// Decode the next code point. Most text is ascii, so avoid the full UTF-8 decoder for it
+inline utf::code_point decodeChar(std::string::const_iterator& it, const std::string::const_iterator& end)
+{
+    const auto c = static_cast<unsigned char>(*it);
+    if(c < 0x80)
+    {
+        ++it;
+        return c;
+    }
+    return utf8::decode(it, end);
+}
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 
 glFont::glFont(const libsiedler2::ArchivItem_Font& font) : maxCharSize(font.getDx(), font.getDy()), asciiMapping{}
@@ -131,7 +146,7 @@ void glFont::AddCharInfo(char32_t c, const CharInfo& info)
  */
 inline void glFont::DrawChar(char32_t curChar, VertexArrays& vertices, DrawPoint& curPos) const
 {
-    CharInfo ci = GetCharInfo(curChar);
+    const CharInfo& ci = GetCharInfo(curChar);
 
     GlPoint texCoord1(ci.pos);
     GlPoint texCoord2(ci.pos + DrawPoint(ci.width, maxCharSize.y));
@@ -174,10 +189,84 @@ void glFont::Draw(DrawPoint pos, const std::string& text, FontStyle format, unsi
 {
     RTTR_Assert(s25util::isValidUTF8(text));
 
+    // Get texture first as it might need to be created
+    glArchivItem_Bitmap& usedFont = format.is(FontStyle::NO_OUTLINE) ? *fontNoOutline : *fontWithOutline;
+    unsigned texture = usedFont.GetTexture();
+    if(!texture)
+        return;
+
+    // The end is only relevant if the text can be shortened, so don't make the key depend on it otherwise
+    const TextLayout& layout = GetLayout(
+      LayoutKey{text, maxWidth == 0xFFFF ? std::string() : end, maxWidth, format.is(FontStyle::NO_OUTLINE)}, usedFont);
+    if(layout.quads.vertices.empty())
+        return;
+
+    // Vertical alignment (assumes 1 line only!)
+    if(format.is(FontStyle::BOTTOM))
+        pos.y -= maxCharSize.y;
+    else if(format.is(FontStyle::VCENTER))
+        pos.y -= maxCharSize.y / 2;
+    // Horizontal alignment
+    if(format.is(FontStyle::RIGHT))
+        pos.x -= layout.width;
+    else if(format.is(FontStyle::CENTER))
+        pos.x -= layout.width / 2;
+
+    const GlPoint offset(pos);
+    drawVertices.resize(layout.quads.vertices.size());
+    for(unsigned i = 0; i < drawVertices.size(); i++)
+        drawVertices[i] = layout.quads.vertices[i] + offset;
+
+    glVertexPointer(2, GL_FLOAT, 0, drawVertices.data());
+    glTexCoordPointer(2, GL_FLOAT, 0, layout.quads.texCoords.data());
+    VIDEODRIVER.BindTexture(texture);
+    glColor4ub(GetRed(color), GetGreen(color), GetBlue(color), GetAlpha(color));
+    glDrawArrays(GL_QUADS, 0, drawVertices.size());
+    VIDEODRIVER.CountDrawCall();
+}
+
+size_t glFont::LayoutKeyHash::operator()(const LayoutKey& key) const
+{
+    const std::hash<std::string> strHash;
+    size_t result = strHash(key.text);
+    result = result * 31 + strHash(key.end);
+    result = result * 31 + key.maxWidth;
+    return result * 2 + (key.noOutline ? 1 : 0);
+}
+
+const glFont::TextLayout& glFont::GetLayout(LayoutKey key, const glArchivItem_Bitmap& usedFont) const
+{
+    const auto itIdx = layoutCacheIdx_.find(key);
+    if(itIdx != layoutCacheIdx_.end())
+    {
+        ++layoutCacheStats_.hits;
+        // Move to front as the most recently used one
+        layoutCache_.splice(layoutCache_.begin(), layoutCache_, itIdx->second);
+        return itIdx->second->second;
+    }
+    ++layoutCacheStats_.misses;
+    if(layoutCache_.size() >= maxCachedLayouts)
+    {
+        layoutCacheIdx_.erase(layoutCache_.back().first);
+        layoutCache_.pop_back();
+    }
+    TextLayout layout = CreateLayout(key, usedFont);
+    layoutCache_.emplace_front(std::move(key), std::move(layout));
+    layoutCacheIdx_.emplace(layoutCache_.front().first, layoutCache_.begin());
+    return layoutCache_.front().second;
+}
+
+glFont::TextLayout glFont::CreateLayout(const LayoutKey& key, const glArchivItem_Bitmap& usedFont) const
+{
+    const std::string& text = key.text;
+    const std::string& end = key.end;
+    TextLayout layout;
+    layout.width = 0;
+
     unsigned maxNumChars;
     unsigned short textWidth;
     bool drawEnd;
-    if(maxWidth == 0xFFFF)
+    if(key.maxWidth == 0xFFFF)
     {
         maxNumChars = text.size();
         textWidth = getWidth(text);
@@ -185,14 +274,14 @@ void glFont::Draw(DrawPoint pos, const std::string& text, FontStyle format, unsi
     } else
     {
         RTTR_Assert(s25util::isValidUTF8(end));
-        textWidth = getWidth(text, maxWidth, &maxNumChars);
+        textWidth = getWidth(text, key.maxWidth, &maxNumChars);
         if(!end.empty() && maxNumChars < text.size())
         {
             unsigned short endWidth = getWidth(end);
 
             // If "end" does not fit, draw nothing
             if(textWidth < endWidth)
-                return;
+                return layout;
 
             // Wieviele Buchstaben gehen in den "Rest" (ohne "end")
             textWidth = getWidth(text, textWidth - endWidth, &maxNumChars) + endWidth;
@@ -202,57 +291,26 @@ void glFont::Draw(DrawPoint pos, const std::string& text, FontStyle format, unsi
     }
 
     if(maxNumChars == 0)
-        return;
+        return layout;
+    layout.width = textWidth;
     const auto itEnd = text.cbegin() + maxNumChars;
 
-    // Vertical alignment (assumes 1 line only!)
-    if(format.is(FontStyle::BOTTOM))
-        pos.y -= maxCharSize.y;
-    else if(format.is(FontStyle::VCENTER))
-        pos.y -= maxCharSize.y / 2;
-    // Horizontal alignment
-    if(format.is(FontStyle::RIGHT))
-        pos.x -= textWidth;
-    else if(format.is(FontStyle::CENTER))
-        pos.x -= textWidth / 2;
-
-    texList.texCoords.clear();
-    texList.vertices.clear();
-
-    for(auto it = text.begin(); it != itEnd;)
-    {
-        const utf::code_point curChar = utf8::decode(it, itEnd);
-        DrawChar(curChar, texList, pos);
-    }
+    DrawPoint pos(0, 0);
+    for(auto it = text.cbegin(); it != itEnd;)
+        DrawChar(decodeChar(it, itEnd), layout.quads, pos);
 
     if(drawEnd)
     {
-        for(auto it = end.begin(); it != end.end();)
-        {
-            const utf::code_point curChar = utf8::decode(it, end.end());
-            DrawChar(curChar, texList, pos);
-        }
+        for(auto it = end.cbegin(); it != end.cend();)
+            DrawChar(decodeChar(it, end.cend()), layout.quads, pos);
     }
 
-    if(texList.vertices.empty())
-        return;
-
-    // Get texture first as it might need to be created
-    glArchivItem_Bitmap& usedFont = format.is(FontStyle::NO_OUTLINE) ? *fontNoOutline : *fontWithOutline;
-    unsigned texture = usedFont.GetTexture();
-    if(!texture)
-        return;
     const GlPoint texSize(usedFont.GetTexSize());
-    RTTR_Assert(texList.texCoords.size() == texList.vertices.size());
-    RTTR_Assert(texList.texCoords.size() % 4u == 0);
-    for(GlPoint& pt : texList.texCoords)
+    RTTR_Assert(layout.quads.texCoords.size() == layout.quads.vertices.size());
+    RTTR_Assert(layout.quads.texCoords.size() % 4u == 0);
+    for(GlPoint& pt : layout.quads.texCoords)
         pt /= texSize;
-
-    glVertexPointer(2, GL_FLOAT, 0, &texList.vertices[0]);
-    glTexCoordPointer(2, GL_FLOAT, 0, &texList.texCoords[0]);
-    VIDEODRIVER.BindTexture(texture);
-    glColor4ub(GetRed(color), GetGreen(color), GetBlue(color), GetAlpha(color));
-    glDrawArrays(GL_QUADS, 0, texList.vertices.size());
+    return layout;
 }
 
 template<bool T_limitWidth>
@@ -263,8 +321,7 @@ unsigned glFont::getWidthInternal(const std::string::const_iterator& begin, cons
     for(auto it = begin; it != end;)
     {
         const auto itCurChar = it;
-        const utf::code_point curChar = utf8::decode(it, end);
-        const unsigned cw = CharWidth(curChar);
+        const unsigned cw = CharWidth(decodeChar(it, end));
         // If we limit the width and the text will be longer, stop before it
         // Do not stop if this is the first char
         if(T_limitWidth && curLen != 0 && curLen + cw > maxWidth)
@@ -355,7 +412,7 @@ glFont::WrapInfo glFont::GetWrapInfo(const std::string& text, const unsigned sho
     {
         // Save iterator to current char as we might want to break BEFORE it
         const auto itCurChar = it;
-        const utf::code_point curChar = (it != itEnd) ? utf8::decode(it, itEnd) : 0;
+        const utf::code_point curChar = (it != itEnd) ? decodeChar(it, itEnd) : 0;
         // Word ended
         if(curChar == 0 || curChar == '\n' || curChar == ' ')
         {
@@ -378,7 +435,7 @@ glFont::WrapInfo glFont::GetWrapInfo(const std::string& text, const unsigned sho
                     for(auto itWord = itWordStart; itWord != itCurChar;)
                     {
                         const auto itPotentialBreak = itWord;
-                        const utf::code_point letter_width = CharWidth(utf8::decode(itWord, itEnd));
+                        const utf::code_point letter_width = CharWidth(decodeChar(itWord, itEnd));
 
                         // Can we fit the letter onto current line?
                         if(line_width + letter_width <= curMaxLineWidth)
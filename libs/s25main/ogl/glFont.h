@@ -11,9 +11,12 @@
 #include "s25util/colors.h"
 #include <glad/glad.h>
 #include <array>
+#include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace libsiedler2 {
@@ -67,6 +70,18 @@ public:
     /// liefert die Breite eines Zeichens
     unsigned CharWidth(char32_t c) const { return GetCharInfo(c).width; }
 
+    struct LayoutCacheStats
+    {
+        unsigned hits = 0;
+        unsigned misses = 0;
+    };
+    /// Number of drawn texts found in and missing from the layout cache
+    const LayoutCacheStats& getLayoutCacheStats() const { return layoutCacheStats_; }
+    void resetLayoutCacheStats() { layoutCacheStats_ = LayoutCacheStats(); }
+    unsigned getNumCachedLayouts() const { return static_cast<unsigned>(layoutCache_.size()); }
+    /// Maximum number of layouts kept in the cache
+    static constexpr unsigned maxCachedLayouts = 512;
+
 private:
     struct CharInfo
     {
@@ -82,6 +97,36 @@ private:
         std::vector<GlPoint> vertices;
     };
 
+    /// Parameters of Draw which define the glyph quads of a text
+    struct LayoutKey
+    {
+        std::string text;
+        /// Only used if the text is shortened
+        std::string end;
+        unsigned short maxWidth;
+        bool noOutline;
+
+        bool operator==(const LayoutKey& rhs) const
+        {
+            return maxWidth == rhs.maxWidth && noOutline == rhs.noOutline && text == rhs.text && end == rhs.end;
+        }
+    };
+    struct LayoutKeyHash
+    {
+        size_t operator()(const LayoutKey& key) const;
+    };
+    /// Glyph quads of a text drawn at (0, 0) with texture coordinates already normalized
+    struct TextLayout
+    {
+        VertexArrays quads;
+        unsigned short width;
+    };
+    using LayoutCache = std::list<std::pair<LayoutKey, TextLayout>>;
+
+    /// Get the layout from the cache or create it
+    const TextLayout& GetLayout(LayoutKey key, const glArchivItem_Bitmap& usedFont) const;
+    TextLayout CreateLayout(const LayoutKey& key, const glArchivItem_Bitmap& usedFont) const;
+
     void AddCharInfo(char32_t c, const CharInfo& info);
     /// liefert das Char-Info eines Zeichens
     const CharInfo& GetCharInfo(char32_t c) const;
@@ -95,7 +140,13 @@ private:
     std::array<std::pair<bool, CharInfo>, 256> asciiMapping;
     std::map<char32_t, CharInfo> utf8_mapping;
     CharInfo placeHolder;         /// Placeholder if glyph is missing
-    mutable VertexArrays texList; /// Buffer to hold last textures. Used so memory reallocations are avoided
+    /// Buffer for the vertices of the last text moved to its position. Used so memory reallocations are avoided
+    mutable std::vector<GlPoint> drawVertices;
+
+    /// Layouts of the last drawn texts, most recently used first. Most texts are drawn unchanged for many frames
+    mutable LayoutCache layoutCache_;
+    mutable std::unordered_map<LayoutKey, LayoutCache::iterator, LayoutKeyHash> layoutCacheIdx_;
+    mutable LayoutCacheStats layoutCacheStats_;
 
     /// Get width of the sequence defined by the begin/end pair of iterators
     template<bool T_unlimitedWidth>
@@ -5,6 +5,7 @@
 #include "glSmartBitmap.h"
 #include "Loader.h"
 #include "drivers/VideoDriverWrapper.h"
+#include "ogl/SpriteBatch.h"
 #include "ogl/glBitmapItem.h"
 #include "libsiedler2/ArchivItem_Bitmap.h"
 #include "libsiedler2/ArchivItem_Bitmap_Player.h"
@@ -283,6 +284,22 @@ void glSmartBitmap::drawPercent(DrawPoint drawPt, unsigned percent, unsigned col
     curTexCoords[3] = texCoords[3];
     curTexCoords[0].y = curTexCoords[3].y = curTexCoords[1].y - (curTexCoords[1].y - curTexCoords[0].y) * partDrawn;
 
+    SpriteBatch& batch = VIDEODRIVER.GetSpriteBatch();
+    if(batch.IsActive())
+    {
+        batch.AddQuad(texture, vertices.data(), curTexCoords.data(), color);
+        if(player_color && hasPlayer)
+        {
+            curTexCoords[4] = texCoords[4];
+            curTexCoords[5] = texCoords[5];
+            curTexCoords[6] = texCoords[6];
+            curTexCoords[7] = texCoords[7];
+            curTexCoords[4].y = curTexCoords[7].y = curTexCoords[0].y;
+            batch.AddQuad(texture, vertices.data(), &curTexCoords[4], player_color);
+        }
+        return;
+    }
+
     int numQuads;
     if(player_color && hasPlayer)
     {
@@ -310,5 +327,6 @@ void glSmartBitmap::drawPercent(DrawPoint drawPt, unsigned percent, unsigned col
     glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors.data());
     VIDEODRIVER.BindTexture(texture);
     glDrawArrays(GL_QUADS, 0, numQuads);
+    VIDEODRIVER.CountDrawCall();
     glDisableClientState(GL_COLOR_ARRAY);
 }
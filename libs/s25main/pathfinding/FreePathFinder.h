@@ -5,25 +5,47 @@
 #pragma once
 
 #include "gameTypes/Direction.h"
+#include "pathfinding/NewNode.h"
+#include "pathfinding/OpenListBinaryHeap.h"
 #include "gameTypes/MapCoordinates.h"
+#include <limits>
 #include <vector>
 
 class GameWorldBase;
 
 using FP_Node_OK_Callback = bool (*)(const GameWorldBase&, const MapPoint, const Direction, const void*);
 
+struct GetEstimatedDistance
+{
+    unsigned operator()(const FreePathNode& lhs) const { return lhs.estimatedDistance; }
+};
+
 // There are 2 callback types:
 // IsNodeToDestOk: Called for every point to check if this node is usable
 // IsNodeOk: Additionally called for every point but the destination
 
+/// Stores the search state per instance, so threads (e.g. the AIs) can search in parallel using their own path finders
 class FreePathFinder
 {
-    GameWorldBase& gwb_;
+    const GameWorldBase& gwb_;
     unsigned currentVisit;
     Extent size_;
+    /// Nodes of the map for the alternating conditions pathfinding
+    std::vector<NewNode> nodes_;
+    /// Nodes of the map for the regular pathfinding
+    std::vector<FreePathNode> fpNodes_;
+    /// Open list of the regular pathfinding. Reused so searches don't allocate.
+    /// Note: The arity determines which of equally long paths is found, so changing it breaks replay compatibility
+    OpenListBinaryHeap<FreePathNode, GetEstimatedDistance> todo_;
+    /// Queue and sorted target indices of FindPathLengths
+    std::vector<FreePathNode*> bfsQueue_;
+    std::vector<unsigned> targetIdxs_;
 
 public:
-    FreePathFinder(GameWorldBase& gwb) : gwb_(gwb), currentVisit(0), size_(0, 0) {}
+    /// Length returned by FindPathLengths for targets without a path
+    static constexpr unsigned unreachable = std::numeric_limits<unsigned>::max();
+
+    FreePathFinder(const GameWorldBase& gwb) : gwb_(gwb), currentVisit(0), size_(0, 0) {}
     void Init(const MapExtent& mapSize);
 
     /// Wegfindung in freiem Terrain - Template version. Users need to include FreePathFinderImpl.h
@@ -33,6 +55,14 @@ public:
     bool FindPath(MapPoint start, MapPoint dest, bool randomRoute, unsigned maxLength, std::vector<Direction>* route,
                   unsigned* length, Direction* firstDir, const TNodeChecker& nodeChecker);
 
+    /// Find the lengths of the shortest paths from start to each of the targets using a single breadth first search.
+    /// The result for each target (in the same order) is the same length FindPath would find or unreachable.
+    /// The search stops when all targets are found. If maxHits is set it stops when that many targets are found and
+    /// only the closest are returned (equally distant ones in the order of targets).
+    template<class TNodeChecker>
+    std::vector<unsigned> FindPathLengths(MapPoint start, const std::vector<MapPoint>& targets, unsigned maxLength,
+                                          const TNodeChecker& nodeChecker, unsigned maxHits = unreachable);
+
     bool FindPathAlternatingConditions(MapPoint start, MapPoint dest, bool randomRoute, unsigned maxLength,
                                        std::vector<Direction>* route, unsigned* length, Direction* firstDir,
                                        FP_Node_OK_Callback IsNodeOK, FP_Node_OK_Callback IsNodeOKAlternate,
@@ -5,15 +5,15 @@
 #pragma once
 
 #include "EventManager.h"
+#include "helpers/EnumRange.h"
 #include "pathfinding/FreePathFinder.h"
 #include "pathfinding/NewNode.h"
 #include "pathfinding/OpenListBinaryHeap.h"
 #include "pathfinding/OpenListPrioQueue.h"
 #include "pathfinding/PathfindingPoint.h"
 #include "world/GameWorldBase.h"
-
-using FreePathNodes = std::vector<FreePathNode>;
-extern FreePathNodes fpNodes;
+#include <algorithm>
+#include <numeric>
 
 struct NodePtrCmpGreater
 {
@@ -29,14 +29,6 @@ struct NodePtrCmpGreater
     }
 };
 
-struct GetEstimatedDistance
-{
-    unsigned operator()(const FreePathNode& lhs) const { return lhs.estimatedDistance; }
-};
-
-// using QueueImpl = OpenListPrioQueue<NewNode2*, NodePtrCmpGreater>;
-using QueueImpl = OpenListBinaryHeap<FreePathNode, GetEstimatedDistance>;
-
 template<class TNodeChecker>
 bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool randomRoute, unsigned maxLength,
                               std::vector<Direction>* route, unsigned* length, Direction* firstDir,
@@ -47,11 +39,11 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
     // increase currentVisit, so we don't have to clear the visited-states at every run
     IncreaseCurrentVisit();
 
-    QueueImpl todo;
+    todo_.clear();
     const unsigned startId = gwb_.GetIdx(start);
     const unsigned destId = gwb_.GetIdx(dest);
-    FreePathNode& startNode = fpNodes[startId];
-    FreePathNode& destNode = fpNodes[destId];
+    FreePathNode& startNode = fpNodes_[startId];
+    FreePathNode& destNode = fpNodes_[destId];
 
     // Anfangsknoten einfügen Und mit entsprechenden Werten füllen
     startNode.targetDistance = gwb_.CalcDistance(start, dest);
@@ -60,17 +52,17 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
     startNode.prev = nullptr;
     startNode.curDistance = 0;
 
-    todo.push(&startNode);
+    todo_.push(&startNode);
 
     // Bei Zufälliger Richtung anfangen (damit man nicht immer denselben Weg geht, besonders für die Soldaten wichtig)
     // TODO confirm random: RANDOM.Rand(__FILE__, __LINE__, y_start * GetWidth() + x_start, 6);
     const Direction startDir =
       randomRoute ? convertToDirection(gwb_.GetIdx(start) * gwb_.GetEvMgr().GetCurrentGF()) : Direction::West;
 
-    while(!todo.empty())
+    while(!todo_.empty())
     {
         // Knoten mit den geringsten Wegkosten auswählen
-        FreePathNode& best = *todo.pop();
+        FreePathNode& best = *todo_.pop();
 
         // Ziel schon erreicht?
         if(&best == &destNode)
@@ -112,7 +104,7 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
 
             // ID des umliegenden Knotens bilden
             unsigned nbId = gwb_.GetIdx(neighbourPos);
-            FreePathNode& neighbour = fpNodes[nbId];
+            FreePathNode& neighbour = fpNodes_[nbId];
 
             // Don't try to go back where we came from (would also bail out in the conditions below)
             if(best.prev == &neighbour)
@@ -132,7 +124,7 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
                     neighbour.estimatedDistance = neighbour.curDistance + neighbour.targetDistance;
                     neighbour.prev = &best;
                     neighbour.dir = dir;
-                    todo.rearrange(&neighbour);
+                    todo_.rearrange(&neighbour);
                 }
             } else
             {
@@ -155,7 +147,7 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
                 neighbour.dir = dir;
                 neighbour.prev = &best;
 
-                todo.push(&neighbour);
+                todo_.push(&neighbour);
             }
         }
     }
@@ -164,6 +156,88 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
     return false;
 }
 
+template<class TNodeChecker>
+std::vector<unsigned> FreePathFinder::FindPathLengths(const MapPoint start, const std::vector<MapPoint>& targets,
+                                                      const unsigned maxLength, const TNodeChecker& nodeChecker,
+                                                      const unsigned maxHits)
+{
+    std::vector<unsigned> lengths(targets.size(), unreachable);
+    if(targets.empty() || maxHits == 0)
+        return lengths;
+
+    IncreaseCurrentVisit();
+
+    targetIdxs_.clear();
+    for(const MapPoint pt : targets)
+        targetIdxs_.push_back(gwb_.GetIdx(pt));
+    std::sort(targetIdxs_.begin(), targetIdxs_.end());
+    // Number of targets at the node
+    const auto countTargets = [this](unsigned idx) {
+        const auto range = std::equal_range(targetIdxs_.begin(), targetIdxs_.end(), idx);
+        return static_cast<unsigned>(range.second - range.first);
+    };
+
+    FreePathNode& startNode = fpNodes_[gwb_.GetIdx(start)];
+    startNode.lastVisited = currentVisit;
+    startNode.curDistance = 0;
+    bfsQueue_.clear();
+    bfsQueue_.push_back(&startNode);
+
+    // Stop when enough or all targets are found
+    const unsigned numRequiredHits = std::min<unsigned>(maxHits, targets.size());
+    unsigned numHits = countTargets(gwb_.GetIdx(start));
+    // Nodes up to this distance are visited. Reduced when enough targets are found, but all nodes of that distance
+    // are still visited so the closest targets are known
+    unsigned maxDistance = (numHits >= numRequiredHits) ? 0 : maxLength;
+    // The queue is ordered by distance
+    for(unsigned i = 0; i < bfsQueue_.size() && bfsQueue_[i]->curDistance < maxDistance; i++)
+    {
+        const FreePathNode& cur = *bfsQueue_[i];
+        const auto neighbors = gwb_.GetNeighbours(cur.mapPt);
+        for(const Direction dir : helpers::EnumRange<Direction>{})
+        {
+            const MapPoint neighbourPos = neighbors[dir];
+            const unsigned nbId = gwb_.GetIdx(neighbourPos);
+            FreePathNode& neighbour = fpNodes_[nbId];
+            if(neighbour.lastVisited == currentVisit)
+                continue;
+            // Targets are reached even if they are not passable (like the goal of FindPath) but not passed
+            const bool isNodeOk = nodeChecker.IsNodeOk(neighbourPos);
+            const unsigned numTargets = countTargets(nbId);
+            if((!isNodeOk && numTargets == 0) || !nodeChecker.IsEdgeOk(cur.mapPt, dir))
+                continue;
+            neighbour.lastVisited = currentVisit;
+            neighbour.curDistance = cur.curDistance + 1;
+            if(isNodeOk)
+                bfsQueue_.push_back(&neighbour);
+            if(numTargets > 0 && numHits < numRequiredHits)
+            {
+                numHits += numTargets;
+                if(numHits >= numRequiredHits)
+                    maxDistance = neighbour.curDistance;
+            }
+        }
+    }
+
+    for(unsigned i = 0; i < targets.size(); i++)
+    {
+        const FreePathNode& node = fpNodes_[gwb_.GetIdx(targets[i])];
+        if(node.lastVisited == currentVisit)
+            lengths[i] = node.curDistance;
+    }
+    if(maxHits < targets.size())
+    {
+        // Keep only the closest ones
+        std::vector<unsigned> order(targets.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+                         [&lengths](unsigned lhs, unsigned rhs) { return lengths[lhs] < lengths[rhs]; });
+        for(unsigned i = maxHits; i < order.size(); i++)
+            lengths[order[i]] = unreachable;
+    }
+    return lengths;
+}
+
 /// Ermittelt, ob eine freie Route noch passierbar ist und gibt den Endpunkt der Route zurück
 template<class TNodeChecker>
 bool FreePathFinder::CheckRoute(const MapPoint start, const std::vector<Direction>& route, unsigned pos,
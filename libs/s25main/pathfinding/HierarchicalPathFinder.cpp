@@ -0,0 +1,467 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pathfinding/HierarchicalPathFinder.h"
+#include "RTTR_Assert.h"
+#include "helpers/EnumRange.h"
+#include "pathfinding/FreePathFinder.h"
+#include "pathfinding/FreePathFinderImpl.h"
+#include "pathfinding/PathConditionHuman.h"
+#include "pathfinding/PathConditionShip.h"
+#include "world/GameWorldBase.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace {
+constexpr unsigned noDistance = std::numeric_limits<unsigned>::max();
+/// Runs of adjacent crossings at least this long get an entrance at both ends instead of one in the middle
+constexpr unsigned minLongRunLength = 6;
+
+struct QueueEntry
+{
+    unsigned estimate;
+    unsigned distance;
+    unsigned idx;
+    MapPoint pt;
+
+    /// Order by estimate and use the index as a tie breaker so the result is deterministic
+    bool operator>(const QueueEntry& rhs) const
+    {
+        return estimate > rhs.estimate || (estimate == rhs.estimate && idx > rhs.idx);
+    }
+};
+} // namespace
+
+template<class TNodeChecker>
+HierarchicalPathFinder<TNodeChecker>::HierarchicalPathFinder(const GameWorldBase& gwb, TNodeChecker nodeChecker,
+                                                             unsigned clusterSize)
+    : gwb_(gwb), nodeChecker_(std::move(nodeChecker)), clusterSize_(clusterSize), size_(0, 0), numClusters_(0, 0),
+      hasChangedClusters_(false), currentVisit_(0)
+{
+    RTTR_Assert(clusterSize_ > 1);
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::Init(const MapExtent& mapSize)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_ = mapSize;
+    numClusters_ = MapExtent(static_cast<MapCoord>((size_.x + clusterSize_ - 1) / clusterSize_),
+                             static_cast<MapCoord>((size_.y + clusterSize_ - 1) / clusterSize_));
+    clusters_.clear();
+    clusters_.resize(static_cast<unsigned>(numClusters_.x) * numClusters_.y);
+    hasChangedClusters_ = true;
+    searchNodes_.clear();
+    searchNodes_.resize(static_cast<unsigned>(size_.x) * size_.y);
+    currentVisit_ = 0;
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::MarkChanged(const MapPoint pt)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if(clusters_.empty())
+        return;
+    clusters_[GetClusterIdx(pt)].changed = true;
+    hasChangedClusters_ = true;
+}
+
+template<class TNodeChecker>
+bool HierarchicalPathFinder<TNodeChecker>::FindPath(const MapPoint start, const MapPoint dest, bool randomRoute,
+                                                    unsigned maxLength, std::vector<Direction>* route,
+                                                    unsigned* length, Direction* firstDir)
+{
+    FreePathFinder& freePathFinder = gwb_.GetFreePathFinder();
+    if(maxLength < GetMinDistance() || gwb_.CalcDistance(start, dest) < GetMinDistance())
+        return freePathFinder.FindPath(start, dest, randomRoute, maxLength, route, length, firstDir, nodeChecker_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    UpdateChangedClusters();
+    const auto waypoints = FindAbstractPath(start, dest, maxLength);
+    if(!waypoints.empty() && RefinePath(waypoints, randomRoute, route, length, firstDir))
+        return true;
+    // Not found or the graph does not match the terrain (e.g. for the start/dest)
+    return freePathFinder.FindPath(start, dest, randomRoute, maxLength, route, length, firstDir, nodeChecker_);
+}
+
+template<class TNodeChecker>
+unsigned HierarchicalPathFinder<TNodeChecker>::GetNumEntrances()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    UpdateChangedClusters();
+    unsigned result = 0;
+    for(const Cluster& cluster : clusters_)
+        result += cluster.entrances.size();
+    return result;
+}
+
+template<class TNodeChecker>
+unsigned HierarchicalPathFinder<TNodeChecker>::GetClusterIdx(const MapPoint pt) const
+{
+    return (pt.y / clusterSize_) * numClusters_.x + pt.x / clusterSize_;
+}
+
+template<class TNodeChecker>
+unsigned HierarchicalPathFinder<TNodeChecker>::GetLocalIdx(const MapPoint pt) const
+{
+    return (pt.y % clusterSize_) * clusterSize_ + pt.x % clusterSize_;
+}
+
+template<class TNodeChecker>
+std::vector<unsigned> HierarchicalPathFinder<TNodeChecker>::GetNeighborClusters(unsigned clusterIdx) const
+{
+    const int x = clusterIdx % numClusters_.x;
+    const int y = clusterIdx / numClusters_.x;
+    std::vector<unsigned> result;
+    for(int dy = -1; dy <= 1; dy++)
+    {
+        for(int dx = -1; dx <= 1; dx++)
+        {
+            // Map wraps around
+            const unsigned nbX = (x + dx + numClusters_.x) % numClusters_.x;
+            const unsigned nbY = (y + dy + numClusters_.y) % numClusters_.y;
+            const unsigned nbIdx = nbY * numClusters_.x + nbX;
+            if(nbIdx != clusterIdx && std::find(result.begin(), result.end(), nbIdx) == result.end())
+                result.push_back(nbIdx);
+        }
+    }
+    return result;
+}
+
+template<class TNodeChecker>
+int HierarchicalPathFinder<TNodeChecker>::GetEntranceIdx(const Cluster& cluster, const MapPoint pt) const
+{
+    const unsigned idx = gwb_.GetIdx(pt);
+    const auto it =
+      std::lower_bound(cluster.entrances.begin(), cluster.entrances.end(), idx,
+                       [this](const MapPoint& entrance, unsigned i) { return gwb_.GetIdx(entrance) < i; });
+    if(it == cluster.entrances.end() || *it != pt)
+        return -1;
+    return static_cast<int>(it - cluster.entrances.begin());
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::UpdateChangedClusters()
+{
+    if(!hasChangedClusters_)
+        return;
+    hasChangedClusters_ = false;
+
+    // The crossings of the neighbors depend on the nodes of a changed cluster too
+    std::vector<bool> needsUpdate(clusters_.size(), false);
+    for(unsigned i = 0; i < clusters_.size(); i++)
+    {
+        if(!clusters_[i].changed)
+            continue;
+        needsUpdate[i] = true;
+        for(const unsigned nbIdx : GetNeighborClusters(i))
+            needsUpdate[nbIdx] = true;
+    }
+    std::vector<unsigned> clustersToUpdate;
+    for(unsigned i = 0; i < clusters_.size(); i++)
+    {
+        if(needsUpdate[i])
+            clustersToUpdate.push_back(i);
+    }
+    for(const unsigned i : clustersToUpdate)
+        UpdateCrossings(i);
+    for(const unsigned i : clustersToUpdate)
+        UpdateEntrances(i);
+    for(const unsigned i : clustersToUpdate)
+    {
+        UpdateDistances(i);
+        clusters_[i].changed = false;
+    }
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::UpdateCrossings(unsigned clusterIdx)
+{
+    const MapCoord startX = (clusterIdx % numClusters_.x) * clusterSize_;
+    const MapCoord startY = (clusterIdx / numClusters_.x) * clusterSize_;
+    const MapCoord endX = std::min<unsigned>(startX + clusterSize_, size_.x);
+    const MapCoord endY = std::min<unsigned>(startY + clusterSize_, size_.y);
+
+    // Target cluster and crossing
+    std::vector<std::pair<unsigned, Crossing>> candidates;
+    MapPoint pt;
+    for(pt.y = startY; pt.y < endY; pt.y++)
+    {
+        for(pt.x = startX; pt.x < endX; pt.x++)
+        {
+            if(!nodeChecker_.IsNodeOk(pt))
+                continue;
+            for(const Direction dir : {Direction::East, Direction::SouthEast, Direction::SouthWest})
+            {
+                const MapPoint nb = gwb_.GetNeighbour(pt, dir);
+                const unsigned nbClusterIdx = GetClusterIdx(nb);
+                if(nbClusterIdx == clusterIdx)
+                    continue;
+                if(nodeChecker_.IsNodeOk(nb) && nodeChecker_.IsEdgeOk(pt, dir) && nodeChecker_.IsEdgeOk(nb, dir + 3u))
+                    candidates.emplace_back(nbClusterIdx, Crossing{pt, dir});
+            }
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // Use only some crossings of each run of adjacent crossings to the same cluster
+    std::vector<Crossing>& crossings = clusters_[clusterIdx].crossings;
+    crossings.clear();
+    size_t runStart = 0;
+    for(size_t i = 1; i <= candidates.size(); i++)
+    {
+        if(i < candidates.size() && candidates[i].first == candidates[i - 1].first
+           && gwb_.CalcDistance(candidates[i].second.from, candidates[i - 1].second.from) <= 1)
+            continue;
+        const size_t runLength = i - runStart;
+        if(runLength >= minLongRunLength)
+        {
+            crossings.push_back(candidates[runStart].second);
+            crossings.push_back(candidates[i - 1].second);
+        } else
+            crossings.push_back(candidates[runStart + runLength / 2].second);
+        runStart = i;
+    }
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::UpdateEntrances(unsigned clusterIdx)
+{
+    Cluster& cluster = clusters_[clusterIdx];
+    // Entrance and its neighbor in the other cluster
+    std::vector<std::pair<MapPoint, MapPoint>> connections;
+    for(const Crossing& crossing : cluster.crossings)
+        connections.emplace_back(crossing.from, gwb_.GetNeighbour(crossing.from, crossing.dir));
+    for(const unsigned nbIdx : GetNeighborClusters(clusterIdx))
+    {
+        for(const Crossing& crossing : clusters_[nbIdx].crossings)
+        {
+            const MapPoint to = gwb_.GetNeighbour(crossing.from, crossing.dir);
+            if(GetClusterIdx(to) == clusterIdx)
+                connections.emplace_back(to, crossing.from);
+        }
+    }
+
+    const auto cmpIdx = [this](const MapPoint& lhs, const MapPoint& rhs) {
+        return gwb_.GetIdx(lhs) < gwb_.GetIdx(rhs);
+    };
+    cluster.entrances.clear();
+    for(const auto& connection : connections)
+        cluster.entrances.push_back(connection.first);
+    std::sort(cluster.entrances.begin(), cluster.entrances.end(), cmpIdx);
+    cluster.entrances.erase(std::unique(cluster.entrances.begin(), cluster.entrances.end()), cluster.entrances.end());
+
+    cluster.links.clear();
+    for(const auto& connection : connections)
+        cluster.links.emplace_back(static_cast<unsigned>(GetEntranceIdx(cluster, connection.first)), connection.second);
+    std::sort(cluster.links.begin(), cluster.links.end(), [cmpIdx](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first || (lhs.first == rhs.first && cmpIdx(lhs.second, rhs.second));
+    });
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::UpdateDistances(unsigned clusterIdx)
+{
+    Cluster& cluster = clusters_[clusterIdx];
+    const unsigned numEntrances = cluster.entrances.size();
+    cluster.distances.resize(numEntrances * numEntrances);
+    std::vector<unsigned> bfsDistances;
+    for(unsigned i = 0; i < numEntrances; i++)
+    {
+        CalcClusterDistances(cluster.entrances[i], cluster.entrances[i], false, bfsDistances);
+        for(unsigned j = 0; j < numEntrances; j++)
+            cluster.distances[i * numEntrances + j] = bfsDistances[GetLocalIdx(cluster.entrances[j])];
+    }
+}
+
+template<class TNodeChecker>
+void HierarchicalPathFinder<TNodeChecker>::CalcClusterDistances(const MapPoint start, const MapPoint exceptPt,
+                                                                bool reverse, std::vector<unsigned>& distances)
+{
+    const unsigned clusterIdx = GetClusterIdx(start);
+    distances.assign(clusterSize_ * clusterSize_, noDistance);
+    distances[GetLocalIdx(start)] = 0;
+    bfsQueue_.clear();
+    bfsQueue_.push_back(start);
+    for(size_t i = 0; i < bfsQueue_.size(); i++)
+    {
+        const MapPoint curPt = bfsQueue_[i];
+        const unsigned nextDistance = distances[GetLocalIdx(curPt)] + 1;
+        for(const Direction dir : helpers::EnumRange<Direction>{})
+        {
+            const MapPoint nb = gwb_.GetNeighbour(curPt, dir);
+            if(GetClusterIdx(nb) != clusterIdx)
+                continue;
+            unsigned& nbDistance = distances[GetLocalIdx(nb)];
+            if(nbDistance != noDistance)
+                continue;
+            if(nb != exceptPt && !nodeChecker_.IsNodeOk(nb))
+                continue;
+            if(reverse ? !nodeChecker_.IsEdgeOk(nb, dir + 3u) : !nodeChecker_.IsEdgeOk(curPt, dir))
+                continue;
+            nbDistance = nextDistance;
+            // Paths must not lead through the excepted point as it might not be passable
+            if(nb != exceptPt)
+                bfsQueue_.push_back(nb);
+        }
+    }
+}
+
+template<class TNodeChecker>
+std::vector<std::pair<MapPoint, unsigned>>
+HierarchicalPathFinder<TNodeChecker>::FindAbstractPath(const MapPoint start, const MapPoint dest, unsigned maxLength)
+{
+    if(currentVisit_ == std::numeric_limits<unsigned>::max())
+    {
+        for(SearchNode& node : searchNodes_)
+            node.lastVisited = 0;
+        currentVisit_ = 0;
+    }
+    currentVisit_++;
+
+    const unsigned startClusterIdx = GetClusterIdx(start);
+    const unsigned destClusterIdx = GetClusterIdx(dest);
+    CalcClusterDistances(start, dest, false, startDistances_);
+    CalcClusterDistances(dest, start, true, destDistances_);
+
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> todo;
+    const auto addNode = [&](const MapPoint pt, unsigned distance, unsigned prevIdx) {
+        const unsigned estimate = distance + gwb_.CalcDistance(pt, dest);
+        if(estimate > maxLength)
+            return;
+        const unsigned idx = gwb_.GetIdx(pt);
+        SearchNode& node = searchNodes_[idx];
+        if(node.lastVisited == currentVisit_ && node.distance <= distance)
+            return;
+        node.lastVisited = currentVisit_;
+        node.pt = pt;
+        node.distance = distance;
+        node.prev = prevIdx;
+        todo.push(QueueEntry{estimate, distance, idx, pt});
+    };
+
+    const unsigned startIdx = gwb_.GetIdx(start);
+    unsigned bestDistance = noDistance;
+    unsigned bestPrevIdx = startIdx;
+    // Direct path inside the cluster
+    if(startClusterIdx == destClusterIdx)
+        bestDistance = startDistances_[GetLocalIdx(dest)];
+
+    SearchNode& startNode = searchNodes_[startIdx];
+    startNode.lastVisited = currentVisit_;
+    startNode.pt = start;
+    startNode.distance = 0;
+    startNode.prev = startIdx;
+    const Cluster& startCluster = clusters_[startClusterIdx];
+    if(GetEntranceIdx(startCluster, start) >= 0)
+        todo.push(QueueEntry{gwb_.CalcDistance(start, dest), 0, startIdx, start});
+    else
+    {
+        for(const MapPoint& entrance : startCluster.entrances)
+        {
+            const unsigned distance = startDistances_[GetLocalIdx(entrance)];
+            if(distance != noDistance)
+                addNode(entrance, distance, startIdx);
+        }
+    }
+
+    while(!todo.empty())
+    {
+        const QueueEntry entry = todo.top();
+        todo.pop();
+        // The estimate is a lower bound, so no better path can be found anymore
+        if(bestDistance != noDistance && entry.estimate >= bestDistance)
+            break;
+        const SearchNode& node = searchNodes_[entry.idx];
+        // Outdated entry
+        if(entry.distance != node.distance)
+            continue;
+
+        const unsigned clusterIdx = GetClusterIdx(entry.pt);
+        const Cluster& cluster = clusters_[clusterIdx];
+        const int entranceIdx = GetEntranceIdx(cluster, entry.pt);
+        RTTR_Assert(entranceIdx >= 0);
+
+        if(clusterIdx == destClusterIdx)
+        {
+            const unsigned destDistance = destDistances_[GetLocalIdx(entry.pt)];
+            if(destDistance != noDistance && node.distance + destDistance < bestDistance)
+            {
+                bestDistance = node.distance + destDistance;
+                bestPrevIdx = entry.idx;
+            }
+        }
+
+        const unsigned numEntrances = cluster.entrances.size();
+        for(unsigned i = 0; i < numEntrances; i++)
+        {
+            const unsigned distance = cluster.distances[entranceIdx * numEntrances + i];
+            if(distance != noDistance && static_cast<int>(i) != entranceIdx)
+                addNode(cluster.entrances[i], node.distance + distance, entry.idx);
+        }
+        const auto linkKey = std::make_pair(static_cast<unsigned>(entranceIdx), MapPoint());
+        const auto links = std::equal_range(cluster.links.begin(), cluster.links.end(), linkKey,
+                                            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        for(auto it = links.first; it != links.second; ++it)
+            addNode(it->second, node.distance + 1, entry.idx);
+    }
+
+    std::vector<std::pair<MapPoint, unsigned>> result;
+    if(bestDistance > maxLength)
+        return result;
+    result.emplace_back(dest, bestDistance);
+    for(unsigned idx = bestPrevIdx;; idx = searchNodes_[idx].prev)
+    {
+        result.emplace_back(searchNodes_[idx].pt, searchNodes_[idx].distance);
+        if(idx == startIdx)
+            break;
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<class TNodeChecker>
+bool HierarchicalPathFinder<TNodeChecker>::RefinePath(const std::vector<std::pair<MapPoint, unsigned>>& waypoints,
+                                                      bool randomRoute, std::vector<Direction>* route,
+                                                      unsigned* length, Direction* firstDir)
+{
+    FreePathFinder& freePathFinder = gwb_.GetFreePathFinder();
+    if(route)
+        route->clear();
+    unsigned totalLength = 0;
+    for(unsigned i = 0; i + 1 < waypoints.size(); i++)
+    {
+        const MapPoint from = waypoints[i].first;
+        const MapPoint to = waypoints[i + 1].first;
+        // Happens if the dest is an entrance
+        if(from == to)
+            continue;
+        // The regular search does not check the destination, but the waypoints in between must be passable
+        if(i + 2 < waypoints.size() && !nodeChecker_.IsNodeOk(to))
+            return false;
+        // The distance on the abstract graph is an upper bound for the section
+        const unsigned maxSectionLength = waypoints[i + 1].second - waypoints[i].second;
+        unsigned sectionLength;
+        Direction sectionDir;
+        if(!freePathFinder.FindPath(from, to, randomRoute && i == 0, maxSectionLength, route ? &sectionRoute_ : nullptr,
+                                    &sectionLength, &sectionDir, nodeChecker_))
+            return false;
+        if(i == 0 && firstDir)
+            *firstDir = sectionDir;
+        totalLength += sectionLength;
+        if(route)
+            route->insert(route->end(), sectionRoute_.begin(), sectionRoute_.end());
+        else if(!length)
+            break; // Only the direction is required
+    }
+    if(length)
+        *length = totalLength;
+    return true;
+}
+
+template class HierarchicalPathFinder<PathConditionHuman>;
+template class HierarchicalPathFinder<PathConditionShip>;
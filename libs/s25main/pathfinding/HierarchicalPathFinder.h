@@ -0,0 +1,112 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gameTypes/Direction.h"
+#include "gameTypes/MapCoordinates.h"
+#include <mutex>
+#include <utility>
+#include <vector>
+
+class GameWorldBase;
+
+/// Path finder for long paths in free terrain using a hierarchical abstraction (HPA*).
+/// The map is divided into square clusters. Passable crossings between neighboring clusters are the entrances and
+/// the distances between the entrances of a cluster are precomputed. A long path is first searched on this abstract
+/// graph and then refined section by section with the regular FreePathFinder.
+/// The paths found are valid and not longer than the maximum, but may be longer than the shortest path and differ from
+/// the ones the FreePathFinder finds. So this must only be used where all clients use it (see the addon).
+/// If no path is found on the abstract graph the FreePathFinder is used, hence a path is found if and only if the
+/// FreePathFinder finds one.
+/// Changed nodes must be reported via MarkChanged so the affected clusters are rebuilt before the next search.
+template<class TNodeChecker>
+class HierarchicalPathFinder
+{
+public:
+    HierarchicalPathFinder(const GameWorldBase& gwb, TNodeChecker nodeChecker, unsigned clusterSize = 16);
+    void Init(const MapExtent& mapSize);
+
+    /// The passability of the node (object, road) changed
+    void MarkChanged(MapPoint pt);
+
+    /// Same as FreePathFinder::FindPath. Short paths are searched directly with the FreePathFinder
+    bool FindPath(MapPoint start, MapPoint dest, bool randomRoute, unsigned maxLength, std::vector<Direction>* route,
+                  unsigned* length, Direction* firstDir);
+
+    unsigned GetClusterSize() const { return clusterSize_; }
+    /// Paths shorter than this are searched directly
+    unsigned GetMinDistance() const { return 2 * clusterSize_; }
+    /// Rebuild all changed clusters and return the number of entrances of all clusters
+    unsigned GetNumEntrances();
+
+private:
+    /// Passable transition from a node in the cluster to a neighbor in another cluster
+    struct Crossing
+    {
+        MapPoint from;
+        Direction dir;
+    };
+    struct Cluster
+    {
+        /// Crossings to the clusters to the east and south (others are stored in the respective other cluster)
+        std::vector<Crossing> crossings;
+        /// Entrance nodes sorted by their index
+        std::vector<MapPoint> entrances;
+        /// Index of entrance and its neighbor in another cluster. Sorted by the index
+        std::vector<std::pair<unsigned, MapPoint>> links;
+        /// Distance inside the cluster between entrance i and j at (i * entrances.size() + j)
+        std::vector<unsigned> distances;
+        bool changed = true;
+    };
+    /// Node of the abstract search (indexed by the map index)
+    struct SearchNode
+    {
+        unsigned lastVisited = 0;
+        MapPoint pt;
+        unsigned distance;
+        /// Map index of the previous node or the own index for the start
+        unsigned prev;
+    };
+
+    const GameWorldBase& gwb_;
+    const TNodeChecker nodeChecker_;
+    const unsigned clusterSize_;
+    MapExtent size_;
+    /// Number of clusters in x and y direction
+    MapExtent numClusters_;
+    std::vector<Cluster> clusters_;
+    bool hasChangedClusters_;
+    std::vector<SearchNode> searchNodes_;
+    unsigned currentVisit_;
+    /// Distances from the start/to the goal inside their cluster (local index)
+    std::vector<unsigned> startDistances_, destDistances_;
+    /// Reused buffers for BFS and refinement
+    std::vector<MapPoint> bfsQueue_;
+    std::vector<Direction> sectionRoute_;
+    std::mutex mutex_;
+
+    unsigned GetClusterIdx(MapPoint pt) const;
+    /// Index of the node inside its cluster
+    unsigned GetLocalIdx(MapPoint pt) const;
+    /// Indices of the surrounding clusters (without the cluster itself)
+    std::vector<unsigned> GetNeighborClusters(unsigned clusterIdx) const;
+    /// Return the index of the entrance in its cluster or -1 if it is not an entrance
+    int GetEntranceIdx(const Cluster& cluster, MapPoint pt) const;
+
+    void UpdateChangedClusters();
+    void UpdateCrossings(unsigned clusterIdx);
+    void UpdateEntrances(unsigned clusterIdx);
+    void UpdateDistances(unsigned clusterIdx);
+    /// Breadth first search inside the cluster of start. Nodes except start and exceptPt must be ok.
+    /// If reverse is set, the edges are checked in the opposite direction (distances to start)
+    void CalcClusterDistances(MapPoint start, MapPoint exceptPt, bool reverse, std::vector<unsigned>& distances);
+
+    /// Search on the abstract graph and return the nodes of the path including start and dest with their distance
+    /// from the start. Empty if not found within maxLength
+    std::vector<std::pair<MapPoint, unsigned>> FindAbstractPath(MapPoint start, MapPoint dest, unsigned maxLength);
+    /// Refine the abstract path to nodes. Return false if a section could not be refined
+    bool RefinePath(const std::vector<std::pair<MapPoint, unsigned>>& waypoints, bool randomRoute,
+                    std::vector<Direction>* route, unsigned* length, Direction* firstDir);
+};
@@ -6,13 +6,14 @@
 
 #include "RTTR_Assert.h"
 #include <boost/container/small_vector.hpp>
+#include <algorithm>
 #include <limits>
 
 /// Just for occasional temporary debugging, all should be covered by tests and this is SLOW
 #define RTTR_SLOW_DEBUG_CHECKS 0
 
-template<typename T, class T_GetKey>
-class OpenListBinaryHeap;
+template<typename T, class T_GetKey, unsigned T_Arity>
+class OpenListDaryHeap;
 
 /// Class used to store the position in the heap. Heap elements must inherit from this
 struct BinaryHeapPosMarker
@@ -20,13 +21,20 @@ struct BinaryHeapPosMarker
 private:
     unsigned pos;
 
-    template<typename T, class T_GetKey>
-    friend class OpenListBinaryHeap;
+    template<typename T, class T_GetKey, unsigned T_Arity>
+    friend class OpenListDaryHeap;
 };
 
-template<typename T, class T_GetKey>
-class OpenListBinaryHeap : T_GetKey
+/// Min-heap of pointers with T_Arity children per node supporting decrease-key.
+/// Storage is kept on clear, so a reused heap does not allocate once it reached its maximum size.
+/// The order of elements with equal keys only depends on the push/pop/decreasedKey sequence and the arity.
+/// A binary heap (arity 2) pops them in the same order as previous versions which is required for replay
+/// compatibility when used for the game logic.
+template<typename T, class T_GetKey, unsigned T_Arity>
+class OpenListDaryHeap : T_GetKey
 {
+    static_assert(T_Arity >= 2, "Arity must be at least 2");
+
 public:
     using size_type = decltype(BinaryHeapPosMarker::pos);
     using value_type = T;
@@ -54,9 +62,8 @@ public:
 
 protected:
     static size_type NoPos() { return std::numeric_limits<size_type>::max(); }
-    static size_type ParentPos(size_type pos) { return (pos - 1) / 2; }
-    static size_type LeftChildPos(size_type pos) { return (2 * pos) + 1; }
-    static size_type RightChildPos(size_type pos) { return (2 * pos) + 2; }
+    static size_type ParentPos(size_type pos) { return (pos - 1) / T_Arity; }
+    static size_type FirstChildPos(size_type pos) { return (T_Arity * pos) + 1; }
 
     bool isHeap() const;
     bool arePositionsValid() const;
@@ -67,6 +74,9 @@ protected:
     boost::container::small_vector<Element, 64> elements;
 };
 
+template<typename T, class T_GetKey>
+using OpenListBinaryHeap = OpenListDaryHeap<T, T_GetKey, 2>;
+
 //////////////////////////////////////////////////////////////////////////
 // Implementation
 //////////////////////////////////////////////////////////////////////////
@@ -79,25 +89,25 @@ protected:
 #    define RTTR_VALIDATE_HEAP() (void)0
 #endif
 
-template<typename T, class T_GetKey>
-bool OpenListBinaryHeap<T, T_GetKey>::isHeap() const
+template<typename T, class T_GetKey, unsigned T_Arity>
+bool OpenListDaryHeap<T, T_GetKey, T_Arity>::isHeap() const
 {
     size_type size = this->size();
     for(size_type i = 0; i < size; i++)
     {
-        const size_type left = LeftChildPos(i);
-        const size_type right = RightChildPos(i);
-        // If child exist, parent must be "less" than child
-        if(left < size && GetKey(left) < GetKey(i))
-            return false;
-        if(right < size && GetKey(right) < GetKey(i))
-            return false;
+        // If children exist, parent must be "less" than child
+        const size_type firstChild = FirstChildPos(i);
+        for(size_type child = firstChild; child < size && child < firstChild + T_Arity; child++)
+        {
+            if(GetKey(child) < GetKey(i))
+                return false;
+        }
     }
     return true;
 }
 
-template<typename T, class T_GetKey>
-bool OpenListBinaryHeap<T, T_GetKey>::arePositionsValid() const
+template<typename T, class T_GetKey, unsigned T_Arity>
+bool OpenListDaryHeap<T, T_GetKey, T_Arity>::arePositionsValid() const
 {
     for(size_type i = 0; i < this->size(); i++)
     {
@@ -107,15 +117,15 @@ bool OpenListBinaryHeap<T, T_GetKey>::arePositionsValid() const
     return true;
 }
 
-template<typename T, class T_GetKey>
-inline T* OpenListBinaryHeap<T, T_GetKey>::top() const
+template<typename T, class T_GetKey, unsigned T_Arity>
+inline T* OpenListDaryHeap<T, T_GetKey, T_Arity>::top() const
 {
     RTTR_Assert(!this->empty());
     return this->elements.front().el;
 }
 
-template<typename T, class T_GetKey>
-inline void OpenListBinaryHeap<T, T_GetKey>::push(T* newEl)
+template<typename T, class T_GetKey, unsigned T_Arity>
+inline void OpenListDaryHeap<T, T_GetKey, T_Arity>::push(T* newEl)
 {
     RTTR_VALIDATE_HEAP();
     GetPos(newEl) = this->size();
@@ -123,8 +133,8 @@ inline void OpenListBinaryHeap<T, T_GetKey>::push(T* newEl)
     decreasedKey(newEl);
 }
 
-template<typename T, class T_GetKey>
-inline void OpenListBinaryHeap<T, T_GetKey>::decreasedKey(T* el)
+template<typename T, class T_GetKey, unsigned T_Arity>
+inline void OpenListDaryHeap<T, T_GetKey, T_Arity>::decreasedKey(T* el)
 {
     size_type i = GetPos(el);
     unsigned elVal = this->elements[i].key = GetKey(el);
@@ -143,8 +153,8 @@ inline void OpenListBinaryHeap<T, T_GetKey>::decreasedKey(T* el)
     RTTR_VALIDATE_HEAP();
 }
 
-template<typename T, class T_GetKey>
-inline T* OpenListBinaryHeap<T, T_GetKey>::pop()
+template<typename T, class T_GetKey, unsigned T_Arity>
+inline T* OpenListDaryHeap<T, T_GetKey, T_Arity>::pop()
 {
     RTTR_Assert(!this->empty());
     RTTR_VALIDATE_HEAP();
@@ -170,29 +180,26 @@ inline T* OpenListBinaryHeap<T, T_GetKey>::pop()
     do
     {
         // Now check if the heap condition is violated for the current position
-        const size_type left = LeftChildPos(i);
-        if(left >= size)
+        const size_type firstChild = FirstChildPos(i);
+        if(firstChild >= size)
             break; // No child? -> All ok
-        const size_type right = RightChildPos(i);
-        const unsigned leftVal = this->elements[left].key;
-        if(leftVal < el.key) // left < i
+        const size_type endChild = std::min<size_type>(firstChild + T_Arity, size);
+        // Find the smallest child. On equal keys take the last one as the binary heap always did
+        size_type minChild = firstChild;
+        unsigned minVal = this->elements[firstChild].key;
+        for(size_type child = firstChild + 1; child < endChild; child++)
         {
-            if(right >= size || leftVal < this->elements[right].key) // left < right
+            if(this->elements[child].key <= minVal)
             {
-                this->elements[i] = this->elements[left];
-                GetPos(this->elements[i].el) = i;
-                i = left;
-                continue;
+                minChild = child;
+                minVal = this->elements[child].key;
             }
         }
-        // left >= i || (left < i && left >= right)
-        if(right < size && this->elements[right].key < el.key) // right < i
-        {
-            this->elements[i] = this->elements[right];
-            GetPos(this->elements[i].el) = i;
-            i = right;
-        } else
+        if(minVal >= el.key)
             break;
+        this->elements[i] = this->elements[minChild];
+        GetPos(this->elements[i].el) = i;
+        i = minChild;
     } while(true);
 
     this->elements[i] = el;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "RTTR_Assert.h"
 #include <vector>
 
 struct GetEstimateFromPtr
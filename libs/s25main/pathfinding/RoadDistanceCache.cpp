@@ -0,0 +1,45 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "RoadDistanceCache.h"
+#include "pathfinding/RoadPathFinder.h"
+#include "nodeObjs/noRoadNode.h"
+
+bool RoadDistanceCache::findPath(RoadPathFinder& pathFinder, const noRoadNode& start, const noRoadNode& goal,
+                                 const unsigned max, unsigned& length)
+{
+    // Object IDs are never reused, so entries of destroyed nodes can't be confused with new ones
+    const uint64_t key = (static_cast<uint64_t>(start.GetObjId()) << 32u) | goal.GetObjId();
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = entries.find(key);
+    if(it != entries.end())
+    {
+        const Entry& entry = it->second;
+        // The path finder returns the shortest path if its costs are within the limit
+        if(entry.found)
+        {
+            if(entry.length > max)
+                return false;
+            length = entry.length;
+            return true;
+        }
+        if(max <= entry.maxChecked)
+            return false;
+    }
+    if(entries.size() >= maxSize)
+        entries.clear();
+
+    Entry& entry = entries[key];
+    entry.found = pathFinder.FindPath(start, goal, false, max, nullptr, &entry.length);
+    entry.maxChecked = max;
+    if(entry.found)
+        length = entry.length;
+    return entry.found;
+}
+
+void RoadDistanceCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries.clear();
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+class noRoadNode;
+class RoadPathFinder;
+
+/// Caches the costs of paths between road nodes of a player as used by persons, i.e. without boat roads, busy
+/// carriers or forbidden segments. Those only depend on the road network of the player and hence stay valid until it
+/// changes, which must be signaled via clear().
+/// The results are the same as from calling RoadPathFinder::FindPath directly.
+class RoadDistanceCache
+{
+    struct Entry
+    {
+        /// Costs of the path if found
+        unsigned length;
+        /// Maximum costs checked when no path was found
+        unsigned maxChecked;
+        bool found;
+    };
+
+    std::unordered_map<uint64_t, Entry> entries;
+    /// Allows queries from multiple threads, e.g. from AIs
+    std::mutex mutex_;
+
+public:
+    /// Maximum number of entries before the cache is reset to limit memory usage
+    static constexpr size_t maxSize = 1u << 16;
+
+    /// Same as RoadPathFinder::FindPath with wareMode=false and no forbidden segment
+    bool findPath(RoadPathFinder& pathFinder, const noRoadNode& start, const noRoadNode& goal, unsigned max,
+                  unsigned& length);
+    void clear();
+    size_t size() const { return entries.size(); }
+};
@@ -4,34 +4,12 @@
 
 #include "RoadPathFinder.h"
 #include "EventManager.h"
-#include "RttrForeachPt.h"
 #include "buildings/nobHarborBuilding.h"
-#include "pathfinding/OpenListPrioQueue.h"
-#include "pathfinding/OpenListVector.h"
 #include "world/GameWorldBase.h"
 #include "nodeObjs/noRoadNode.h"
 #include "gameData/GameConsts.h"
 #include "s25util/Log.h"
 
-/// Comparison operator for road nodes that returns true if lhs > rhs (descending order)
-struct RoadNodeComperatorGreater
-{
-    bool operator()(const noRoadNode* const lhs, const noRoadNode* const rhs) const
-    {
-        if(lhs->estimate == rhs->estimate)
-        {
-            // Use a tie-breaker to get strict ordering
-            return (lhs->GetObjId() > rhs->GetObjId());
-        }
-
-        return (lhs->estimate > rhs->estimate);
-    }
-};
-
-using QueueImpl = OpenListPrioQueue<const noRoadNode*, RoadNodeComperatorGreater>;
-using VecImpl = OpenListVector<const noRoadNode*>;
-VecImpl todo;
-
 // Namespace with all functors usable as additional cost functors
 namespace AdditonalCosts {
 struct None
@@ -99,6 +77,33 @@ struct And : private T_Func1, private T_Func2
 };
 } // namespace SegmentConstraints
 
+void RoadPathFinder::Init(const MapExtent& mapSize)
+{
+    currentVisit = 0;
+    nodes_.clear();
+    nodes_.resize(prodOfComponents(mapSize));
+}
+
+unsigned RoadPathFinder::StartNewVisit()
+{
+    // Use a counter for the visited-states so we don't have to reset them on every invocation
+    currentVisit++;
+    // if the counter reaches its maximum, tidy up
+    if(currentVisit == std::numeric_limits<unsigned>::max())
+    {
+        for(Node& node : nodes_)
+            node.lastVisit = 0;
+        currentVisit = 1;
+    }
+    return currentVisit;
+}
+
+RoadPathFinder::Node& RoadPathFinder::GetNode(const noRoadNode& roadNode)
+{
+    RTTR_Assert(nodes_.size() == prodOfComponents(gwb_.GetSize()));
+    return nodes_[gwb_.GetIdx(roadNode.GetPos())];
+}
+
 /// Path finding on roads using A* O(n lg n)
 /// \tparam T_AdditionalCosts Cost for each road segment but the one to the goal building
 /// \tparam T_SegmentConstraints Predicate whether a road is allowed
@@ -129,57 +134,48 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
     // TODO(Replay): Change RoadPathFinder::FindPath to target flag instead of building for wares
     const noRoadNode* goalBld = (goal.GetGOT() == GO_Type::Flag) ? nullptr : &goal;
 
-    // Use a counter for the visited-states so we don't have to reset them on every invocation
-    currentVisit++;
-    // if the counter reaches its maximum, tidy up
-    if(currentVisit == std::numeric_limits<unsigned>::max())
-    {
-        RTTR_FOREACH_PT(MapPoint, gwb_.GetSize())
-        {
-            auto* const node = gwb_.GetSpecObj<noRoadNode>(pt);
-            if(node)
-                node->last_visit = 0;
-        }
-        currentVisit = 1;
-    }
+    StartNewVisit();
 
     // Add start node
-    todo.clear();
+    openList_.clear();
 
     const MapPoint goalPos = goal.GetPos();
-    start.targetDistance = gwb_.CalcDistance(start.GetPos(), goalPos);
-    start.estimate = start.targetDistance;
-    start.last_visit = currentVisit;
-    start.prev = nullptr;
-    start.cost = 0;
-    start.dir_ = RoadPathDirection::None;
-
-    todo.push(&start);
-
-    while(!todo.empty())
+    Node& startNode = GetNode(start);
+    startNode.roadNode = &start;
+    startNode.targetDistance = gwb_.CalcDistance(start.GetPos(), goalPos);
+    startNode.estimate = startNode.targetDistance;
+    startNode.lastVisit = currentVisit;
+    startNode.prev = nullptr;
+    startNode.cost = 0;
+    startNode.dir = RoadPathDirection::None;
+
+    openList_.push(&startNode);
+
+    while(!openList_.empty())
     {
         // Get node with current least estimate
-        const noRoadNode& best = *todo.pop();
+        const Node& bestNode = *openList_.pop();
+        const noRoadNode& best = *bestNode.roadNode;
 
         // Reached goal
         if(&best == &goal)
         {
             if(length)
-                *length = best.cost;
+                *length = bestNode.cost;
 
             // Backtrack to get the last node that is not the start node (has a prev node)
             // --> Next node from start on path
             if(firstDir || firstNodePos)
             {
-                const noRoadNode* firstNode = &best;
-                while(firstNode->prev != &start)
+                const Node* firstNode = &bestNode;
+                while(firstNode->prev != &startNode)
                     firstNode = firstNode->prev;
 
                 if(firstDir)
-                    *firstDir = firstNode->dir_;
+                    *firstDir = firstNode->dir;
 
                 if(firstNodePos)
-                    *firstNodePos = firstNode->GetPos();
+                    *firstNodePos = firstNode->roadNode->GetPos();
             }
 
             // Done, path found
@@ -187,7 +183,7 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
         }
 
         const helpers::EnumArray<RoadSegment*, Direction> routes = best.getRoutes();
-        const noRoadNode* prevNode = best.prev;
+        const noRoadNode* prevNode = bestNode.prev ? bestNode.prev->roadNode : nullptr;
 
         // Check paths in all directions
         for(const auto dir : helpers::EnumRange<Direction>{})
@@ -218,34 +214,36 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
             if(!isSegmentAllowed(*route))
                 continue;
 
-            const unsigned cost = best.cost + route->GetLength() + (neighbour != goalBld ? addCosts(best, dir) : 0);
+            const unsigned cost = bestNode.cost + route->GetLength() + (neighbour != goalBld ? addCosts(best, dir) : 0);
 
             if(cost > max)
                 continue;
 
+            Node& neighbourNode = GetNode(*neighbour);
             // Was node already visited?
-            if(neighbour->last_visit == currentVisit)
+            if(neighbourNode.lastVisit == currentVisit)
             {
                 // Update node if costs are lower
-                if(cost < neighbour->cost)
+                if(cost < neighbourNode.cost)
                 {
-                    neighbour->cost = cost;
-                    neighbour->estimate = neighbour->targetDistance + cost;
-                    neighbour->prev = &best;
-                    neighbour->dir_ = toRoadPathDirection(dir);
-                    todo.rearrange(neighbour);
+                    neighbourNode.cost = cost;
+                    neighbourNode.estimate = neighbourNode.targetDistance + cost;
+                    neighbourNode.prev = &bestNode;
+                    neighbourNode.dir = toRoadPathDirection(dir);
+                    openList_.rearrange(&neighbourNode);
                 }
             } else
             {
                 // Not visited yet -> Add to list
-                neighbour->cost = cost;
-                neighbour->targetDistance = gwb_.CalcDistance(neighbour->GetPos(), goalPos);
-                neighbour->estimate = neighbour->targetDistance + cost;
-                neighbour->last_visit = currentVisit;
-                neighbour->prev = &best;
-                neighbour->dir_ = toRoadPathDirection(dir);
-
-                todo.push(neighbour);
+                neighbourNode.roadNode = neighbour;
+                neighbourNode.cost = cost;
+                neighbourNode.targetDistance = gwb_.CalcDistance(neighbour->GetPos(), goalPos);
+                neighbourNode.estimate = neighbourNode.targetDistance + cost;
+                neighbourNode.lastVisit = currentVisit;
+                neighbourNode.prev = &bestNode;
+                neighbourNode.dir = toRoadPathDirection(dir);
+
+                openList_.push(&neighbourNode);
             }
         }
 
@@ -254,35 +252,36 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
             continue;
         for(const auto& sc : static_cast<const nobHarborBuilding&>(best).GetShipConnections())
         {
-            unsigned cost = best.cost + sc.way_costs;
+            unsigned cost = bestNode.cost + sc.way_costs;
 
             if(cost > max)
                 continue;
 
-            noRoadNode& dest = *sc.dest;
+            Node& destNode = GetNode(*sc.dest);
             // Was node already visited?
-            if(dest.last_visit == currentVisit)
+            if(destNode.lastVisit == currentVisit)
             {
                 // Update node if costs are lower
-                if(cost < dest.cost)
+                if(cost < destNode.cost)
                 {
-                    dest.cost = cost;
-                    dest.estimate = dest.targetDistance + cost;
-                    dest.prev = &best;
-                    dest.dir_ = RoadPathDirection::Ship;
-                    todo.rearrange(&dest);
+                    destNode.cost = cost;
+                    destNode.estimate = destNode.targetDistance + cost;
+                    destNode.prev = &bestNode;
+                    destNode.dir = RoadPathDirection::Ship;
+                    openList_.rearrange(&destNode);
                 }
             } else
             {
                 // Not visited yet -> Add to list
-                dest.cost = cost;
-                dest.targetDistance = gwb_.CalcDistance(dest.GetPos(), goalPos);
-                dest.estimate = dest.targetDistance + cost;
-                dest.last_visit = currentVisit;
-                dest.prev = &best;
-                dest.dir_ = RoadPathDirection::Ship;
-
-                todo.push(&dest);
+                destNode.roadNode = sc.dest;
+                destNode.cost = cost;
+                destNode.targetDistance = gwb_.CalcDistance(sc.dest->GetPos(), goalPos);
+                destNode.estimate = destNode.targetDistance + cost;
+                destNode.lastVisit = currentVisit;
+                destNode.prev = &bestNode;
+                destNode.dir = RoadPathDirection::Ship;
+
+                openList_.push(&destNode);
             }
         }
     }
@@ -341,3 +340,124 @@ bool RoadPathFinder::PathExists(const noRoadNode& start, const noRoadNode& goal,
                                 SegmentConstraints::AvoidRoadType<RoadType::Water>());
     }
 }
+
+RoadPathFinder::WarePathCosts::WarePathCosts(RoadPathFinder& pathFinder, const noRoadNode& start)
+    : pf_(pathFinder), start_(start)
+{}
+
+bool RoadPathFinder::WarePathCosts::FindPath(const noRoadNode& goal, const unsigned max, unsigned& length)
+{
+    // Searching a single path directly is faster than expanding the road network in all directions
+    if(!searchedDirectly_)
+    {
+        searchedDirectly_ = true;
+        return pf_.FindPathImpl(start_, goal, max, AdditonalCosts::Carrier(), SegmentConstraints::None(), &length);
+    }
+    if(&start_ == &goal)
+    {
+        // Same as the regular path finding, which reports this as a bug
+        RTTR_Assert(false);
+        length = 0;
+        return true;
+    }
+
+    ExpandUntil(max);
+    // All nodes with costs <= max are now expanded and have their final costs
+    bool found = false;
+    const auto useCosts = [&found, &length, max](const unsigned cost) {
+        if(cost <= max && (!found || cost < length))
+        {
+            found = true;
+            length = cost;
+        }
+    };
+    if(goal.GetGOT() == GO_Type::Flag)
+    {
+        if(IsExpanded(goal))
+            useCosts(pf_.GetNode(goal).cost);
+        return found;
+    }
+    // Buildings are only entered from their flag without additional costs for the goal (see FindPathImpl)
+    const RoadSegment* entryRoad = goal.GetRoute(Direction::SouthEast);
+    if(entryRoad)
+    {
+        const noRoadNode& flag = *entryRoad->GetF1();
+        if(IsExpanded(flag))
+            useCosts(pf_.GetNode(flag).cost + entryRoad->GetLength());
+    }
+    // Harbors may also be reached by ship. Arrivals from the goal itself are not possible as the search ends there
+    for(const ShipArrival& arrival : shipArrivals_)
+    {
+        if(arrival.dest == &goal && arrival.from != &goal)
+            useCosts(arrival.cost);
+    }
+    return found;
+}
+
+bool RoadPathFinder::WarePathCosts::IsExpanded(const noRoadNode& node) const
+{
+    return pf_.GetNode(node).lastVisit == expandedVisit_;
+}
+
+void RoadPathFinder::WarePathCosts::AddNode(const noRoadNode& node, const unsigned cost)
+{
+    Node& pfNode = pf_.GetNode(node);
+    if(pfNode.lastVisit == expandedVisit_ || (pfNode.lastVisit == foundVisit_ && pfNode.cost <= cost))
+        return;
+    pfNode.lastVisit = foundVisit_;
+    pfNode.cost = cost;
+    todo_.push(QueueEntry{cost, &node});
+}
+
+void RoadPathFinder::WarePathCosts::ExpandUntil(const unsigned maxCosts)
+{
+    // (Re-)Start if not started yet or the state of the nodes was overwritten by another search
+    if(expandedVisit_ == 0 || expandedVisit_ != pf_.currentVisit)
+    {
+        // Both IDs are distinct and not used by any node (all are reset if the counter wraps around)
+        foundVisit_ = pf_.StartNewVisit();
+        expandedVisit_ = pf_.StartNewVisit();
+        todo_ = {};
+        shipArrivals_.clear();
+        AddNode(start_, 0);
+    }
+
+    // Dijkstra search with the same rules and costs as FindPathImpl
+    while(!todo_.empty() && todo_.top().cost <= maxCosts)
+    {
+        const QueueEntry entry = todo_.top();
+        todo_.pop();
+        const noRoadNode& cur = *entry.node;
+        Node& curNode = pf_.GetNode(cur);
+        // Skip outdated entries
+        if(curNode.lastVisit == expandedVisit_ || entry.cost != curNode.cost)
+            continue;
+        curNode.lastVisit = expandedVisit_;
+
+        const helpers::EnumArray<RoadSegment*, Direction> routes = cur.getRoutes();
+        for(const auto dir : helpers::EnumRange<Direction>{})
+        {
+            const RoadSegment* route = routes[dir];
+            if(!route)
+                continue;
+            const noRoadNode& neighbour = (route->GetF1() == &cur) ? *route->GetF2() : *route->GetF1();
+            // No paths over buildings. Goal buildings are handled in FindPath
+            if(dir == Direction::NorthWest)
+            {
+                const GO_Type got = neighbour.GetGOT();
+                if(got != GO_Type::Flag && got != GO_Type::NobHarborbuilding)
+                    continue;
+            }
+            AddNode(neighbour, curNode.cost + route->GetLength() + cur.GetPunishmentPoints(dir));
+        }
+
+        if(cur.GetGOT() != GO_Type::NobHarborbuilding)
+            continue;
+        for(const auto& sc : static_cast<const nobHarborBuilding&>(cur).GetShipConnections())
+        {
+            const unsigned cost = curNode.cost + sc.way_costs;
+            shipArrivals_.push_back(ShipArrival{cost, &cur, sc.dest});
+            AddNode(*sc.dest, cost);
+        }
+    }
+}
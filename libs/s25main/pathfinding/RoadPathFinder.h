@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include "pathfinding/OpenListVector.h"
 #include "gameTypes/MapCoordinates.h"
 #include "gameTypes/RoadPathDirection.h"
+#include <functional>
 #include <limits>
+#include <queue>
+#include <vector>
 
 class GameWorldBase;
 class noRoadNode;
@@ -14,11 +18,33 @@ class RoadSegment;
 
 class RoadPathFinder
 {
-    GameWorldBase& gwb_;
+    /// Search state of a road node
+    struct Node
+    {
+        const noRoadNode* roadNode;
+        // cost from start
+        unsigned cost;
+        // distance to target
+        unsigned targetDistance;
+        // estimated total distance (cost + distance)
+        unsigned estimate;
+        unsigned lastVisit = 0;
+        const Node* prev;
+        /// Direction to previous node, includes SHIP_DIR
+        RoadPathDirection dir;
+    };
+
+    const GameWorldBase& gwb_;
     unsigned currentVisit;
+    /// State of the road nodes indexed by their map position.
+    /// Stored per instance, so threads (e.g. the AIs) can search in parallel using their own path finders
+    std::vector<Node> nodes_;
+    /// Open list of the searches. Per instance so games in different threads don't share it
+    OpenListVector<Node*> openList_;
 
 public:
-    RoadPathFinder(GameWorldBase& gwb) : gwb_(gwb), currentVisit(0) {}
+    RoadPathFinder(const GameWorldBase& gwb) : gwb_(gwb), currentVisit(0) {}
+    void Init(const MapExtent& mapSize);
 
     /// Calculates the best path from start to goal
     /// Outputs are only valid if true is returned!
@@ -43,7 +69,56 @@ public:
     bool PathExists(const noRoadNode& start, const noRoadNode& goal, bool allowWaterRoads,
                     unsigned max = std::numeric_limits<unsigned>::max(), const RoadSegment* forbidden = nullptr);
 
+    /// Calculates the costs of ware paths (FindPath with wareMode=true) from one start to multiple goals.
+    /// The first goal is searched directly. For further goals the road network is expanded from the start in order of
+    /// the costs, reusing the nodes expanded for previous goals, instead of doing a full search per goal.
+    /// The expansion is restarted if the path finder was used otherwise in between.
+    /// The road network must not change while this is used.
+    class WarePathCosts
+    {
+    public:
+        WarePathCosts(RoadPathFinder& pathFinder, const noRoadNode& start);
+
+        /// Return true if there is a path to the goal with costs of at most max and store the costs in length.
+        /// Same result as FindPath(start, goal, true, max, nullptr, &length)
+        bool FindPath(const noRoadNode& goal, unsigned max, unsigned& length);
+
+    private:
+        struct QueueEntry
+        {
+            unsigned cost;
+            const noRoadNode* node;
+            bool operator>(const QueueEntry& rhs) const { return cost > rhs.cost; }
+        };
+        /// Arrival at a harbor by ship
+        struct ShipArrival
+        {
+            unsigned cost;
+            const noRoadNode* from;
+            const noRoadNode* dest;
+        };
+
+        /// Expand all nodes reachable with costs of at most maxCosts
+        void ExpandUntil(unsigned maxCosts);
+        void AddNode(const noRoadNode& node, unsigned cost);
+        bool IsExpanded(const noRoadNode& node) const;
+
+        RoadPathFinder& pf_;
+        const noRoadNode& start_;
+        bool searchedDirectly_ = false;
+        /// Visit IDs for nodes that have been found and those that have been expanded with their final costs.
+        /// The expansion is valid as long as expandedVisit_ is the current visit ID of the path finder
+        unsigned foundVisit_ = 0, expandedVisit_ = 0;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> todo_;
+        std::vector<ShipArrival> shipArrivals_;
+    };
+
 private:
+    /// Start a new search by increasing the visit counter. Returns the new value
+    unsigned StartNewVisit();
+    /// Return the search state of the road node
+    Node& GetNode(const noRoadNode& roadNode);
+
     template<class T_AdditionalCosts, class T_SegmentConstraints>
     bool FindPathImpl(const noRoadNode& start, const noRoadNode& goal, unsigned max, T_AdditionalCosts addCosts,
                       T_SegmentConstraints isSegmentAllowed, unsigned* length = nullptr,
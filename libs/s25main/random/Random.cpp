@@ -21,6 +21,13 @@ Random<T_PRNG>::Random()
     Init(123456789);
 }
 
+template<class T_PRNG>
+Random<T_PRNG>& Random<T_PRNG>::inst()
+{
+    thread_local Random instance;
+    return instance;
+}
+
 template<class T_PRNG>
 void Random<T_PRNG>::Init(const uint64_t& seed)
 {
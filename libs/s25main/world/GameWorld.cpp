@@ -28,6 +28,7 @@
 #include "pathfinding/PathConditionRoad.h"
 #include "postSystem/PostMsgWithBuilding.h"
 #include "world/MapGeometry.h"
+#include "world/SightSources.h"
 #include "world/TerritoryRegion.h"
 #include "nodeObjs/noFighting.h"
 #include "nodeObjs/noFlag.h"
@@ -1095,6 +1096,9 @@ bool GameWorld::IsScoutingFigureOnNode(const MapPoint& pt, unsigned player, unsi
 {
     static_assert(VISUALRANGE_SCOUT >= VISUALRANGE_SOLDIER, "Visual range changed. Check loop below!");
 
+    if(!MayHaveScoutingFigure(pt, player))
+        return false;
+
     // Späher/Soldaten in der Nähe prüfen und direkt auf dem Punkt
     for(const noBase& obj : GetFigures(pt))
     {
@@ -1140,13 +1144,13 @@ bool GameWorld::IsPointScoutedByShip(const MapPoint& pt, unsigned player) const
     return false;
 }
 
-void GameWorld::RecalcVisibility(const MapPoint pt, const unsigned char player, const noBaseBuilding* const exception)
+void GameWorld::RecalcVisibility(const MapPoint pt, const unsigned char player, const SightSources& sources)
 {
     /// Zustand davor merken
-    Visibility visibility_before = GetNode(pt).fow[player].visibility;
+    Visibility visibility_before = GetFoWNode(pt, player).visibility;
 
     /// Herausfinden, ob vollständig sichtbar
-    bool visible = IsPointCompletelyVisible(pt, player, exception);
+    bool visible = sources.IsVisible(pt);
 
     // Vollständig sichtbar --> vollständig sichtbar logischerweise
     if(visible)
@@ -1183,17 +1187,17 @@ void GameWorld::MakeVisible(const MapPoint pt, const unsigned char player)
 void GameWorld::RecalcVisibilitiesAroundPoint(const MapPoint pt, const MapCoord radius, const unsigned char player,
                                               const noBaseBuilding* const exception)
 {
-    std::vector<MapPoint> pts = GetPointsInRadiusWithCenter(pt, radius);
-    for(const MapPoint& pt : pts)
-        RecalcVisibility(pt, player, exception);
+    const SightSources sources(*this, player, exception);
+    VisitPointsInRadius(
+      pt, radius,
+      [this, player, &sources](const MapPoint curPt, unsigned) { RecalcVisibility(curPt, player, sources); }, true);
 }
 
 /// Setzt die Sichtbarkeiten um einen Punkt auf sichtbar (aus Performancegründen Alternative zu oberem)
 void GameWorld::MakeVisibleAroundPoint(const MapPoint pt, const MapCoord radius, const unsigned char player)
 {
-    std::vector<MapPoint> pts = GetPointsInRadiusWithCenter(pt, radius);
-    for(const MapPoint& curPt : pts)
-        MakeVisible(curPt, player);
+    VisitPointsInRadius(
+      pt, radius, [this, player](const MapPoint curPt, unsigned) { MakeVisible(curPt, player); }, true);
 }
 
 /// Bestimmt bei der Bewegung eines spähenden Objekts die Sichtbarkeiten an
@@ -1217,7 +1221,7 @@ void GameWorld::RecalcMovingVisibilities(const MapPoint pt, const unsigned char
         // Sichtbarkeit und für FOW-Gebiet vorherigen Besitzer merken
         // (d.h. der dort  zuletzt war, als es für Spieler player sichtbar war)
         Visibility old_vis = CalcVisiblityWithAllies(tt, player);
-        unsigned char old_owner = GetNode(tt).fow[player].owner;
+        unsigned char old_owner = GetFoWNode(tt, player).owner;
         MakeVisible(tt, player);
         // Neues feindliches Gebiet entdeckt?
         // Muss vorher undaufgedeckt oder FOW gewesen sein, aber in dem Fall darf dort vorher noch kein
@@ -1241,7 +1245,7 @@ void GameWorld::RecalcMovingVisibilities(const MapPoint pt, const unsigned char
         // Sichtbarkeit und für FOW-Gebiet vorherigen Besitzer merken
         // (d.h. der dort  zuletzt war, als es für Spieler player sichtbar war)
         Visibility old_vis = CalcVisiblityWithAllies(tt, player);
-        unsigned char old_owner = GetNode(tt).fow[player].owner;
+        unsigned char old_owner = GetFoWNode(tt, player).owner;
         MakeVisible(tt, player);
         // Neues feindliches Gebiet entdeckt?
         // Muss vorher undaufgedeckt oder FOW gewesen sein, aber in dem Fall darf dort vorher noch kein
@@ -1259,18 +1263,19 @@ void GameWorld::RecalcMovingVisibilities(const MapPoint pt, const unsigned char
 
     // Dasselbe für die zurückgebliebenen Punkte
     // Diese müssen allerdings neu berechnet werden!
+    const SightSources sources(*this, player, nullptr);
     t = pt;
     Direction anti_moving_dir = moving_dir + 3u;
     for(MapCoord i = 0; i < radius + 1; ++i)
         t = GetNeighbour(t, anti_moving_dir);
 
-    RecalcVisibility(t, player, nullptr);
+    RecalcVisibility(t, player, sources);
     tt = t;
     dir = anti_moving_dir + 2u;
     for(MapCoord i = 0; i < radius; ++i)
     {
         tt = GetNeighbour(tt, dir);
-        RecalcVisibility(tt, player, nullptr);
+        RecalcVisibility(tt, player, sources);
     }
 
     tt = t;
@@ -1278,7 +1283,7 @@ void GameWorld::RecalcMovingVisibilities(const MapPoint pt, const unsigned char
     for(unsigned i = 0; i < radius; ++i)
     {
         tt = GetNeighbour(tt, dir);
-        RecalcVisibility(tt, player, nullptr);
+        RecalcVisibility(tt, player, sources);
     }
 }
 
@@ -1425,6 +1430,11 @@ MapNode& GameWorld::GetNodeWriteable(const MapPoint pt)
     return GetNodeInt(pt);
 }
 
+FoWNode& GameWorld::GetFoWNodeWriteable(const MapPoint pt, const unsigned player)
+{
+    return GetFoWNodeInt(pt, player);
+}
+
 void GameWorld::VisibilityChanged(const MapPoint pt, unsigned player, Visibility oldVis, Visibility newVis)
 {
     GameWorldBase::VisibilityChanged(pt, player, oldVis, newVis);
@@ -19,6 +19,7 @@ class nofActiveSoldier;
 class nofAttacker;
 struct PlayerInfo;
 class RoadSegment;
+class SightSources;
 class TerritoryRegion;
 
 enum class TerritoryChangeReason
@@ -37,16 +38,16 @@ class GameWorld : public GameWorldBase
     /// Return if there are deco-objects that can be removed when building roads
     bool HasRemovableObjForRoad(MapPoint pt) const;
 
-    bool IsPointCompletelyVisible(const MapPoint& pt, unsigned char player, const noBaseBuilding* exception) const;
+    friend class SightSources;
+
     /// Return if there is a scout (or an attacking soldier) of this player at that node with a visual range of at most
     /// the given distance. Excludes scouting ships!
     bool IsScoutingFigureOnNode(const MapPoint& pt, unsigned player, unsigned distance) const;
     /// Return true, if the point is explored by any ship of the player
     bool IsPointScoutedByShip(const MapPoint& pt, unsigned player) const;
     /// Berechnet die Sichtbarkeit eines Punktes neu für den angegebenen Spieler
-    /// exception ist ein Gebäude (Spähturm, Militärgebäude), was nicht mit in die Berechnung einbezogen
-    /// werden soll, z.b. weil es abgerissen wird
-    void RecalcVisibility(MapPoint pt, unsigned char player, const noBaseBuilding* exception);
+    /// using the given sight sources
+    void RecalcVisibility(MapPoint pt, unsigned char player, const SightSources& sources);
     /// Setzt Punkt auf jeden Fall auf sichtbar
     void MakeVisible(MapPoint pt, unsigned char player);
 
@@ -133,6 +134,11 @@ public:
     /// Is this point a valid point for the given soldier to fight?
     bool IsValidPointForFighting(MapPoint pt, const nofActiveSoldier& soldier, bool avoid_military_building_flags);
 
+    /// Return true if the point is visible for the player due to any building, figure or ship of it.
+    /// exception ist ein Gebäude (Spähturm, Militärgebäude), was nicht mit in die Berechnung einbezogen
+    /// werden soll, z.b. weil es abgerissen wird.
+    /// Use SightSources to check many points of a region
+    bool IsPointCompletelyVisible(const MapPoint& pt, unsigned char player, const noBaseBuilding* exception) const;
     /// Berechnet die Sichtbarkeiten neu um einen Punkt mit radius
     void RecalcVisibilitiesAroundPoint(MapPoint pt, MapCoord radius, unsigned char player,
                                        const noBaseBuilding* exception);
@@ -170,6 +176,8 @@ public:
 
     /// Writeable access to node. Use only for initial map setup!
     MapNode& GetNodeWriteable(MapPoint pt);
+    /// Writeable access to the FoW state of a node. Use only for initial map setup!
+    FoWNode& GetFoWNodeWriteable(MapPoint pt, unsigned player);
     /// Recalculates where border stones should be done after a change in the given region
     void RecalcBorderStones(Position startPt, Extent areaSize);
 
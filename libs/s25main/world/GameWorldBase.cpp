@@ -20,6 +20,9 @@
 #include "notifications/NodeNote.h"
 #include "notifications/PlayerNodeNote.h"
 #include "pathfinding/FreePathFinder.h"
+#include "pathfinding/HierarchicalPathFinder.h"
+#include "pathfinding/PathConditionHuman.h"
+#include "pathfinding/PathConditionShip.h"
 #include "pathfinding/RoadPathFinder.h"
 #include "nodeObjs/noFlag.h"
 #include "gameData/BuildingProperties.h"
@@ -28,8 +31,11 @@
 #include <utility>
 
 GameWorldBase::GameWorldBase(std::vector<GamePlayer> players, const GlobalGameSettings& gameSettings, EventManager& em)
-    : roadPathFinder(new RoadPathFinder(*this)), freePathFinder(new FreePathFinder(*this)), players(std::move(players)),
-      gameSettings(gameSettings), em(em), soundManager(std::make_unique<SoundManager>()), lua(nullptr), gi(nullptr)
+    : World(players.size()), roadPathFinder(new RoadPathFinder(*this)), freePathFinder(new FreePathFinder(*this)),
+      humanPathFinder(std::make_unique<HierarchicalPathFinder<PathConditionHuman>>(*this, PathConditionHuman(*this))),
+      shipPathFinder(std::make_unique<HierarchicalPathFinder<PathConditionShip>>(*this, PathConditionShip(*this))),
+      players(std::move(players)), gameSettings(gameSettings), em(em), soundManager(std::make_unique<SoundManager>()),
+      lua(nullptr), gi(nullptr)
 {}
 
 GameWorldBase::~GameWorldBase() = default;
@@ -38,7 +44,10 @@ void GameWorldBase::Init(const MapExtent& mapSize, DescIdx<LandscapeDesc> lt)
 {
     RTTR_Assert(GetDescription().terrain.size() > 0); // Must have game data initialized
     World::Init(mapSize, lt);
+    roadPathFinder->Init(mapSize);
     freePathFinder->Init(mapSize);
+    humanPathFinder->Init(mapSize);
+    shipPathFinder->Init(mapSize);
 }
 
 void GameWorldBase::InitAfterLoad()
@@ -268,6 +277,12 @@ void GameWorldBase::AltitudeChanged(const MapPoint pt)
     GetNotifications().publish(NodeNote(NodeNote::Altitude, pt));
 }
 
+void GameWorldBase::PassabilityChanged(const MapPoint pt)
+{
+    // Ships only depend on the terrain
+    humanPathFinder->MarkChanged(pt);
+}
+
 void GameWorldBase::RecalcBQAroundPoint(const MapPoint pt)
 {
     RecalcBQ(pt);
@@ -286,8 +301,7 @@ void GameWorldBase::RecalcBQAroundPointBig(const MapPoint pt)
 
 Visibility GameWorldBase::CalcVisiblityWithAllies(const MapPoint pt, const unsigned char player) const
 {
-    const MapNode& node = GetNode(pt);
-    Visibility best_visibility = node.fow[player].visibility;
+    Visibility best_visibility = GetFoWNode(pt, player).visibility;
 
     if(best_visibility == Visibility::Visible)
         return best_visibility;
@@ -301,8 +315,9 @@ Visibility GameWorldBase::CalcVisiblityWithAllies(const MapPoint pt, const unsig
         {
             if(i != player && curPlayer.IsAlly(i))
             {
-                if(node.fow[i].visibility > best_visibility)
-                    best_visibility = node.fow[i].visibility;
+                const Visibility allyVisibility = GetFoWNode(pt, i).visibility;
+                if(allyVisibility > best_visibility)
+                    best_visibility = allyVisibility;
             }
         }
     }
@@ -699,8 +714,8 @@ void GameWorldBase::RecalcBQ(const MapPoint pt)
 
 void GameWorldBase::SetComputerBarrier(const MapPoint& pt, unsigned radius)
 {
-    for(const auto& pt : GetPointsInRadiusWithCenter(pt, radius))
-        ptsInsideComputerBarriers.insert(pt);
+    VisitPointsInRadius(
+      pt, radius, [this](const MapPoint curPt, unsigned) { ptsInsideComputerBarriers.insert(curPt); }, true);
 }
 
 bool GameWorldBase::IsInsideComputerBarrier(const MapPoint& pt) const
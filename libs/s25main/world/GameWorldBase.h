@@ -21,10 +21,14 @@ class FreePathFinder;
 class GameInterface;
 class GamePlayer;
 class GlobalGameSettings;
+template<class TNodeChecker>
+class HierarchicalPathFinder;
 class nobHarborBuilding;
 class noBuildingSite;
 class noFlag;
 class nofPassiveSoldier;
+struct PathConditionHuman;
+struct PathConditionShip;
 class RoadPathFinder;
 class SoundManager;
 class TradePathCache;
@@ -52,6 +56,9 @@ class GameWorldBase : public World
 {
     std::unique_ptr<RoadPathFinder> roadPathFinder;
     std::unique_ptr<FreePathFinder> freePathFinder;
+    /// Used for long paths if the addon is enabled
+    std::unique_ptr<HierarchicalPathFinder<PathConditionHuman>> humanPathFinder;
+    std::unique_ptr<HierarchicalPathFinder<PathConditionShip>> shipPathFinder;
     PostManager postManager;
     mutable NotificationManager notifications;
 
@@ -112,6 +119,10 @@ public:
     helpers::OptionalEnum<Direction> FindHumanPath(MapPoint start, MapPoint dest, unsigned max_route = 0xFFFFFFFF,
                                                    bool random_route = false, unsigned* length = nullptr,
                                                    std::vector<Direction>* route = nullptr) const;
+    /// Returns the lengths of the paths FindHumanPath finds from start to each of the targets using a single search.
+    /// See FreePathFinder::FindPathLengths
+    std::vector<unsigned> FindHumanPathLengths(MapPoint start, const std::vector<MapPoint>& targets,
+                                               unsigned max_route, unsigned maxHits = 0xFFFFFFFF) const;
     /// Find path for ships to a specific harbor and see. Return true on success
     bool FindShipPathToHarbor(MapPoint start, unsigned harborId, unsigned seaId, std::vector<Direction>* route,
                               unsigned* length);
@@ -224,6 +235,8 @@ protected:
     void VisibilityChanged(MapPoint pt, unsigned player, Visibility oldVis, Visibility newVis) override;
     /// Called, when the altitude of a point was changed
     void AltitudeChanged(MapPoint pt) override;
+    /// Called when the object or a road of a point was changed
+    void PassabilityChanged(MapPoint pt) override;
 
 private:
     /// Returns the harbor ID of the next matching harbor in the given direction (0 = None)
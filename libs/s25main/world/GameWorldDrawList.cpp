@@ -0,0 +1,283 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "world/GameWorldDrawList.h"
+#include "MapGeometry.h"
+#include "RTTR_Assert.h"
+#include "world/GameWorldBase.h"
+#include "world/GameWorldView.h"
+#include "world/GameWorldViewer.h"
+#include "nodeObjs/noMovable.h"
+#include "gameTypes/FoWNode.h"
+#include "gameTypes/MapNode.h"
+#include "gameData/MapConsts.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <utility>
+
+namespace {
+/// Minimum number of nodes in the view to use multiple threads
+constexpr int minNodesForThreads = 4096;
+/// Only nodes closer than this to the mouse can be selected
+constexpr int maxSelPtDistance = 100000;
+
+/// Same as TerrainRenderer::ConvertCoords but only needs the world
+MapPoint convertCoords(const GameWorldBase& world, const Position pt, Position& offset)
+{
+    const MapPoint ptOut = world.MakeMapPoint(pt);
+    offset = (pt - ptOut) * Extent(TR_W, TR_H);
+    return ptOut;
+}
+
+DrawListEntry makeEntry(DrawListEntryType type, const MapPoint pt, const DrawPoint pos, noBase* obj = nullptr,
+                        Visibility visibility = Visibility::Visible)
+{
+    return DrawListEntry{type, visibility, pt, pos, obj, nullptr};
+}
+} // namespace
+
+void GameWorldDrawList::clear()
+{
+    entries.clear();
+    selPt = MapPoint(0, 0);
+    selPtOffset = Position(0, 0);
+    selPtDistance = maxSelPtDistance;
+}
+
+bool GameWorldDrawList::hasSelPt() const
+{
+    return selPtDistance < maxSelPtDistance;
+}
+
+GameWorldDrawListBuilder::GameWorldDrawListBuilder()
+    : numThreads_(std::min(4u, std::max(1u, std::thread::hardware_concurrency()))), view_(nullptr), firstRow_(0),
+      lastRow_(0), numBands_(0), buildId_(0), stop_(false), nextBand_(0), numPendingBands_(0)
+{}
+
+GameWorldDrawListBuilder::~GameWorldDrawListBuilder()
+{
+    StopWorkers();
+}
+
+void GameWorldDrawListBuilder::SetNumThreads(unsigned numThreads)
+{
+    numThreads = std::max(1u, numThreads);
+    if(numThreads == numThreads_)
+        return;
+    StopWorkers();
+    numThreads_ = numThreads;
+}
+
+void GameWorldDrawListBuilder::StartWorkers()
+{
+    RTTR_Assert(workers_.empty());
+    // The calling thread works too
+    workers_.reserve(numThreads_ - 1);
+    for(unsigned i = 1; i < numThreads_; i++)
+        workers_.emplace_back([this]() { WorkerMain(); });
+}
+
+void GameWorldDrawListBuilder::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    startCond_.notify_all();
+    for(std::thread& worker : workers_)
+        worker.join();
+    workers_.clear();
+    stop_ = false;
+}
+
+void GameWorldDrawListBuilder::Build(const GameWorldView& view, const Position& mousePos, GameWorldDrawList& result)
+{
+    view_ = &view;
+    mousePos_ = mousePos;
+    firstRow_ = view.GetFirstPt().y;
+    lastRow_ = view.GetLastPt().y;
+    result.clear();
+
+    const int numRows = lastRow_ - firstRow_ + 1;
+    const int numNodes = numRows * (view.GetLastPt().x - view.GetFirstPt().x + 1);
+    if(numThreads_ <= 1u || numNodes < minNodesForThreads || numRows < 2 * rowsPerBand)
+    {
+        BuildRows(firstRow_, lastRow_, result);
+        return;
+    }
+
+    if(workers_.empty())
+        StartWorkers();
+    const size_t numBands = (numRows + rowsPerBand - 1) / rowsPerBand;
+    if(bandLists_.size() < numBands)
+        bandLists_.resize(numBands);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        numBands_ = numBands;
+        nextBand_ = 0;
+        numPendingBands_ = numBands;
+        error_ = nullptr;
+        ++buildId_;
+    }
+    startCond_.notify_all();
+    ProcessBands();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        doneCond_.wait(lock, [this]() { return numPendingBands_ == 0u; });
+        if(error_)
+            std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+    // Merge in order of the rows. On equal distance the first node is selected as when building in one go
+    for(size_t i = 0; i < numBands; i++)
+    {
+        const GameWorldDrawList& bandList = bandLists_[i];
+        result.entries.insert(result.entries.end(), bandList.entries.begin(), bandList.entries.end());
+        if(bandList.selPtDistance < result.selPtDistance)
+        {
+            result.selPt = bandList.selPt;
+            result.selPtOffset = bandList.selPtOffset;
+            result.selPtDistance = bandList.selPtDistance;
+        }
+    }
+}
+
+void GameWorldDrawListBuilder::WorkerMain()
+{
+    unsigned lastBuildId = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(true)
+    {
+        startCond_.wait(lock, [&]() { return stop_ || buildId_ != lastBuildId; });
+        if(stop_)
+            break;
+        lastBuildId = buildId_;
+        lock.unlock();
+        ProcessBands();
+        lock.lock();
+    }
+}
+
+void GameWorldDrawListBuilder::ProcessBands()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(nextBand_ < numBands_)
+    {
+        const size_t band = nextBand_++;
+        lock.unlock();
+        std::exception_ptr error;
+        try
+        {
+            GameWorldDrawList& bandList = bandLists_[band];
+            bandList.clear();
+            const int firstRow = firstRow_ + static_cast<int>(band) * rowsPerBand;
+            BuildRows(firstRow, std::min(firstRow + rowsPerBand - 1, lastRow_), bandList);
+        } catch(...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if(error && !error_)
+            error_ = error;
+        RTTR_Assert(numPendingBands_ > 0u);
+        if(--numPendingBands_ == 0u)
+            doneCond_.notify_one();
+    }
+}
+
+void GameWorldDrawListBuilder::BuildRows(int firstRow, int lastRow, GameWorldDrawList& result) const
+{
+    const GameWorldView& view = *view_;
+    const GameWorldViewer& gwv = view.GetViewer();
+    const GameWorldBase& world = view.GetWorld();
+    const DrawPoint offset = view.GetOffset();
+    const int firstCol = view.GetFirstPt().x;
+    const int lastCol = view.GetLastPt().x;
+    const bool showBQ = view.IsShowingBQ();
+    const bool hasNodeCallbacks = view.HasDrawNodeCallbacks();
+
+    // Figures which are drawn after the row as they walk between this and the next one
+    std::vector<DrawListEntry> betweenLines;
+    for(int y = firstRow; y <= lastRow; ++y)
+    {
+        betweenLines.clear();
+        for(int x = firstCol; x <= lastCol; ++x)
+        {
+            Position curOffset;
+            const MapPoint curPt = convertCoords(world, Position(x, y), curOffset);
+            const DrawPoint curPos = world.GetNodePos(curPt) - offset + curOffset;
+
+            Position mouseDist = mousePos_ - curPos;
+            mouseDist *= mouseDist;
+            if(std::abs(mouseDist.x) + std::abs(mouseDist.y) < result.selPtDistance)
+            {
+                result.selPt = curPt;
+                result.selPtOffset = curOffset;
+                result.selPtDistance = std::abs(mouseDist.x) + std::abs(mouseDist.y);
+            }
+
+            const Visibility visibility = gwv.GetVisibility(curPt);
+            if(visibility != Visibility::Invisible)
+            {
+                const BoundaryStones& boundaryStones = visibility == Visibility::FogOfWar ?
+                                                         gwv.GetYoungestFOWNode(curPt).boundary_stones :
+                                                         world.GetNode(curPt).boundary_stones;
+                if(boundaryStones[BorderStonePos::OnPoint])
+                    result.entries.push_back(
+                      makeEntry(DrawListEntryType::BoundaryStone, curPt, curPos, nullptr, visibility));
+            }
+
+            if(visibility == Visibility::Visible)
+            {
+                if(noBase* obj = world.GetNode(curPt).obj)
+                    result.entries.push_back(makeEntry(DrawListEntryType::Object, curPt, curPos, obj));
+
+                // Figures moving towards this node from below
+                static const std::array<Direction, 2> aboveDirs = {{Direction::NorthEast, Direction::NorthWest}};
+                for(Direction dir : aboveDirs)
+                {
+                    Position figOffset;
+                    const MapPoint figPt = convertCoords(world, GetNeighbour(Position(x, y), dir + 3u), figOffset);
+                    const DrawPoint figPos = world.GetNodePos(figPt) - offset + figOffset;
+                    for(noBase& figure : world.GetFigures(figPt))
+                    {
+                        if(figure.IsMoving() && static_cast<noMovable&>(figure).GetCurMoveDir() == dir)
+                            betweenLines.push_back(makeEntry(DrawListEntryType::Object, figPt, figPos, &figure));
+                    }
+                }
+
+                for(noBase& figure : world.GetFigures(curPt))
+                {
+                    if(figure.IsMoving())
+                    {
+                        // Drawn from above
+                        const Direction curMoveDir = static_cast<noMovable&>(figure).GetCurMoveDir();
+                        if(curMoveDir == Direction::NorthEast || curMoveDir == Direction::NorthWest)
+                            continue;
+                        betweenLines.push_back(makeEntry(DrawListEntryType::Object, curPt, curPos, &figure));
+                    } else if(figure.GetGOT() == GO_Type::Ship) // TODO: Why special handling for ships?
+                        betweenLines.push_back(makeEntry(DrawListEntryType::Object, curPt, curPos, &figure));
+                    else
+                        result.entries.push_back(makeEntry(DrawListEntryType::Object, curPt, curPos, &figure));
+                }
+
+                if(showBQ && gwv.GetBQ(curPt) != BuildingQuality::Nothing)
+                    result.entries.push_back(makeEntry(DrawListEntryType::ConstructionAid, curPt, curPos));
+            } else if(visibility == Visibility::FogOfWar)
+            {
+                if(const FOWObject* fowObj = gwv.GetYoungestFOWObject(curPt))
+                {
+                    DrawListEntry entry = makeEntry(DrawListEntryType::FOWObject, curPt, curPos);
+                    entry.fowObj = fowObj;
+                    result.entries.push_back(entry);
+                }
+            }
+
+            if(hasNodeCallbacks)
+                result.entries.push_back(makeEntry(DrawListEntryType::NodeCallbacks, curPt, curPos));
+        }
+        result.entries.insert(result.entries.end(), betweenLines.begin(), betweenLines.end());
+    }
+}
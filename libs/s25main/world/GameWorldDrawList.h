@@ -0,0 +1,120 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "DrawPoint.h"
+#include "gameTypes/MapCoordinates.h"
+#include "gameTypes/MapTypes.h"
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class FOWObject;
+class GameWorldView;
+class noBase;
+
+enum class DrawListEntryType : uint8_t
+{
+    /// Boundary stones of the node (only if it has any)
+    BoundaryStone,
+    /// Node object or figure in obj
+    Object,
+    /// Building quality icon (only if something can be built)
+    ConstructionAid,
+    /// Remembered object in fog of war in fowObj
+    FOWObject,
+    /// Call the IDrawNodeCallbacks of the view
+    NodeCallbacks
+};
+
+/// Something to draw at a position of the map view
+struct DrawListEntry
+{
+    DrawListEntryType type;
+    /// Visibility of the node (for boundary stones)
+    Visibility visibility;
+    MapPoint pt;
+    DrawPoint pos;
+    noBase* obj;
+    const FOWObject* fowObj;
+
+    bool operator==(const DrawListEntry& rhs) const
+    {
+        return type == rhs.type && visibility == rhs.visibility && pt == rhs.pt && pos == rhs.pos && obj == rhs.obj
+               && fowObj == rhs.fowObj;
+    }
+};
+
+/// Everything to draw on top of the terrain in the visible part of the map in the order it has to be drawn
+struct GameWorldDrawList
+{
+    std::vector<DrawListEntry> entries;
+    /// Node closest to the mouse and the offset of its drawing position (due to wrapping)
+    MapPoint selPt;
+    Position selPtOffset;
+    /// Squared distance of the mouse to selPt (in both coordinates summed up)
+    int selPtDistance;
+
+    void clear();
+    /// False if the mouse is too far away from all nodes
+    bool hasSelPt() const;
+};
+
+/// Creates the draw list of a GameWorldView. This only reads the world and does not use OpenGL, so the rows of the view
+/// can be processed in parallel. The worker threads are started when the view is big enough to make it worthwhile.
+class GameWorldDrawListBuilder
+{
+public:
+    GameWorldDrawListBuilder();
+    GameWorldDrawListBuilder(const GameWorldDrawListBuilder&) = delete;
+    GameWorldDrawListBuilder& operator=(const GameWorldDrawListBuilder&) = delete;
+    ~GameWorldDrawListBuilder();
+
+    /// Set the maximum number of threads used. 0 or 1 builds the list in the calling thread
+    void SetNumThreads(unsigned numThreads);
+    unsigned GetNumThreads() const { return numThreads_; }
+
+    /// Create the draw list for the current position of the view. mousePos is relative to the view
+    void Build(const GameWorldView& view, const Position& mousePos, GameWorldDrawList& result);
+
+private:
+    /// Rows of the view processed as one task
+    static constexpr int rowsPerBand = 4;
+
+    void StartWorkers();
+    void StopWorkers();
+    void WorkerMain();
+    /// Process bands of the current build until none is left
+    void ProcessBands();
+    void BuildRows(int firstRow, int lastRow, GameWorldDrawList& result) const;
+
+    unsigned numThreads_;
+    std::vector<std::thread> workers_;
+
+    /// Parameters of the current build
+    const GameWorldView* view_;
+    Position mousePos_;
+    int firstRow_, lastRow_;
+    /// Result of each band of the current build
+    std::vector<GameWorldDrawList> bandLists_;
+    size_t numBands_;
+
+    /// Protects all members below
+    std::mutex mutex_;
+    /// Signals the workers that a new build started or they should stop
+    std::condition_variable startCond_;
+    /// Signals the main thread that all bands are done
+    std::condition_variable doneCond_;
+    /// Increased for each new build
+    unsigned buildId_;
+    bool stop_;
+    size_t nextBand_;
+    size_t numPendingBands_;
+    /// First exception thrown during the current build
+    std::exception_ptr error_;
+};
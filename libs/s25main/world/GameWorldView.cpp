@@ -19,6 +19,7 @@
 #include "helpers/containerUtils.h"
 #include "helpers/toString.h"
 #include "ogl/FontStyle.h"
+#include "ogl/SpriteBatch.h"
 #include "ogl/glArchivItem_Bitmap.h"
 #include "ogl/glFont.h"
 #include "ogl/glSmartBitmap.h"
@@ -109,14 +110,6 @@ float GameWorldView::GetCurrentTargetZoomFactor() const
     return targetZoomFactor_;
 }
 
-struct ObjectBetweenLines
-{
-    noBase& obj;
-    DrawPoint pos; // Zeichenposition
-
-    ObjectBetweenLines(noBase& obj, const DrawPoint& pos) : obj(obj), pos(pos) {}
-};
-
 void GameWorldView::Draw(const RoadBuildState& rb, const MapPoint selected, bool drawMouse, unsigned* water)
 {
     SetNextZoomFactor();
@@ -127,7 +120,6 @@ void GameWorldView::Draw(const RoadBuildState& rb, const MapPoint selected, bool
     const auto screenSize = guiScale.viewToScreen(size_);
     glScissor(screenOrigin.x, windowSize.height - (screenOrigin.y + screenSize.y), screenSize.x, screenSize.y);
 
-    int shortestDistToMouse = 100000;
     Position mousePos = VIDEODRIVER.GetMousePos();
     mousePos -= Position(origin_);
     if(effectiveZoomFactor_ != 1.f) //-V550
@@ -152,55 +144,18 @@ void GameWorldView::Draw(const RoadBuildState& rb, const MapPoint selected, bool
     terrainRenderer.Draw(GetFirstPt(), GetLastPt(), gwv, water);
     glTranslatef(static_cast<GLfloat>(offset.x), static_cast<GLfloat>(offset.y), 0.0f);
 
-    for(int y = firstPt.y; y <= lastPt.y; ++y)
-    {
-        // Figuren speichern, die in dieser Zeile gemalt werden müssen
-        // und sich zwischen zwei Zeilen befinden, da sie dazwischen laufen
-        std::vector<ObjectBetweenLines> between_lines;
-
-        for(int x = firstPt.x; x <= lastPt.x; ++x)
-        {
-            Position curOffset;
-            const MapPoint curPt = terrainRenderer.ConvertCoords(Position(x, y), &curOffset);
-            DrawPoint curPos = GetWorld().GetNodePos(curPt) - offset + curOffset;
-
-            Position mouseDist = mousePos - curPos;
-            mouseDist *= mouseDist;
-            if(std::abs(mouseDist.x) + std::abs(mouseDist.y) < shortestDistToMouse)
-            {
-                selPt = curPt;
-                selPtOffset = curOffset;
-                shortestDistToMouse = std::abs(mouseDist.x) + std::abs(mouseDist.y);
-            }
-
-            Visibility visibility = gwv.GetVisibility(curPt);
+    // Most objects are sprites from few shared textures, so merge them into as few draw calls as possible
+    SpriteBatch& spriteBatch = VIDEODRIVER.GetSpriteBatch();
+    spriteBatch.Begin();
 
-            DrawBoundaryStone(curPt, curPos, visibility);
-
-            if(visibility == Visibility::Visible)
-            {
-                DrawObject(curPt, curPos);
-                DrawMovingFiguresFromBelow(terrainRenderer, Position(x, y), between_lines);
-                DrawFigures(curPt, curPos, between_lines);
-
-                // Construction aid mode
-                if(show_bq)
-                    DrawConstructionAid(curPt, curPos);
-            } else if(visibility == Visibility::FogOfWar)
-            {
-                const FOWObject* fowobj = gwv.GetYoungestFOWObject(MapPoint(curPt));
-                if(fowobj)
-                    fowobj->Draw(curPos);
-            }
-
-            for(IDrawNodeCallback* callback : drawNodeCallbacks)
-                callback->onDraw(curPt, curPos);
-        }
-
-        // Figuren zwischen den Zeilen zeichnen
-        for(auto& between_line : between_lines)
-            between_line.obj.Draw(between_line.pos);
+    // Finding the objects only reads the world, so it is done (in parallel) before issuing any GL calls
+    drawListBuilder_.Build(*this, mousePos, drawList_);
+    if(drawList_.hasSelPt())
+    {
+        selPt = drawList_.selPt;
+        selPtOffset = drawList_.selPtOffset;
     }
+    DrawObjects(drawList_);
 
     if(show_names || show_productivity)
         DrawNameProductivityOverlay(terrainRenderer);
@@ -215,6 +170,8 @@ void GameWorldView::Draw(const RoadBuildState& rb, const MapPoint selected, bool
             catapult_stone->Draw(offset);
     }
 
+    spriteBatch.End();
+
     if(effectiveZoomFactor_ != 1.f) //-V550
     {
         glMatrixMode(GL_PROJECTION);
@@ -439,48 +396,6 @@ void GameWorldView::DrawProductivity(const noBaseBuilding& no, const DrawPoint&
     }
 }
 
-void GameWorldView::DrawFigures(const MapPoint& pt, const DrawPoint& curPos,
-                                std::vector<ObjectBetweenLines>& between_lines) const
-{
-    for(noBase& figure : GetWorld().GetFigures(pt))
-    {
-        if(figure.IsMoving())
-        {
-            // Drawn from above
-            Direction curMoveDir = static_cast<noMovable&>(figure).GetCurMoveDir();
-            if(curMoveDir == Direction::NorthEast || curMoveDir == Direction::NorthWest)
-                continue;
-            // Draw later
-            between_lines.push_back(ObjectBetweenLines(figure, curPos));
-        } else if(figure.GetGOT() == GO_Type::Ship)
-            between_lines.push_back(ObjectBetweenLines(figure, curPos)); // TODO: Why special handling for ships?
-        else
-            // Ansonsten jetzt schon zeichnen
-            figure.Draw(curPos);
-    }
-}
-
-void GameWorldView::DrawMovingFiguresFromBelow(const TerrainRenderer& terrainRenderer, const DrawPoint& curPos,
-                                               std::vector<ObjectBetweenLines>& between_lines)
-{
-    // First draw figures moving towards this point from below
-    static const std::array<Direction, 2> aboveDirs = {{Direction::NorthEast, Direction::NorthWest}};
-    for(Direction dir : aboveDirs)
-    {
-        // Get figures opposite the current dir and check if they are moving in this dir
-        // Coordinates transform
-        Position curOffset;
-        MapPoint curPt = terrainRenderer.ConvertCoords(GetNeighbour(curPos, dir + 3u), &curOffset);
-        Position figPos = GetWorld().GetNodePos(curPt) - offset + curOffset;
-
-        for(noBase& figure : GetWorld().GetFigures(curPt))
-        {
-            if(figure.IsMoving() && static_cast<noMovable&>(figure).GetCurMoveDir() == dir)
-                between_lines.push_back(ObjectBetweenLines(figure, figPos));
-        }
-    }
-}
-
 constexpr auto getBqImgs()
 {
     helpers::EnumArray<unsigned, BuildingQuality> imgs{};
@@ -513,13 +428,22 @@ void GameWorldView::DrawConstructionAid(const MapPoint& pt, const DrawPoint& cur
     }
 }
 
-void GameWorldView::DrawObject(const MapPoint& pt, const DrawPoint& curPos) const
+void GameWorldView::DrawObjects(const GameWorldDrawList& drawList)
 {
-    noBase* obj = GetWorld().GetNode(pt).obj;
-    if(!obj)
-        return;
-
-    obj->Draw(curPos);
+    for(const DrawListEntry& entry : drawList.entries)
+    {
+        switch(entry.type)
+        {
+            case DrawListEntryType::BoundaryStone: DrawBoundaryStone(entry.pt, entry.pos, entry.visibility); break;
+            case DrawListEntryType::Object: entry.obj->Draw(entry.pos); break;
+            case DrawListEntryType::ConstructionAid: DrawConstructionAid(entry.pt, entry.pos); break;
+            case DrawListEntryType::FOWObject: entry.fowObj->Draw(entry.pos); break;
+            case DrawListEntryType::NodeCallbacks:
+                for(IDrawNodeCallback* callback : drawNodeCallbacks)
+                    callback->onDraw(entry.pt, entry.pos);
+                break;
+        }
+    }
 }
 
 void GameWorldView::DrawBoundaryStone(const MapPoint& pt, const DrawPoint pos, Visibility vis)
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "DrawPoint.h"
+#include "world/GameWorldDrawList.h"
 #include "gameTypes/MapCoordinates.h"
 #include "gameTypes/MapTypes.h"
 #include <boost/signals2.hpp>
@@ -26,8 +27,6 @@ public:
     virtual void onDraw(const MapPoint& pt, const DrawPoint& displayPt) = 0;
 };
 
-struct ObjectBetweenLines;
-
 class GameWorldView
 {
     /// Currently selected point (where the mouse points to)
@@ -67,6 +66,11 @@ class GameWorldView
     float targetZoomFactor_;
     float zoomSpeed_;
 
+    /// Creates the list of objects to draw, possibly in multiple threads
+    GameWorldDrawListBuilder drawListBuilder_;
+    /// List of the last frame, kept to reuse the memory
+    GameWorldDrawList drawList_;
+
 public:
     GameWorldView(const GameWorldViewer& gwv, const Position& pos, const Extent& size);
 
@@ -91,10 +95,17 @@ public:
     /// Toggle names and productivity completely on or off
     void ToggleShowNamesAndProductivity();
 
+    bool IsShowingBQ() const { return show_bq; }
+    bool HasDrawNodeCallbacks() const { return !drawNodeCallbacks.empty(); }
+
     /// Copy visibility of HUD elements from this view to another
     void CopyHudSettingsTo(GameWorldView& other, bool copyBQ) const;
 
     void Draw(const RoadBuildState& rb, MapPoint selected, bool drawMouse, unsigned* water = nullptr);
+    /// Set the maximum number of threads used to find the objects to draw
+    void SetNumDrawThreads(unsigned numThreads) { drawListBuilder_.SetNumThreads(numThreads); }
+    /// Objects drawn in the last frame in drawing order
+    const GameWorldDrawList& GetDrawList() const { return drawList_; }
 
     /// Moves the map view by the given offset in pixels
     void MoveBy(const DrawPoint& numPixels);
@@ -127,11 +138,9 @@ public:
 private:
     void CalcFxLx();
     void DrawBoundaryStone(const MapPoint& pt, DrawPoint pos, Visibility vis);
-    void DrawObject(const MapPoint& pt, const DrawPoint& curPos) const;
     void DrawConstructionAid(const MapPoint& pt, const DrawPoint& curPos);
-    void DrawFigures(const MapPoint& pt, const DrawPoint& curPos, std::vector<ObjectBetweenLines>& between_lines) const;
-    void DrawMovingFiguresFromBelow(const TerrainRenderer& terrainRenderer, const DrawPoint& curPos,
-                                    std::vector<ObjectBetweenLines>& between_lines);
+    /// Draw all entries of the draw list
+    void DrawObjects(const GameWorldDrawList& drawList);
 
     void DrawNameProductivityOverlay(const TerrainRenderer& terrainRenderer);
     void DrawProductivity(const noBaseBuilding& no, const DrawPoint& curPos);
@@ -6,6 +6,8 @@
 #include "commonDefines.h"
 #include "world/MapGeometry.h"
 #include "gameData/MapConsts.h"
+#include <algorithm>
+#include <cstdlib>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -15,6 +17,39 @@ unsigned MapBase::CreateGUIID(MapPoint pt)
     return pt.y * MAX_MAP_SIZE + pt.x;
 }
 
+namespace {
+std::vector<Position> createRadiusOffsets(const bool isOddRow)
+{
+    constexpr unsigned maxRadius = detail::maxPrecomputedRadius;
+    std::vector<Position> offsets;
+    offsets.reserve(3 * maxRadius * (maxRadius + 1));
+    // Walk the rings the same way as MapBase::VisitPointsInRadius does on the map
+    const Position center(0, isOddRow ? 1 : 0);
+    Position curStartPt = center;
+    for(unsigned r = 1; r <= maxRadius; ++r)
+    {
+        curStartPt = ::GetNeighbour(curStartPt, Direction::West);
+        Position curPt = curStartPt;
+        for(const auto dir : helpers::enumRange(Direction::NorthEast))
+        {
+            for(unsigned step = 0; step < r; ++step)
+            {
+                offsets.push_back(curPt - center);
+                curPt = ::GetNeighbour(curPt, dir);
+            }
+        }
+    }
+    return offsets;
+}
+} // namespace
+
+const std::vector<Position>& detail::GetRadiusOffsets(const bool isOddRow)
+{
+    static const std::array<std::vector<Position>, 2> offsets = {createRadiusOffsets(false),
+                                                                 createRadiusOffsets(true)};
+    return offsets[isOddRow ? 1 : 0];
+}
+
 MapBase::MapBase() : size_(MapExtent::all(0)) {}
 
 void MapBase::Resize(const MapExtent& newSize)
@@ -83,6 +118,60 @@ MapPoint MapBase::GetNeighbour(const MapPoint pt, const Direction dir) const
     return res;
 }
 
+std::vector<int> MapBase::SumValuesInRadius(const std::vector<int>& values, const unsigned radius) const
+{
+    RTTR_Assert(values.size() == prodOfComponents(size_));
+    const int width = size_.x;
+    const int height = size_.y;
+    // Prefix sums of the rows: rowSums[y * (width + 1) + x] is the sum of the first x values of row y
+    std::vector<int> rowSums(static_cast<size_t>(width + 1) * height);
+    for(int y = 0; y < height; ++y)
+    {
+        const int* rowValues = &values[static_cast<size_t>(y) * width];
+        int* rowSum = &rowSums[static_cast<size_t>(y) * (width + 1)];
+        rowSum[0] = 0;
+        for(int x = 0; x < width; ++x)
+            rowSum[x + 1] = rowSum[x] + rowValues[x];
+    }
+
+    std::vector<int> result(values.size(), 0);
+    const int r = static_cast<int>(radius);
+    for(int y = 0; y < height; ++y)
+    {
+        const bool isOddRow = (y & 1) != 0;
+        int* resultRow = &result[static_cast<size_t>(y) * width];
+        // The points in the radius are 2r+1-|dy| consecutive points in each row y+dy, |dy| <= r.
+        // Every 2nd row is shifted to the left, so the start depends on the parity of the row
+        for(int dy = -r; dy <= r; ++dy)
+        {
+            const int absDy = std::abs(dy);
+            const int first = -r + (isOddRow ? (absDy + 1) / 2 : absDy / 2);
+            const int length = 2 * r + 1 - absDy;
+            const int* rowSum = &rowSums[static_cast<size_t>(((y + dy) % height + height) % height) * (width + 1)];
+            // A window wider than the map contains the whole row (multiple times)
+            const int fullRowsSum = (length / width) * rowSum[width];
+            const int partLength = length % width;
+            const auto addWrapped = [&](const int x) {
+                const int start = ((x + first) % width + width) % width;
+                const int end = start + partLength;
+                resultRow[x] += fullRowsSum
+                                + (end <= width ? rowSum[end] - rowSum[start] :
+                                                  rowSum[width] - rowSum[start] + rowSum[end - width]);
+            };
+            // Only the window of points close to the left or right border wraps around
+            const int xBegin = std::clamp(-first, 0, width);
+            const int xEnd = std::clamp(width - first - partLength, xBegin, width);
+            for(int x = 0; x < xBegin; ++x)
+                addWrapped(x);
+            for(int x = xBegin; x < xEnd; ++x)
+                resultRow[x] += fullRowsSum + rowSum[x + first + partLength] - rowSum[x + first];
+            for(int x = xEnd; x < width; ++x)
+                addWrapped(x);
+        }
+    }
+    return result;
+}
+
 MapPoint MapBase::GetNeighbour2(const MapPoint pt, unsigned dir) const
 {
     return MakeMapPoint(::GetNeighbour2(Position(pt), dir));
@@ -11,6 +11,7 @@
 #include "gameTypes/MapCoordinates.h"
 #include "gameTypes/ShipDirection.h"
 #include <array>
+#include <type_traits>
 #include <vector>
 
 struct AlwaysTrue
@@ -28,7 +29,26 @@ struct ReturnMapPoint
 namespace detail {
 template<typename T_TransformPt>
 using GetPointsResult_t = std::vector<decltype(std::declval<T_TransformPt>()(MapPoint{}, unsigned{}))>;
+
+/// Maximum radius for which the offsets of the points around a node are precomputed
+constexpr unsigned maxPrecomputedRadius = 32;
+/// Return the offsets of the points around a node in an even or odd row (excluding the node itself) in the order
+/// they are visited by MapBase::VisitPointsInRadius. The 6 * r offsets of radius r start at index 3 * r * (r - 1)
+const std::vector<Position>& GetRadiusOffsets(bool isOddRow);
+
+/// Call the functor and return its result if it returns a bool, else false
+template<class T_Func>
+bool visitPoint(T_Func& func, MapPoint pt, unsigned radius)
+{
+    if constexpr(std::is_same_v<decltype(func(pt, radius)), bool>)
+        return func(pt, radius);
+    else
+    {
+        func(pt, radius);
+        return false;
+    }
 }
+} // namespace detail
 
 /// Base class for a map. A map has a size and functions for getting from one point to another in that map
 class MapBase
@@ -88,6 +108,15 @@ public:
     /// If includePt is true, then the point itself is also checked
     template<class T_IsValidPt>
     bool CheckPointsInRadius(MapPoint pt, unsigned radius, T_IsValidPt&& isValid, bool includePt) const;
+    /// Call func(point, radius) for all points in the radius around pt (and pt itself with radius 0 if includePt is
+    /// true) in the order of GetPointsInRadius without creating a container.
+    /// If func returns a bool the iteration stops once it returns true. Returns true iff it was stopped
+    template<class T_Func>
+    bool VisitPointsInRadius(MapPoint pt, unsigned radius, T_Func&& func, bool includePt = false) const;
+    /// Return the sum of the values of all points in the radius around each point (including the point itself).
+    /// Values and results are indexed by GetIdx. Equal to summing over GetPointsInRadiusWithCenter for each point, but
+    /// uses prefix sums of the rows so the cost per point is linear instead of quadratic in the radius
+    std::vector<int> SumValuesInRadius(const std::vector<int>& values, unsigned radius) const;
 
     /// Return the distance between 2 points on the map (includes wrapping around map borders)
     unsigned CalcDistance(const Position& p1, const Position& p2) const;
@@ -129,38 +158,16 @@ detail::GetPointsResult_t<T_TransformPt> MapBase::GetPointsInRadius(const MapPoi
         // center point if requested This can be reduced via the gauss formula to the following:
         result.reserve((radius * radius + radius) * 3u + (includePt ? 1u : 0u));
     }
-    if(includePt)
-    {
-        const auto el = transformPt(pt, 0);
-        if(isValid(el))
-        {
-            result.push_back(el);
-            if(T_maxResults == 1)
-                return result;
-        }
-    }
-    MapPoint curStartPt = pt;
-    for(unsigned r = 1; r <= radius; ++r)
-    {
-        // Go one level/hull to the left
-        curStartPt = GetNeighbour(curStartPt, Direction::West);
-        // Now iterate over the "circle" of radius r by going r steps in one direction, turn right and repeat
-        MapPoint curPt = curStartPt;
-        for(const auto dir : helpers::enumRange(Direction::NorthEast))
-        {
-            for(unsigned step = 0; step < r; ++step)
-            {
-                const auto el = transformPt(curPt, r);
-                if(isValid(el))
-                {
-                    result.push_back(el);
-                    if(T_maxResults > 0 && static_cast<int>(result.size()) >= T_maxResults)
-                        return result;
-                }
-                curPt = GetNeighbour(curPt, dir);
-            }
-        }
-    }
+    VisitPointsInRadius(
+      pt, radius,
+      [&](const MapPoint curPt, const unsigned r) {
+          const auto el = transformPt(curPt, r);
+          if(!isValid(el))
+              return false;
+          result.push_back(el);
+          return T_maxResults > 0 && static_cast<int>(result.size()) >= T_maxResults;
+      },
+      includePt);
     return result;
 }
 
@@ -168,8 +175,32 @@ template<class T_IsValidPt>
 inline bool MapBase::CheckPointsInRadius(const MapPoint pt, unsigned radius, T_IsValidPt&& isValid,
                                          bool includePt) const
 {
-    if(includePt && isValid(pt, 0))
+    return VisitPointsInRadius(
+      pt, radius, [&isValid](const MapPoint curPt, const unsigned r) -> bool { return isValid(curPt, r); },
+      includePt);
+}
+
+template<class T_Func>
+bool MapBase::VisitPointsInRadius(const MapPoint pt, const unsigned radius, T_Func&& func, const bool includePt) const
+{
+    if(includePt && detail::visitPoint(func, pt, 0))
         return true;
+    // Use the precomputed offsets if no point wraps around the map border
+    if(radius <= detail::maxPrecomputedRadius && pt.x >= radius && pt.y >= radius && pt.x + radius < size_.x
+       && pt.y + radius < size_.y)
+    {
+        const Position* offset = detail::GetRadiusOffsets((pt.y & 1) != 0).data();
+        for(unsigned r = 1; r <= radius; ++r)
+        {
+            for(const Position* ringEnd = offset + 6 * r; offset != ringEnd; ++offset)
+            {
+                const MapPoint curPt(static_cast<MapCoord>(pt.x + offset->x), static_cast<MapCoord>(pt.y + offset->y));
+                if(detail::visitPoint(func, curPt, r))
+                    return true;
+            }
+        }
+        return false;
+    }
     MapPoint curStartPt = pt;
     for(unsigned r = 1; r <= radius; ++r)
     {
@@ -181,7 +212,7 @@ inline bool MapBase::CheckPointsInRadius(const MapPoint pt, unsigned radius, T_I
         {
             for(unsigned step = 0; step < r; ++step)
             {
-                if(isValid(curPt, r))
+                if(detail::visitPoint(func, curPt, r))
                     return true;
                 curPt = GetNeighbour(curPt, dir);
             }
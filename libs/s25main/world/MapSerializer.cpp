@@ -5,6 +5,7 @@
 #include "world/MapSerializer.h"
 #include "CatapultStone.h"
 #include "Game.h"
+#include "RttrForeachPt.h"
 #include "SerializedGameData.h"
 #include "buildings/noBuildingSite.h"
 #include "helpers/Range.h"
@@ -23,9 +24,12 @@ void MapSerializer::Serialize(const GameWorldBase& world, SerializedGameData& sg
 
     // Alle Weltpunkte serialisieren
     const unsigned numPlayers = world.GetNumPlayers();
-    for(const auto& node : world.nodes)
+    RTTR_FOREACH_PT(MapPoint, world.GetSize())
     {
-        node.Serialize(sgd, numPlayers, world.GetDescription());
+        world.GetNode(pt).Serialize(sgd, world.GetDescription(), [&world, &sgd, numPlayers, pt]() {
+            for(unsigned player = 0; player < numPlayers; ++player)
+                world.GetFoWNode(pt, player).Serialize(sgd);
+        });
     }
 
     // Katapultsteine serialisieren
@@ -114,7 +118,12 @@ void MapSerializer::Deserialize(GameWorldBase& world, SerializedGameData& sgd, G
     const unsigned numPlayers = world.GetNumPlayers();
     for(auto& node : world.nodes)
     {
-        node.Deserialize(sgd, numPlayers, world.GetDescription(), landscapeTerrains);
+        node.Deserialize(sgd, world.GetDescription(), landscapeTerrains, [&world, &sgd, numPlayers, curPos]() {
+            for(unsigned player = 0; player < numPlayers; ++player)
+                world.GetFoWNodeInt(curPos, player).Deserialize(sgd);
+        });
+        for(const noBase& figure : world.GetFigures(curPos))
+            world.UpdateNumScoutingFigures(curPos, figure, true);
         if(node.harborId)
         {
             HarborPos p(curPos);
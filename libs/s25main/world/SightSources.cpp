@@ -0,0 +1,81 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "world/SightSources.h"
+#include "GamePlayer.h"
+#include "buildings/noBuildingSite.h"
+#include "buildings/nobMilitary.h"
+#include "buildings/nobUsual.h"
+#include "helpers/containerUtils.h"
+#include "world/GameWorld.h"
+#include "nodeObjs/noShip.h"
+#include "gameData/MilitaryConsts.h"
+#include <algorithm>
+
+namespace {
+/// Range in which scouts and soldiers on a node are checked. Soldiers see less than scouts
+constexpr unsigned figureRange = std::max(VISUALRANGE_SCOUT, VISUALRANGE_SOLDIER);
+} // namespace
+
+SightSources::SightSources(const GameWorld& world, const unsigned char player, const noBaseBuilding* const exception)
+    : world_(world), player_(player), exception_(exception)
+{
+    for(const noBuildingSite* bldSite : world.harbor_building_sites_from_sea)
+    {
+        if(bldSite->GetPlayer() == player && bldSite != exception)
+            sources_.push_back(Source{bldSite->GetPos(), HARBOR_RADIUS + VISUALRANGE_MILITARY});
+    }
+    const GamePlayer& owner = world.GetPlayer(player);
+    for(const nobUsual* bld : owner.GetBuildingRegister().GetBuildings(BuildingType::LookoutTower))
+    {
+        if(bld->HasWorker() && bld != exception)
+            sources_.push_back(Source{bld->GetPos(), VISUALRANGE_LOOKOUTTOWER});
+    }
+    for(const noShip* ship : owner.GetShips())
+        sources_.push_back(Source{ship->GetPos(), ship->GetVisualRange()});
+}
+
+bool SightSources::IsVisible(const MapPoint pt) const
+{
+    const auto isInRange = [this, pt](const Source& source) {
+        return world_.CalcDistance(pt, source.pos) <= source.range;
+    };
+    return helpers::contains_if(GetMilitarySquare(pt).sources, isInRange) || helpers::contains_if(sources_, isInRange)
+           || IsVisibleByFigure(pt);
+}
+
+const SightSources::MilitarySquare& SightSources::GetMilitarySquare(const MapPoint pt) const
+{
+    // The military buildings found are the same for all points of a square
+    const MapPoint squarePt = pt / MILITARY_SQUARE_SIZE;
+    const auto it =
+      std::find_if(militarySquares_.begin(), militarySquares_.end(),
+                   [squarePt](const MilitarySquare& square) { return square.squarePt == squarePt; });
+    if(it != militarySquares_.end())
+        return *it;
+
+    militarySquares_.push_back(MilitarySquare{squarePt, {}});
+    std::vector<Source>& sources = militarySquares_.back().sources;
+    for(const nobBaseMilitary* milBld : world_.LookForMilitaryBuildings(pt, 3))
+    {
+        if(milBld->GetPlayer() != player_ || milBld == exception_)
+            continue;
+        // Unoccupied buildings don't see anything
+        if(milBld->GetGOT() == GO_Type::NobMilitary && static_cast<const nobMilitary*>(milBld)->IsNewBuilt())
+            continue;
+        sources.push_back(Source{milBld->GetPos(), milBld->GetMilitaryRadius() + VISUALRANGE_MILITARY});
+    }
+    return militarySquares_.back();
+}
+
+bool SightSources::IsVisibleByFigure(const MapPoint pt) const
+{
+    // Nodes without scouting figures are skipped using the counters of the world, so this is cheap for most nodes
+    return world_.CheckPointsInRadius(
+      pt, figureRange,
+      [this](const MapPoint curPt, const unsigned distance) {
+          return world_.IsScoutingFigureOnNode(curPt, player_, distance);
+      },
+      true);
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gameTypes/MapCoordinates.h"
+#include <vector>
+
+class GameWorld;
+class noBaseBuilding;
+
+/// Everything that makes points visible for a player:
+/// Military buildings, harbor building sites, lookout towers, scouts, soldiers and ships.
+/// The buildings and ships are searched once instead of for each point and scouts and soldiers are found by the
+/// counters of the world, so checking many points (e.g. of a region) is much cheaper than
+/// GameWorld::IsPointCompletelyVisible with the same result.
+class SightSources
+{
+public:
+    SightSources(const GameWorld& world, unsigned char player, const noBaseBuilding* exception);
+
+    /// Return true if the point is visible
+    bool IsVisible(MapPoint pt) const;
+
+private:
+    struct Source
+    {
+        MapPoint pos;
+        unsigned range;
+    };
+    /// Sources in range of all points of a military square
+    struct MilitarySquare
+    {
+        MapPoint squarePt;
+        std::vector<Source> sources;
+    };
+
+    const MilitarySquare& GetMilitarySquare(MapPoint pt) const;
+    bool IsVisibleByFigure(MapPoint pt) const;
+
+    const GameWorld& world_;
+    const unsigned char player_;
+    const noBaseBuilding* const exception_;
+    /// Military buildings per square, filled on first use
+    mutable std::vector<MilitarySquare> militarySquares_;
+    /// Harbor building sites, lookout towers and ships
+    std::vector<Source> sources_;
+};
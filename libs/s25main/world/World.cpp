@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "world/World.h"
+#include "figures/noFigure.h"
 #include "nodeObjs/noFlag.h"
 #include "nodeObjs/noNothing.h"
 #if RTTR_ENABLE_ASSERTS
@@ -19,7 +20,7 @@
 #include <set>
 #include <stdexcept>
 
-World::World() : noNodeObj(nullptr) {}
+World::World(unsigned numPlayers) : fowNodes(numPlayers), numScoutingFigures(numPlayers), noNodeObj(nullptr) {}
 
 World::~World()
 {
@@ -80,10 +81,18 @@ void World::Resize(const MapExtent& newSize)
 {
     MapBase::Resize(newSize);
     nodes.clear();
+    for(auto& playerFoWNodes : fowNodes)
+        playerFoWNodes.clear();
+    for(auto& playerNumScoutingFigures : numScoutingFigures)
+        playerNumScoutingFigures.clear();
     militarySquares.Clear();
     if(GetSize().x > 0)
     {
         nodes.resize(prodOfComponents(GetSize()));
+        for(auto& playerFoWNodes : fowNodes)
+            playerFoWNodes.resize(nodes.size());
+        for(auto& playerNumScoutingFigures : numScoutingFigures)
+            playerNumScoutingFigures.resize(nodes.size());
         militarySquares.Init(GetSize());
     }
 }
@@ -101,12 +110,42 @@ noBase& World::AddFigureImpl(const MapPoint pt, std::unique_ptr<noBase> fig)
 
     noBase& result = *fig;
     figures.push_back(std::move(fig));
+    UpdateNumScoutingFigures(pt, result, true);
     return result;
 }
 
 noBase* World::RemoveFigureImpl(const MapPoint pt, noBase& fig)
 {
-    return helpers::extractPtr(GetNodeInt(pt).figures, &fig).release();
+    noBase* result = helpers::extractPtr(GetNodeInt(pt).figures, &fig).release();
+    if(result)
+        UpdateNumScoutingFigures(pt, *result, false);
+    return result;
+}
+
+void World::UpdateNumScoutingFigures(const MapPoint pt, const noBase& fig, const bool added)
+{
+    const auto update = [idx = GetIdx(pt), added](std::vector<unsigned short>& playerNumScoutingFigures) {
+        unsigned short& num = playerNumScoutingFigures[idx];
+        if(added)
+            num++;
+        else
+        {
+            RTTR_Assert(num > 0u);
+            num--;
+        }
+    };
+    const GO_Type got = fig.GetGOT();
+    if(got == GO_Type::NofScoutFree || got == GO_Type::NofAttacker || got == GO_Type::NofAggressivedefender)
+    {
+        const unsigned player = static_cast<const noFigure&>(fig).GetPlayer();
+        RTTR_Assert(player < numScoutingFigures.size());
+        update(numScoutingFigures[player]);
+    } else if(got == GO_Type::Fighting)
+    {
+        // The soldiers of a fight change while it goes on, so count it for all players
+        for(auto& playerNumScoutingFigures : numScoutingFigures)
+            update(playerNumScoutingFigures);
+    }
 }
 
 noBase* World::GetNO(const MapPoint pt)
@@ -132,6 +171,7 @@ void World::SetNO(const MapPoint pt, noBase* obj, const bool replace /* = false*
     RTTR_Assert(!dynamic_cast<noMovable*>(obj)); // It should be a static, non-movable object
 #endif
     GetNodeInt(pt).obj = obj;
+    PassabilityChanged(pt);
 }
 
 void World::DestroyNO(const MapPoint pt, const bool checkExists /* = true*/)
@@ -142,6 +182,7 @@ void World::DestroyNO(const MapPoint pt, const bool checkExists /* = true*/)
         // Destroy may remove the NO already from the map or replace it (e.g. building -> fire)
         // So remove from map, then destroy and free
         GetNodeInt(pt).obj = nullptr;
+        PassabilityChanged(pt);
         obj->Destroy();
         deletePtr(obj);
     } else
@@ -173,7 +214,7 @@ void World::SetReserved(const MapPoint pt, const bool reserved)
 
 void World::SetVisibility(const MapPoint pt, unsigned char player, Visibility vis, unsigned fowTime)
 {
-    FoWNode& node = GetNodeInt(pt).fow[player];
+    FoWNode& node = GetFoWNodeInt(pt, player);
     Visibility oldVis = node.visibility;
     if(oldVis == vis)
         return;
@@ -312,7 +353,7 @@ helpers::EnumArray<DescIdx<TerrainDesc>, Direction> World::GetTerrainsAround(Map
 
 void World::SaveFOWNode(const MapPoint pt, const unsigned player, unsigned curTime)
 {
-    FoWNode& fow = GetNodeInt(pt).fow[player];
+    FoWNode& fow = GetFoWNodeInt(pt, player);
     fow.last_update_time = curTime;
 
     // FOW-Objekt erzeugen
@@ -386,7 +427,7 @@ PointRoad World::GetPointRoad(MapPoint pt, Direction dir) const
 PointRoad World::GetPointFOWRoad(MapPoint pt, Direction dir, const unsigned char viewing_player) const
 {
     const RoadDir rDir = toRoadDir(pt, dir);
-    return GetNode(pt).fow[viewing_player].roads[rDir];
+    return GetFoWNode(pt, viewing_player).roads[rDir];
 }
 
 void World::AddCatapultStone(CatapultStone* cs)
@@ -460,6 +501,7 @@ unsigned short World::GetSeaFromCoastalPoint(const MapPoint pt) const
 void World::SetRoad(const MapPoint pt, RoadDir roadDir, PointRoad type)
 {
     GetNodeInt(pt).roads[roadDir] = type;
+    PassabilityChanged(pt);
 }
 
 bool World::SetBQ(const MapPoint pt, BuildingQuality bq)
@@ -487,9 +529,9 @@ void World::RecalcShadow(const MapPoint pt)
 
 void World::MakeWholeMapVisibleForAllPlayers()
 {
-    for(auto& mapNode : nodes)
+    for(auto& playerFoWNodes : fowNodes)
     {
-        for(auto& fowNode : mapNode.fow)
+        for(auto& fowNode : playerFoWNodes)
         {
             fowNode.visibility = Visibility::Visible;
             fowNode.object.reset();
@@ -52,6 +52,11 @@ class World : public MapBase
 
     /// Eigenschaften von einem Punkt auf der Map
     std::vector<MapNode> nodes;
+    /// How the players see the nodes in FoW. One entry per node for each player of the game only
+    std::vector<std::vector<FoWNode>> fowNodes;
+    /// Number of figures on the nodes which may see for a player (see MayHaveScoutingFigure).
+    /// One entry per node for each player of the game
+    std::vector<std::vector<unsigned short>> numScoutingFigures;
 
     std::vector<Sea> seas;
 
@@ -65,6 +70,8 @@ class World : public MapBase
     noBase& AddFigureImpl(MapPoint pt, std::unique_ptr<noBase> fig);
     /// Implementation of RemoveFigure. Returned pointer must be wrapped in an owning pointer
     noBase* RemoveFigureImpl(MapPoint pt, noBase& fig);
+    /// Update the number of scouting figures for a figure added to or removed from the node
+    void UpdateNumScoutingFigures(MapPoint pt, const noBase& fig, bool added);
 
 protected:
     /// harbor building sites created by ships
@@ -75,7 +82,8 @@ public:
     std::list<CatapultStone*> catapult_stones;
     MilitarySquares militarySquares;
 
-    World();
+    /// Create a world for the given number of players
+    explicit World(unsigned numPlayers = 0);
     virtual ~World();
 
     /// Initialize the world
@@ -93,6 +101,10 @@ public:
     const MapNode& GetNode(MapPoint pt) const;
     /// Return the neighboring node
     const MapNode& GetNeighbourNode(MapPoint pt, Direction dir) const;
+    /// Return how the player sees the node in FoW
+    const FoWNode& GetFoWNode(MapPoint pt, unsigned player) const;
+    /// Return the number of players for which FoW is stored
+    unsigned GetNumFoWPlayers() const { return static_cast<unsigned>(fowNodes.size()); }
 
     // Add a figure to a node (taking ownership) and returns a reference to it
     template<typename T>
@@ -144,6 +156,9 @@ public:
     /// Return the figures currently on the node
     auto GetFigures(const MapPoint pt) const { return helpers::nonNullPtrSpan(GetNode(pt).figures); }
     bool HasFigureAt(MapPoint pt, const noBase& figure) const;
+    /// Return false if there is no figure on the node which can see for the player.
+    /// See GameWorld::IsScoutingFigureOnNode for the exact check
+    bool MayHaveScoutingFigure(MapPoint pt, unsigned player) const;
 
     /// Return a specific object or nullptr
     template<typename T>
@@ -235,11 +250,14 @@ protected:
     /// Internal method for access to nodes with write access
     MapNode& GetNodeInt(MapPoint pt);
     MapNode& GetNeighbourNodeInt(MapPoint pt, Direction dir);
+    FoWNode& GetFoWNodeInt(MapPoint pt, unsigned player);
 
     /// Notify derived classes of changed altitude
     virtual void AltitudeChanged(MapPoint pt) = 0;
     /// Notify derived classes of changed visibility
     virtual void VisibilityChanged(MapPoint pt, unsigned player, Visibility oldVis, Visibility newVis) = 0;
+    /// Notify derived classes that the object or a road of a point changed
+    virtual void PassabilityChanged(MapPoint pt) = 0;
     /// Sets the road for the given (road) direction
     void SetRoad(MapPoint pt, RoadDir roadDir, PointRoad type);
     BoundaryStones& GetBoundaryStones(const MapPoint pt) { return GetNodeInt(pt).boundary_stones; }
@@ -274,6 +292,24 @@ inline MapNode& World::GetNeighbourNodeInt(const MapPoint pt, Direction dir)
     return GetNodeInt(GetNeighbour(pt, dir));
 }
 
+inline const FoWNode& World::GetFoWNode(const MapPoint pt, const unsigned player) const
+{
+    RTTR_Assert(player < fowNodes.size());
+    return fowNodes[player][GetIdx(pt)];
+}
+
+inline FoWNode& World::GetFoWNodeInt(const MapPoint pt, const unsigned player)
+{
+    RTTR_Assert(player < fowNodes.size());
+    return fowNodes[player][GetIdx(pt)];
+}
+
+inline bool World::MayHaveScoutingFigure(const MapPoint pt, const unsigned player) const
+{
+    RTTR_Assert(player < numScoutingFigures.size());
+    return numScoutingFigures[player][GetIdx(pt)] != 0u;
+}
+
 template<class T_Predicate>
 inline bool World::IsOfTerrain(const MapPoint pt, T_Predicate predicate) const
 {
@@ -7,6 +7,7 @@
 #include "uiHelper/uiHelpers.hpp"
 #include "rttr/test/LogAccessor.hpp"
 #include <boost/test/unit_test.hpp>
+#include <string>
 
 BOOST_AUTO_TEST_SUITE(Font)
 
@@ -41,4 +42,57 @@ BOOST_FIXTURE_TEST_CASE(WrapInfoWithTrailingNewlines, uiHelper::Fixture)
     BOOST_TEST(wrapInfo.CreateSingleStrings(input) == output, boost::test_tools::per_element{});
 }
 
+BOOST_FIXTURE_TEST_CASE(LayoutCache, uiHelper::Fixture)
+{
+    auto& font = *NormalFont;
+    // Make sure the font texture exists
+    font.Draw(DrawPoint(0, 0), "?", FontStyle{});
+    font.resetLayoutCacheStats();
+    const unsigned numLayouts = font.getNumCachedLayouts();
+
+    font.Draw(DrawPoint(10, 10), "Woodcutter", FontStyle::CENTER);
+    BOOST_TEST(font.getLayoutCacheStats().misses == 1u);
+    BOOST_TEST(font.getLayoutCacheStats().hits == 0u);
+    // Position, alignment and color don't matter
+    font.Draw(DrawPoint(50, 30), "Woodcutter", FontStyle::RIGHT | FontStyle::BOTTOM, COLOR_RED);
+    BOOST_TEST(font.getLayoutCacheStats().misses == 1u);
+    BOOST_TEST(font.getLayoutCacheStats().hits == 1u);
+    // Outline, width limit and text do
+    font.Draw(DrawPoint(10, 10), "Woodcutter", FontStyle::NO_OUTLINE);
+    font.Draw(DrawPoint(10, 10), "Woodcutter", FontStyle{}, COLOR_WHITE, 20);
+    font.Draw(DrawPoint(10, 10), "Woodcutters", FontStyle{});
+    BOOST_TEST(font.getLayoutCacheStats().misses == 4u);
+    BOOST_TEST(font.getLayoutCacheStats().hits == 1u);
+    // The end is only used when the text is shortened
+    font.Draw(DrawPoint(10, 10), "Woodcutter", FontStyle{}, COLOR_WHITE, 0xFFFF, "..");
+    BOOST_TEST(font.getLayoutCacheStats().hits == 2u);
+    BOOST_TEST(font.getNumCachedLayouts() == numLayouts + 4u);
+
+    // Least recently used ones are removed
+    for(unsigned i = 0; i < glFont::maxCachedLayouts; i++)
+        font.Draw(DrawPoint(0, 0), std::to_string(i), FontStyle{});
+    BOOST_TEST(font.getNumCachedLayouts() == glFont::maxCachedLayouts);
+    const auto stats = font.getLayoutCacheStats();
+    font.Draw(DrawPoint(0, 0), std::to_string(glFont::maxCachedLayouts - 1u), FontStyle{});
+    BOOST_TEST(font.getLayoutCacheStats().hits == stats.hits + 1u);
+    font.Draw(DrawPoint(0, 0), "Woodcutter", FontStyle{});
+    BOOST_TEST(font.getLayoutCacheStats().misses == stats.misses + 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(WidthOfUTF8Text, uiHelper::Fixture)
+{
+    const auto& font = *NormalFont;
+    // Mixes ascii and multi byte chars
+    const std::string text = "Gr\xc3\xb6\xc3\x9fe 5";
+    const unsigned expectedWidth = font.CharWidth('G') + font.CharWidth('r') + font.CharWidth(0xF6)
+                                   + font.CharWidth(0xDF) + font.CharWidth('e') + font.CharWidth(' ')
+                                   + font.CharWidth('5');
+    BOOST_TEST(font.getWidth(text) == expectedWidth);
+    unsigned maxNumChars;
+    BOOST_TEST(font.getWidth(text, font.CharWidth('G') + font.CharWidth('r') + font.CharWidth(0xF6), &maxNumChars)
+               == font.CharWidth('G') + font.CharWidth('r') + font.CharWidth(0xF6));
+    // Bytes, not glyphs
+    BOOST_TEST(maxNumChars == 4u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
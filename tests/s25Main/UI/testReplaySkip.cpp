@@ -0,0 +1,113 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GameManager.h"
+#include "RttrConfig.h"
+#include "Settings.h"
+#include "WindowManager.h"
+#include "drivers/AudioDriverWrapper.h"
+#include "drivers/VideoDriverWrapper.h"
+#include "files.h"
+#include "network/GameClient.h"
+#include "random/Random.h"
+#include "uiHelper/uiHelpers.hpp"
+#include "test/testConfig.h"
+#include "s25util/Log.h"
+#include "s25util/tmpFile.h"
+#include <rttr/test/LogAccessor.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+
+namespace {
+/// Plays a replay through the GameManager like the client does, but without showing the game
+struct ReplayFixture : uiHelper::Fixture
+{
+    TmpFolder tmpUserdata;
+    boost::filesystem::path oldUserData;
+    GameManager gameManager;
+
+    ReplayFixture()
+        : tmpUserdata(rttr::test::rttrTestDataDirOut),
+          gameManager(LOG, SETTINGS, VIDEODRIVER, AUDIODRIVER, WINDOWMANAGER)
+    {
+        // The map of the replay is extracted to the user folder
+        oldUserData = RTTRCONFIG.ExpandPath("<RTTR_USERDATA>");
+        RTTRCONFIG.overridePathMapping("USERDATA", tmpUserdata);
+        boost::filesystem::create_directories(RTTRCONFIG.ExpandPath(s25::folders::mapsPlayed));
+        setGlobalGameManager(&gameManager);
+    }
+    ~ReplayFixture()
+    {
+        GAMECLIENT.Stop();
+        setGlobalGameManager(nullptr);
+        RTTRCONFIG.overridePathMapping("USERDATA", oldUserData);
+    }
+
+    void startReplay()
+    {
+        const boost::filesystem::path replayPath = rttr::test::rttrBaseDir / "tests" / "testData" / "200kGFs.rpl";
+        BOOST_TEST_REQUIRE(GAMECLIENT.StartReplay(replayPath));
+        // Done by the loading screen and the game interface
+        GAMECLIENT.GameLoaded();
+        GAMECLIENT.OnGameStart();
+        BOOST_TEST_REQUIRE((GAMECLIENT.GetState() == ClientState::Game));
+        BOOST_TEST_REQUIRE(GAMECLIENT.IsPaused());
+    }
+
+    /// Run the main loop until the skip ended. Return the number of frames required
+    unsigned runUntilSkipped()
+    {
+        unsigned numFrames = 0;
+        while(GAMECLIENT.skiptogf && numFrames < 100000u)
+        {
+            gameManager.Run();
+            numFrames++;
+        }
+        return numFrames;
+    }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(ReplaySkip, ReplayFixture)
+
+BOOST_AUTO_TEST_CASE(SkipStopsAtTargetGF)
+{
+    rttr::test::LogAccessor logAcc;
+    startReplay();
+    const unsigned targetGF = GAMECLIENT.GetGFNumber() + 500;
+    // Small budget so the skip needs multiple frames
+    gameManager.SetSkipTimeBudget(std::chrono::milliseconds(1));
+    GAMECLIENT.SkipGF(targetGF);
+    BOOST_TEST(GAMECLIENT.skiptogf == targetGF);
+    BOOST_TEST(!GAMECLIENT.IsPaused());
+
+    BOOST_TEST(runUntilSkipped() > 1u);
+    BOOST_TEST(GAMECLIENT.skiptogf == 0u);
+    BOOST_TEST(GAMECLIENT.GetGFNumber() == targetGF);
+    BOOST_TEST(GAMECLIENT.IsPaused());
+    // Stays at the target
+    gameManager.Run();
+    BOOST_TEST(GAMECLIENT.GetGFNumber() == targetGF);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncEndsSkip)
+{
+    rttr::test::LogAccessor logAcc;
+    startReplay();
+    // Change the game state so the checksum of the first command does not match
+    RANDOM.Rand(RANDOM_CONTEXT2(0), 100);
+    const unsigned targetGF = GAMECLIENT.GetGFNumber() + 5000;
+    GAMECLIENT.SkipGF(targetGF);
+
+    runUntilSkipped();
+    BOOST_TEST(GAMECLIENT.skiptogf == 0u);
+    BOOST_TEST(GAMECLIENT.GetGFNumber() < targetGF);
+    BOOST_TEST(GAMECLIENT.IsPaused());
+    const unsigned asyncGF = GAMECLIENT.GetGFNumber();
+    gameManager.Run();
+    BOOST_TEST(GAMECLIENT.GetGFNumber() == asyncGF);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
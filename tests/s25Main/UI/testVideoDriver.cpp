@@ -2,10 +2,13 @@
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "Loader.h"
 #include "PointOutput.h"
 #include "drivers/VideoDriverWrapper.h"
 #include "helpers/containerUtils.h"
 #include "mockupDrivers/MockupVideoDriver.h"
+#include "ogl/SpriteBatch.h"
+#include "ogl/glArchivItem_Bitmap.h"
 #include "uiHelper/uiHelpers.hpp"
 #include "rttr/test/LogAccessor.hpp"
 #include "rttr/test/random.hpp"
@@ -265,3 +268,40 @@ BOOST_AUTO_TEST_CASE(AutoGuiScale)
         BOOST_TEST(driver->getGuiScale().percent() == 200u);
     }
 }
+
+BOOST_FIXTURE_TEST_CASE(SpriteBatchMergesDrawCalls, uiHelper::Fixture)
+{
+    glArchivItem_Bitmap* bmp = LOADER.GetImageN("resource", 36);
+    glArchivItem_Bitmap* otherBmp = LOADER.GetImageN("resource", 37);
+    BOOST_TEST_REQUIRE(bmp);
+    BOOST_TEST_REQUIRE(otherBmp);
+    // Create the textures
+    bmp->DrawFull(DrawPoint(0, 0));
+    otherBmp->DrawFull(DrawPoint(0, 0));
+
+    // Unbatched: 1 call per sprite
+    VIDEODRIVER.ResetDrawStats();
+    for(int i = 0; i < 10; i++)
+        bmp->DrawFull(DrawPoint(i, i));
+    BOOST_TEST(VIDEODRIVER.GetDrawStats().numDrawCalls == 10u);
+
+    SpriteBatch& batch = VIDEODRIVER.GetSpriteBatch();
+    VIDEODRIVER.ResetDrawStats();
+    batch.Begin();
+    for(int i = 0; i < 10; i++)
+        bmp->DrawFull(DrawPoint(i, i));
+    BOOST_TEST(batch.GetNumPendingQuads() == 10u);
+    BOOST_TEST(VIDEODRIVER.GetDrawStats().numDrawCalls == 0u);
+    // Changing the texture draws the pending sprites
+    otherBmp->DrawFull(DrawPoint(0, 0));
+    BOOST_TEST(VIDEODRIVER.GetDrawStats().numDrawCalls == 1u);
+    BOOST_TEST(batch.GetNumPendingQuads() == 1u);
+    // So does any other drawing which binds its texture
+    VIDEODRIVER.BindTexture(0);
+    BOOST_TEST(VIDEODRIVER.GetDrawStats().numDrawCalls == 2u);
+    BOOST_TEST(batch.GetNumPendingQuads() == 0u);
+    bmp->DrawFull(DrawPoint(0, 0));
+    batch.End();
+    BOOST_TEST(VIDEODRIVER.GetDrawStats().numDrawCalls == 3u);
+    BOOST_TEST(!batch.IsActive());
+}
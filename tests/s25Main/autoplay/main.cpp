@@ -6,8 +6,12 @@
 #include "EventManager.h"
 #include "Game.h"
 #include "GamePlayer.h"
+#include "HeadlessReplay.h"
+#include "PointOutput.h"
 #include "Replay.h"
+#include "ReplayKeyframes.h"
 #include "Timer.h"
+#include "buildings/nobMilitary.h"
 #include "helpers/chronoIO.h"
 #include "network/PlayerGameCommands.h"
 #include "ogl/glAllocator.h"
@@ -16,12 +20,16 @@
 #include "variant.h"
 #include "world/GameWorld.h"
 #include "world/MapLoader.h"
+#include "world/SightSources.h"
 #include "gameTypes/MapInfo.h"
+#include "gameData/MilitaryConsts.h"
 #include "test/testConfig.h"
 #include "libsiedler2/libsiedler2.h"
 #include "s25util/tmpFile.h"
 #include <rttr/test/Fixture.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
+#include <random>
 
 #if RTTR_HAS_VLD
 #    include <vld.h>
@@ -47,6 +55,31 @@ static boost::test_tools::predicate_result verifyChecksum(const AsyncChecksum& a
     // LCOV_EXCL_STOP
 }
 
+/// Check that the visibility calculation for regions yields the same as the one for single points
+static void checkVisibilities(const GameWorld& world)
+{
+    const auto checkRegion = [&world](MapPoint center, unsigned radius, unsigned char player,
+                                      const noBaseBuilding* exception) {
+        const SightSources sources(world, player, exception);
+        for(const MapPoint pt : world.GetPointsInRadiusWithCenter(center, radius))
+        {
+            BOOST_TEST_INFO("Player " << unsigned(player) << " at " << pt << " around " << center);
+            BOOST_TEST(sources.IsVisible(pt) == world.IsPointCompletelyVisible(pt, player, exception));
+        }
+    };
+    // Own RNG to not influence the game
+    std::mt19937 rng(world.GetEvMgr().GetCurrentGF());
+    std::uniform_int_distribution<unsigned> xDistr(0, world.GetWidth() - 1), yDistr(0, world.GetHeight() - 1);
+    for(unsigned char player = 0; player < world.GetNumPlayers(); ++player)
+    {
+        for(unsigned i = 0; i < 50; i++)
+            checkRegion(MapPoint(xDistr(rng), yDistr(rng)), 12, player, nullptr);
+        // Like a destroyed building
+        for(const nobMilitary* bld : world.GetPlayer(player).GetBuildingRegister().GetMilitaryBuildings())
+            checkRegion(bld->GetPos(), bld->GetMilitaryRadius() + VISUALRANGE_MILITARY + 1, player, bld);
+    }
+}
+
 static void playReplay(const boost::filesystem::path& replayPath)
 {
     Replay replay;
@@ -104,6 +137,8 @@ static void playReplay(const boost::filesystem::path& replayPath)
                 BOOST_TEST_REQUIRE(*nextGF <= replay.GetLastGF());
         }
         game.RunGF();
+        if(game.em_->GetCurrentGF() % 25000 == 0)
+            checkVisibilities(gameWorld);
     } while(!endOfReplay);
     const auto duration = std::chrono::duration_cast<std::chrono::duration<float>>(timer.getElapsed());
     std::cout << "Replay " << replayPath.filename() << " took " << helpers::withUnit(duration) << std::endl;
@@ -130,3 +165,49 @@ BOOST_AUTO_TEST_CASE(PlaySeaReplay)
     const boost::filesystem::path replayPath = rttr::test::rttrBaseDir / "tests" / "testData" / "SeaMap300kGfs.rpl";
     playReplay(replayPath);
 }
+
+BOOST_AUTO_TEST_CASE(SeekReplayWithKeyframes)
+{
+    // Keyframes are written next to the replay, so use a copy
+    const boost::filesystem::path tmpDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::create_directories(tmpDir);
+    const boost::filesystem::path replayPath = tmpDir / "replay.rpl";
+    boost::filesystem::copy_file(rttr::test::rttrBaseDir / "tests" / "testData" / "200kGFs.rpl", replayPath);
+
+    const unsigned targetGF = 7500;
+    AsyncChecksum expectedChecksum;
+    {
+        HeadlessReplay player(replayPath);
+        ReplayKeyframes keyframes;
+        BOOST_TEST_REQUIRE(keyframes.StartWriting(ReplayKeyframes::GetFilePath(replayPath), player.GetReplay()));
+        for(unsigned gf = 2000; gf < targetGF; gf += 2000)
+        {
+            player.RunUntil(gf);
+            keyframes.AddKeyframe(player.GetGame(), player.GetCommandPos(), player.GetReplay().GetMapName());
+        }
+        keyframes.Close();
+        player.RunUntil(targetGF);
+        BOOST_TEST(player.GetNumAsyncGFs() == 0u);
+        expectedChecksum = AsyncChecksum::create(player.GetGame());
+    }
+    {
+        ReplayKeyframes keyframes;
+        Replay replay;
+        BOOST_TEST_REQUIRE(replay.LoadHeader(replayPath));
+        BOOST_TEST_REQUIRE(keyframes.Load(ReplayKeyframes::GetFilePath(replayPath), replay));
+        BOOST_TEST_REQUIRE(keyframes.GetKeyframes().size() == 3u);
+        BOOST_TEST_REQUIRE(keyframes.Find(targetGF));
+        BOOST_TEST(keyframes.Find(targetGF)->gf == 6000u);
+        BOOST_TEST(!keyframes.Find(1999));
+    }
+    {
+        HeadlessReplay player(replayPath, targetGF);
+        BOOST_TEST(player.GetCurrentGF() == targetGF);
+        BOOST_TEST(player.GetNumAsyncGFs() == 0u);
+        BOOST_TEST(verifyChecksum(AsyncChecksum::create(player.GetGame()), expectedChecksum));
+        // Continue playing from the keyframe
+        player.RunUntil(targetGF + 2000);
+        BOOST_TEST(player.GetNumAsyncGFs() == 0u);
+    }
+    boost::filesystem::remove_all(tmpDir);
+}
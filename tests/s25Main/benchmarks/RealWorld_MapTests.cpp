@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Game.h"
+#include "GlobalGameSettings.h"
 #include "PlayerInfo.h"
+#include "addons/const_addons.h"
 #include "network/GameClient.h"
 #include "ogl/glAllocator.h"
 #include "world/MapLoader.h"
@@ -11,6 +13,7 @@
 #include <rttr/test/Fixture.hpp>
 #include <benchmark/benchmark.h>
 #include <array>
+#include <string>
 #include <test/testConfig.h>
 #include <utility>
 
@@ -30,14 +33,17 @@ static void BM_PathFinding(benchmark::State& state)
     std::vector<PlayerInfo> players(2);
     for(auto& player : players)
         player.ps = PlayerState::Occupied;
-    auto game = std::make_shared<Game>(GlobalGameSettings(), 0, players);
+    GlobalGameSettings ggs;
+    // Second argument: Use hierarchical pathfinding
+    ggs.setSelection(AddonId::HIERARCHICAL_PATHFINDING, static_cast<unsigned>(state.range(1)));
+    auto game = std::make_shared<Game>(ggs, 0, players);
     GameWorld& world = game->world_;
     MapLoader loader(world);
     if(!loader.Load(rttr::test::rttrBaseDir / "data/RTTR/MAPS/NEW/AM_FANGDERZEIT.SWD"))
         state.SkipWithError("Map failed to load");
 
     const auto& curValues = routes[static_cast<size_t>(state.range())];
-    state.SetLabel(std::get<0>(curValues));
+    state.SetLabel(std::string(std::get<0>(curValues)) + (state.range(1) ? " (hierarchical)" : ""));
     const MapPoint start = std::get<1>(curValues);
     const MapPoint goal = std::get<2>(curValues);
 
@@ -48,7 +54,7 @@ static void BM_PathFinding(benchmark::State& state)
         benchmark::DoNotOptimize(result);
     }
 }
-BENCHMARK(BM_PathFinding)->DenseRange(0, routes.size() - 1);
+BENCHMARK(BM_PathFinding)->ArgsProduct({benchmark::CreateDenseRange(0, routes.size() - 1, 1), {0, 1}});
 
 constexpr std::array<std::tuple<const char*, unsigned>, 3> maps = {
   {{"AM_FANGDERZEIT", 7}, {"TueranTuer", 2}, {"Suedameri", 5}}};
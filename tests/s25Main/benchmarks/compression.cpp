@@ -0,0 +1,137 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "HeadlessReplay.h"
+#include "Replay.h"
+#include "SerializedGameData.h"
+#include "ogl/glAllocator.h"
+#include "gameTypes/CompressedData.h"
+#include "gameTypes/MapInfo.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <boost/nowide/fstream.hpp>
+#include <test/testConfig.h>
+#include <iterator>
+#include <vector>
+
+namespace {
+const boost::filesystem::path& getTestDataDir()
+{
+    static const boost::filesystem::path path = rttr::test::rttrBaseDir / "tests" / "testData";
+    return path;
+}
+
+std::vector<char> readFile(const boost::filesystem::path& filepath)
+{
+    boost::nowide::ifstream file(filepath, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/// Uncompressed map of the replay
+std::vector<char> getReplayMap(const boost::filesystem::path& replayPath)
+{
+    Replay replay;
+    MapInfo mapInfo;
+    if(!replay.LoadHeader(replayPath) || !replay.LoadGameData(mapInfo))
+        return {};
+    return CompressedData::decompress(mapInfo.mapData.data, mapInfo.mapData.uncompressedLength);
+}
+
+/// Game data of a savegame of the late game on a big map
+const std::vector<char>& getBigSavegameData()
+{
+    static const std::vector<char> data = []() {
+        rttr::test::Fixture f;
+        libsiedler2::setAllocator(new GlAllocator);
+        HeadlessReplay player(getTestDataDir() / "SeaMap300kGfs.rpl");
+        player.RunUntil(200000);
+        SerializedGameData sgd;
+        sgd.MakeSnapshot(player.GetGame());
+        return std::vector<char>(sgd.GetData(), sgd.GetData() + sgd.GetLength());
+    }();
+    return data;
+}
+
+enum class TestData
+{
+    LuaMap,
+    BigMap,
+    SeaMap,
+    BigSavegame
+};
+
+const std::vector<char>& getTestData(TestData testData)
+{
+    static const std::vector<char> luaMap = readFile(getTestDataDir() / "maps" / "LuaFunctions.SWD");
+    static const std::vector<char> bigMap = getReplayMap(getTestDataDir() / "200kGFs.rpl");
+    static const std::vector<char> seaMap = getReplayMap(getTestDataDir() / "SeaMap300kGfs.rpl");
+    switch(testData)
+    {
+        case TestData::LuaMap: return luaMap;
+        case TestData::BigMap: return bigMap;
+        case TestData::SeaMap: return seaMap;
+        case TestData::BigSavegame: break;
+    }
+    return getBigSavegameData();
+}
+
+void applyArgs(benchmark::internal::Benchmark* bm)
+{
+    for(const auto codec : {CompressionCodec::BZip2, CompressionCodec::Zstd})
+    {
+        for(const auto level : {CompressionLevel::Fast, CompressionLevel::Default, CompressionLevel::Best})
+        {
+            for(const auto data : {TestData::LuaMap, TestData::BigMap, TestData::SeaMap, TestData::BigSavegame})
+                bm->Args({static_cast<int>(codec), static_cast<int>(level), static_cast<int>(data)});
+        }
+    }
+    bm->ArgNames({"codec", "level", "data"});
+}
+} // namespace
+
+/// Compression speed and ratio of the codecs and levels on maps and a big savegame
+static void BM_Compress(benchmark::State& state)
+{
+    const auto codec = static_cast<CompressionCodec>(state.range(0));
+    const auto level = static_cast<CompressionLevel>(state.range(1));
+    const std::vector<char>& data = getTestData(static_cast<TestData>(state.range(2)));
+    if(data.empty())
+    {
+        state.SkipWithError("Test data not found");
+        return;
+    }
+
+    size_t compressedSize = 0;
+    for(auto _ : state)
+    {
+        const auto compressed = CompressedData::compress(data, level, codec);
+        compressedSize = compressed.size();
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.counters["ratio"] = static_cast<double>(data.size()) / compressedSize;
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Compress)->Apply(applyArgs)->Unit(benchmark::kMillisecond);
+
+static void BM_Decompress(benchmark::State& state)
+{
+    const auto codec = static_cast<CompressionCodec>(state.range(0));
+    const auto level = static_cast<CompressionLevel>(state.range(1));
+    const std::vector<char>& data = getTestData(static_cast<TestData>(state.range(2)));
+    if(data.empty())
+    {
+        state.SkipWithError("Test data not found");
+        return;
+    }
+    const auto compressed = CompressedData::compress(data, level, codec);
+
+    for(auto _ : state)
+    {
+        const auto uncompressed = CompressedData::decompress(compressed, data.size());
+        benchmark::DoNotOptimize(uncompressed.data());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Decompress)->Apply(applyArgs)->Unit(benchmark::kMillisecond);
@@ -21,7 +21,8 @@ struct NodeGetKey
 {
     constexpr auto operator()(const DummyNode& el) const { return el.key; }
 };
-using OpenList = OpenListBinaryHeap<DummyNode, NodeGetKey>;
+template<unsigned T_Arity>
+using OpenList = OpenListDaryHeap<DummyNode, NodeGetKey, T_Arity>;
 
 auto getRandomNodes(size_t numElements, unsigned maxValue = 512)
 {
@@ -32,6 +33,7 @@ auto getRandomNodes(size_t numElements, unsigned maxValue = 512)
 }
 } // namespace
 
+template<unsigned T_Arity>
 static void BM_PushElements(benchmark::State& state)
 {
     const auto numElements = static_cast<size_t>(state.range(0));
@@ -39,7 +41,7 @@ static void BM_PushElements(benchmark::State& state)
     {
         state.PauseTiming();
         auto nodes = getRandomNodes(numElements);
-        OpenList list;
+        OpenList<T_Arity> list;
         state.ResumeTiming();
         for(auto& node : nodes)
             list.push(&node);
@@ -47,8 +49,10 @@ static void BM_PushElements(benchmark::State& state)
     }
     state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_PushElements)->Arg(3)->Arg(5)->Arg(7)->Arg(10)->Arg(20)->Arg(30)->Arg(40);
+BENCHMARK_TEMPLATE(BM_PushElements, 2)->Arg(3)->Arg(5)->Arg(7)->Arg(10)->Arg(20)->Arg(30)->Arg(40)->Arg(200);
+BENCHMARK_TEMPLATE(BM_PushElements, 4)->Arg(3)->Arg(5)->Arg(7)->Arg(10)->Arg(20)->Arg(30)->Arg(40)->Arg(200);
 
+template<unsigned T_Arity>
 static void BM_PopElements(benchmark::State& state)
 {
     const auto numElements = static_cast<size_t>(state.range(0));
@@ -56,7 +60,7 @@ static void BM_PopElements(benchmark::State& state)
     {
         state.PauseTiming();
         auto nodes = getRandomNodes(numElements);
-        OpenList list;
+        OpenList<T_Arity> list;
         for(auto& node : nodes)
             list.push(&node);
         benchmark::DoNotOptimize(list);
@@ -70,8 +74,10 @@ static void BM_PopElements(benchmark::State& state)
     }
     state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_PopElements)->Arg(3)->Arg(5)->Arg(7)->Arg(10)->Arg(20)->Arg(30)->Arg(40);
+BENCHMARK_TEMPLATE(BM_PopElements, 2)->Arg(3)->Arg(5)->Arg(7)->Arg(10)->Arg(20)->Arg(30)->Arg(40)->Arg(200);
+BENCHMARK_TEMPLATE(BM_PopElements, 4)->Arg(3)->Arg(5)->Arg(7)->Arg(10)->Arg(20)->Arg(30)->Arg(40)->Arg(200);
 
+template<unsigned T_Arity>
 static void BM_PushPopElements(benchmark::State& state)
 {
     const auto numElements = static_cast<size_t>(state.range(0));
@@ -80,7 +86,7 @@ static void BM_PushPopElements(benchmark::State& state)
     {
         state.PauseTiming();
         auto nodes = getRandomNodes(numElements, numElements / 3u); // Force duplicates
-        OpenList list;
+        OpenList<T_Arity> list;
         for(auto& node : nodes)
             list.push(&node);
         benchmark::DoNotOptimize(list);
@@ -97,4 +103,7 @@ static void BM_PushPopElements(benchmark::State& state)
     }
     state.SetItemsProcessed(state.iterations() * numOperations * 2);
 }
-BENCHMARK(BM_PushPopElements)->ArgsProduct({{3, 5, 7, 10, 20, 30, 40, 70}, {5, 7, 15, 20, 50, 200, 600}});
+BENCHMARK_TEMPLATE(BM_PushPopElements, 2)
+  ->ArgsProduct({{3, 5, 7, 10, 20, 30, 40, 70, 500}, {5, 7, 15, 20, 50, 200, 600}});
+BENCHMARK_TEMPLATE(BM_PushPopElements, 4)
+  ->ArgsProduct({{3, 5, 7, 10, 20, 30, 40, 70, 500}, {5, 7, 15, 20, 50, 200, 600}});
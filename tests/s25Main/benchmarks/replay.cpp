@@ -0,0 +1,262 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "EventManager.h"
+#include "Game.h"
+#include "GameObject.h"
+#include "GamePlayer.h"
+#include "ILocalGameState.h"
+#include "Replay.h"
+#include "RttrForeachPt.h"
+#include "SerializedGameData.h"
+#include "network/PlayerGameCommands.h"
+#include "ogl/glAllocator.h"
+#include "pathfinding/RoadPathFinder.h"
+#include "random/Random.h"
+#include "variant.h"
+#include "world/GameWorld.h"
+#include "world/MapLoader.h"
+#include "nodeObjs/noFlag.h"
+#include "gameTypes/MapInfo.h"
+#include "libsiedler2/libsiedler2.h"
+#include "s25util/tmpFile.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <test/testConfig.h>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+
+namespace {
+/// Replays a game from a replay file
+class ReplayRunner
+{
+public:
+    explicit ReplayRunner(const boost::filesystem::path& replayPath) : replayPath_(replayPath) {}
+
+    /// Load the map and create the game. Return an error message on failure
+    const char* Load()
+    {
+        MapInfo mapInfo;
+        if(!replay_.LoadHeader(replayPath_) || !replay_.LoadGameData(mapInfo))
+            return "Replay failed to load";
+        TmpFile mapfile;
+        mapfile.close();
+        if(!mapInfo.mapData.DecompressToFile(mapfile.filePath))
+            return "Map failed to decompress";
+
+        std::vector<PlayerInfo> players;
+        for(unsigned i = 0; i < replay_.GetNumPlayers(); i++)
+            players.emplace_back(replay_.GetPlayer(i));
+        game_ = std::make_unique<Game>(replay_.ggs, /*startGF*/ 0, players);
+        RANDOM.Init(replay_.getSeed());
+        GameWorld& gameWorld = game_->world_;
+        for(unsigned i = 0; i < gameWorld.GetNumPlayers(); ++i)
+            gameWorld.GetPlayer(i).MakeStartPacts();
+        MapLoader loader(gameWorld);
+        if(!loader.Load(mapfile.filePath))
+            return "Map failed to load";
+        gameWorld.SetupResources();
+        gameWorld.InitAfterLoad();
+        nextGF_ = replay_.ReadGF();
+        return nullptr;
+    }
+
+    /// Run the game until the GF is reached or the replay ends. Return the number of GFs executed
+    unsigned RunUntil(unsigned maxGF)
+    {
+        GameWorld& gameWorld = game_->world_;
+        unsigned numGFs = 0;
+        while(game_->em_->GetCurrentGF() < maxGF)
+        {
+            const unsigned curGF = game_->em_->GetCurrentGF();
+            while(nextGF_ && *nextGF_ == curGF)
+            {
+                const auto cmd = replay_.ReadCommand();
+                visit(composeVisitor([](const Replay::ChatCommand&) {},
+                                     [&](const Replay::GameCommand& cmd) {
+                                         for(const gc::GameCommandPtr& gc : cmd.cmds.gcs)
+                                             gc->Execute(gameWorld, cmd.player);
+                                     }),
+                      cmd);
+                nextGF_ = replay_.ReadGF();
+            }
+            if(!nextGF_)
+                break;
+            game_->RunGF();
+            ++numGFs;
+        }
+        return numGFs;
+    }
+
+    Game& GetGame() { return *game_; }
+    Replay& GetReplay() { return replay_; }
+    /// Destroy the game, e.g. to create another one in this thread
+    void ResetGame() { game_.reset(); }
+
+private:
+    boost::filesystem::path replayPath_;
+    Replay replay_;
+    std::unique_ptr<Game> game_;
+    std::optional<unsigned> nextGF_;
+};
+
+class DummyLocalGameState : public ILocalGameState
+{
+public:
+    unsigned GetPlayerId() const override { return 0; }
+    bool IsHost() const override { return false; }
+    std::string FormatGFTime(unsigned) const override { return ""; }
+    void SystemChat(const std::string&) override {}
+};
+
+const boost::filesystem::path& getSeaMapReplayPath()
+{
+    static const boost::filesystem::path path =
+      rttr::test::rttrBaseDir / "tests" / "testData" / "SeaMap300kGfs.rpl";
+    return path;
+}
+} // namespace
+
+/// Run the GFs of a replay measuring the simulation throughput.
+/// Run this on different commits to compare the GF/s before and after a change
+static void BM_ReplaySeaMap(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    const auto maxGF = static_cast<unsigned>(state.range());
+
+    unsigned numGFs = 0;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        ReplayRunner runner(getSeaMapReplayPath());
+        if(const char* error = runner.Load())
+        {
+            state.SkipWithError(error);
+            break;
+        }
+        state.ResumeTiming();
+        numGFs += runner.RunUntil(maxGF);
+    }
+    state.counters["GF/s"] = benchmark::Counter(numGFs, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ReplaySeaMap)->Arg(10000)->Arg(100000)->Arg(300000)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+/// Ware routes between random flags of a player in a grown road network (late game of the replay)
+static void BM_RoadPathFindingLateGame(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    ReplayRunner runner(getSeaMapReplayPath());
+    if(const char* error = runner.Load())
+    {
+        state.SkipWithError(error);
+        return;
+    }
+    runner.RunUntil(static_cast<unsigned>(state.range()));
+    const GameWorld& world = runner.GetGame().world_;
+
+    std::vector<const noFlag*> flags;
+    RTTR_FOREACH_PT(MapPoint, world.GetSize())
+    {
+        const auto* flag = world.GetSpecObj<noFlag>(pt);
+        if(flag && flag->GetPlayer() == 0)
+            flags.push_back(flag);
+    }
+    if(flags.size() < 2)
+    {
+        state.SkipWithError("Not enough flags");
+        return;
+    }
+    // Fixed pairs so runs are comparable
+    std::vector<std::pair<const noFlag*, const noFlag*>> pairs;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> distr(0, flags.size() - 1);
+    for(unsigned i = 0; i < 100; i++)
+        pairs.emplace_back(flags[distr(rng)], flags[distr(rng)]);
+
+    RoadPathFinder& pf = world.GetRoadPathFinder();
+    for(auto _ : state)
+    {
+        for(const auto& pair : pairs)
+        {
+            unsigned length;
+            const bool found = pf.FindPath(*pair.first, *pair.second, true, std::numeric_limits<unsigned>::max(),
+                                           nullptr, &length);
+            benchmark::DoNotOptimize(found);
+            benchmark::DoNotOptimize(length);
+        }
+    }
+    state.counters["flags"] = static_cast<double>(flags.size());
+    state.SetItemsProcessed(state.iterations() * pairs.size());
+}
+BENCHMARK(BM_RoadPathFindingLateGame)->Arg(100000)->Arg(300000)->Unit(benchmark::kMicrosecond);
+
+/// Snapshot of the game state as done for savegames, resyncs and async logs (late game of the replay)
+static void BM_MakeSnapshotLateGame(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    ReplayRunner runner(getSeaMapReplayPath());
+    if(const char* error = runner.Load())
+    {
+        state.SkipWithError(error);
+        return;
+    }
+    runner.RunUntil(static_cast<unsigned>(state.range()));
+
+    SerializedGameData sgd;
+    for(auto _ : state)
+    {
+        sgd.MakeSnapshot(runner.GetGame());
+        benchmark::DoNotOptimize(sgd.GetData());
+    }
+    state.counters["MB"] = static_cast<double>(sgd.GetLength()) / (1024 * 1024);
+    state.counters["objects"] = GameObject::GetNumObjs();
+    state.SetBytesProcessed(state.iterations() * sgd.GetLength());
+}
+BENCHMARK(BM_MakeSnapshotLateGame)->Arg(100000)->Arg(300000)->Unit(benchmark::kMillisecond);
+
+/// Restoring the game from a snapshot as done when loading a savegame (late game of the replay)
+static void BM_ReadSnapshotLateGame(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    ReplayRunner runner(getSeaMapReplayPath());
+    if(const char* error = runner.Load())
+    {
+        state.SkipWithError(error);
+        return;
+    }
+    runner.RunUntil(static_cast<unsigned>(state.range()));
+
+    SerializedGameData sgd;
+    sgd.MakeSnapshot(runner.GetGame());
+    const GlobalGameSettings ggs = runner.GetGame().ggs_;
+    const unsigned gf = runner.GetGame().em_->GetCurrentGF();
+    std::vector<PlayerInfo> players;
+    for(unsigned i = 0; i < runner.GetReplay().GetNumPlayers(); i++)
+        players.emplace_back(runner.GetReplay().GetPlayer(i));
+    // Only 1 game may exist per thread
+    runner.ResetGame();
+
+    DummyLocalGameState localGameState;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto game = std::make_unique<Game>(ggs, gf, players);
+        state.ResumeTiming();
+        sgd.ReadSnapshot(*game, localGameState);
+        benchmark::DoNotOptimize(game->world_);
+        state.PauseTiming();
+        game.reset();
+        state.ResumeTiming();
+    }
+    state.counters["MB"] = static_cast<double>(sgd.GetLength()) / (1024 * 1024);
+    state.SetBytesProcessed(state.iterations() * sgd.GetLength());
+}
+BENCHMARK(BM_ReadSnapshotLateGame)->Arg(100000)->Arg(300000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,153 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Game.h"
+#include "PlayerInfo.h"
+#include "RttrForeachPt.h"
+#include "ai/AIInterface.h"
+#include "ai/aijh/AIMap.h"
+#include "ai/aijh/AIResourceMap.h"
+#include "world/GameWorld.h"
+#include "gameTypes/FoWNode.h"
+#include "gameTypes/MapNode.h"
+#include "gameData/MaxPlayers.h"
+#include "lua/GameDataLoader.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+constexpr MapExtent bigMapSize(1024, 1024);
+
+std::shared_ptr<Game> createBigWorld(unsigned numPlayers)
+{
+    std::vector<PlayerInfo> players(numPlayers);
+    for(auto& player : players)
+        player.ps = PlayerState::Occupied;
+    auto game = std::make_shared<Game>(GlobalGameSettings(), 0, players);
+    GameWorld& world = game->world_;
+    loadGameData(world.GetDescriptionWriteable());
+    world.Init(bigMapSize);
+    const auto tLand = world.GetDescription().terrain.find(
+      [](const TerrainDesc& t) { return t.kind == TerrainKind::Land && t.Is(ETerrain::Buildable); });
+    if(!tLand)
+        throw std::logic_error("No land");
+    RTTR_FOREACH_PT(MapPoint, bigMapSize)
+    {
+        MapNode& node = world.GetNodeWriteable(pt);
+        node.t1 = node.t2 = tLand;
+    }
+    return game;
+}
+} // namespace
+
+/// Scan over the owner and BQ of all nodes as done e.g. by the AI and the minimap.
+/// Reports the memory used by the node data of the world (without objects and figures on it)
+static void BM_WorldNodeScan(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto numPlayers = static_cast<unsigned>(state.range());
+    const auto game = createBigWorld(numPlayers);
+    const GameWorld& world = game->world_;
+
+    for(auto _ : state)
+    {
+        unsigned numOwnedOrBuildable = 0;
+        RTTR_FOREACH_PT(MapPoint, bigMapSize)
+        {
+            const MapNode& node = world.GetNode(pt);
+            if(node.owner != 0 || node.bq != BuildingQuality::Nothing)
+                numOwnedOrBuildable++;
+        }
+        benchmark::DoNotOptimize(numOwnedOrBuildable);
+    }
+    const size_t bytesPerNode = sizeof(MapNode) + numPlayers * sizeof(FoWNode);
+    state.counters["nodes"] = prodOfComponents(bigMapSize);
+    state.counters["bytes/node"] = static_cast<double>(bytesPerNode);
+    state.counters["MB"] = static_cast<double>(bytesPerNode * prodOfComponents(bigMapSize)) / (1024 * 1024);
+}
+BENCHMARK(BM_WorldNodeScan)->Arg(2)->Arg(8)->Arg(MAX_PLAYERS)->Unit(benchmark::kMillisecond);
+
+static void BM_InitAfterLoad(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = createBigWorld(static_cast<unsigned>(state.range()));
+    GameWorld& world = game->world_;
+
+    for(auto _ : state)
+    {
+        world.InitAfterLoad();
+        benchmark::DoNotOptimize(world);
+    }
+    state.counters["nodes"] = prodOfComponents(bigMapSize);
+}
+BENCHMARK(BM_InitAfterLoad)->Arg(2)->Arg(8)->Unit(benchmark::kMillisecond);
+
+static void BM_BQ_CalculationBigMap(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = createBigWorld(static_cast<unsigned>(state.range()));
+    GameWorld& world = game->world_;
+    world.InitAfterLoad();
+
+    for(auto _ : state)
+    {
+        RTTR_FOREACH_PT(MapPoint, bigMapSize)
+            world.RecalcBQ(pt);
+        benchmark::DoNotOptimize(world);
+    }
+    state.counters["nodes"] = prodOfComponents(bigMapSize);
+}
+BENCHMARK(BM_BQ_CalculationBigMap)->Arg(2)->Arg(8)->Unit(benchmark::kMillisecond);
+
+/// Visibility updates as done when a military building is built or destroyed.
+/// Uses points in the middle of the map and at the border (which wrap around)
+static void BM_RecalcVisibilitiesAroundPoint(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = createBigWorld(2);
+    GameWorld& world = game->world_;
+    world.InitAfterLoad();
+    const auto radius = static_cast<MapCoord>(state.range());
+    const std::vector<MapPoint> pts{MapPoint(bigMapSize.x / 2, bigMapSize.y / 2), MapPoint(0, 0),
+                                    MapPoint(bigMapSize.x / 3, bigMapSize.y / 3 + 1),
+                                    MapPoint(bigMapSize.x - 1, bigMapSize.y / 2)};
+
+    for(auto _ : state)
+    {
+        for(const MapPoint pt : pts)
+            world.RecalcVisibilitiesAroundPoint(pt, radius, 0, nullptr);
+        benchmark::DoNotOptimize(world);
+    }
+    state.counters["nodes"] = static_cast<double>(pts.size() * (3u * radius * (radius + 1u) + 1u));
+}
+BENCHMARK(BM_RecalcVisibilitiesAroundPoint)->Arg(4)->Arg(9)->Arg(16);
+
+/// Initialization of the AI resource map which calculates the value of all nodes in the resource radius of each node
+static void BM_AIResourceMapInit(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = createBigWorld(1);
+    GameWorld& world = game->world_;
+    world.InitAfterLoad();
+    std::vector<gc::GameCommandPtr> gcs;
+    const AIInterface aii(world, gcs, 0);
+    AIJH::AIMap aiMap;
+    aiMap.Resize(bigMapSize);
+    const auto res = static_cast<AIResource>(state.range());
+    AIJH::AIResourceMap resMap(res, false, aii, aiMap);
+
+    for(auto _ : state)
+    {
+        resMap.init();
+        benchmark::DoNotOptimize(resMap);
+    }
+    state.counters["nodes"] = prodOfComponents(bigMapSize);
+}
+BENCHMARK(BM_AIResourceMapInit)
+  ->Arg(static_cast<int>(AIResource::Stones))
+  ->Arg(static_cast<int>(AIResource::Fish))
+  ->Unit(benchmark::kMillisecond);
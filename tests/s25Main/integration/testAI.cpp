@@ -2,29 +2,41 @@
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "GameObject.h"
 #include "PointOutput.h"
 #include "RttrForeachPt.h"
+#include "ai/AIInterface.h"
 #include "ai/AIPlayer.h"
+#include "ai/AIResourceValueCache.h"
+#include "ai/AIRunner.h"
 #include "ai/aijh/AIPlayerJH.h"
 #include "buildings/noBuilding.h"
 #include "buildings/noBuildingSite.h"
 #include "buildings/nobBaseWarehouse.h"
 #include "buildings/nobMilitary.h"
+#include "enum_cast.hpp"
 #include "factories/AIFactory.h"
 #include "factories/BuildingFactory.h"
 #include "helpers/containerUtils.h"
 #include "network/GameMessage_Chat.h"
 #include "notifications/NodeNote.h"
+#include "random/Random.h"
 #include "worldFixtures/WorldWithGCExecution.h"
 #include "nodeObjs/noFlag.h"
+#include "nodeObjs/noGranite.h"
 #include "nodeObjs/noTree.h"
 #include "gameTypes/GameTypesOutput.h"
 #include "gameData/BuildingProperties.h"
 #include "gameData/MilitaryConsts.h"
 #include "rttr/test/random.hpp"
+#include "s25util/Serializer.h"
 #include <boost/test/unit_test.hpp>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <stdexcept>
+#include <thread>
 
 namespace {
 // We need border land
@@ -59,6 +71,33 @@ struct MockAI final : public AIPlayer
     void OnChatMessage(unsigned /*sendPlayerId*/, ChatDestination, const std::string& /*msg*/) override {}
     // LCOV_EXCL_STOP
 };
+
+/// AI recording the GFs it was run for and the threads it was run on
+struct RecordingAI final : public AIPlayer
+{
+    RecordingAI(unsigned char playerId, const GameWorldBase& gwb, std::mutex& mutex, std::set<std::thread::id>& threads)
+        : AIPlayer(playerId, gwb, AI::Level::Easy), mutex(mutex), threads(threads)
+    {}
+    void RunGF(unsigned gf, bool gfisnwf) override
+    {
+        if(gf == failGF)
+            throw std::runtime_error("Failed");
+        gfs.push_back(gf);
+        nwfs.push_back(gfisnwf);
+        // Give other threads a chance to start
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    }
+    // LCOV_EXCL_START
+    void OnChatMessage(unsigned /*sendPlayerId*/, ChatDestination, const std::string& /*msg*/) override {}
+    // LCOV_EXCL_STOP
+    std::vector<unsigned> gfs;
+    std::vector<bool> nwfs;
+    unsigned failGF = 0;
+    std::mutex& mutex;
+    std::set<std::thread::id>& threads;
+};
 } // namespace
 
 // Note game command execution is emulated to be like the ones send via network:
@@ -82,6 +121,47 @@ BOOST_FIXTURE_TEST_CASE(PlayerHasBld_IsCorrect, EmptyWorldFixture1P)
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(ResourceValuesOfAllPoints, EmptyWorldFixture2P)
+{
+    const MapPoint hqPos = world.GetPlayer(0).GetHQPos();
+    RTTR_FOREACH_PT(MapPoint, world.GetSize())
+    {
+        if(world.GetNode(pt).obj || world.CalcDistance(pt, hqPos) < 3)
+            continue;
+        switch(rttr::test::randomValue(0, 5))
+        {
+            case 0: world.SetNO(pt, new noTree(pt, 0, 3)); break;
+            case 1: world.SetNO(pt, new noGranite(GraniteType::One, 1)); break;
+            case 2:
+                world.GetNodeWriteable(pt).resources =
+                  Resource(rttr::test::randomEnum<ResourceType>(), rttr::test::randomValue(0u, 15u));
+                break;
+            default: break;
+        }
+    }
+    std::vector<gc::GameCommandPtr> gcs;
+    const AIInterface aii0(world, gcs, 0), aii1(world, gcs, 1);
+    AIResourceValueCache valueCache(world);
+    for(const auto res : helpers::EnumRange<AIResource>{})
+    {
+        const std::vector<int> values = aii0.CalcResourceValues(res);
+        BOOST_TEST_REQUIRE(values.size() == prodOfComponents(world.GetSize()));
+        RTTR_FOREACH_PT(MapPoint, world.GetSize())
+        {
+            BOOST_TEST_INFO(rttr::enum_cast(res) << " at " << pt);
+            BOOST_TEST(values[world.GetIdx(pt)] == aii0.CalcResourceValue(pt, res));
+        }
+        if(AIResourceValueCache::IsPlayerIndependent(res))
+        {
+            // Calculated only once for all players
+            const auto cachedValues = valueCache.GetValues(aii0, res);
+            BOOST_TEST(*cachedValues == values, boost::test_tools::per_element());
+            BOOST_TEST(valueCache.GetValues(aii1, res) == cachedValues);
+            BOOST_TEST(aii1.CalcResourceValues(res) == values, boost::test_tools::per_element());
+        }
+    }
+}
+
 BOOST_FIXTURE_TEST_CASE(AIChat, EmptyWorldFixture2P)
 {
     MockAI ai(1, world, AI::Level::Easy);
@@ -109,6 +189,105 @@ BOOST_FIXTURE_TEST_CASE(AIChat, EmptyWorldFixture2P)
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(RunAIsInParallel, EmptyWorldFixture2P)
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::vector<std::unique_ptr<RecordingAI>> ais;
+    for(unsigned i = 0; i < 8; i++)
+        ais.push_back(std::make_unique<RecordingAI>(i % 2, world, mutex, threads));
+
+    AIRunner runner(world);
+    BOOST_TEST(runner.GetNumThreads() == 1u);
+    runner.RunGF(ais, 1, true);
+    BOOST_TEST(threads.size() == 1u);
+    BOOST_TEST(*threads.begin() == std::this_thread::get_id());
+
+    runner.SetNumThreads(4);
+    BOOST_TEST(runner.GetNumThreads() == 4u);
+    for(unsigned gf = 2; gf < 20; gf++)
+        runner.RunGF(ais, gf, gf % 5 == 0);
+    BOOST_TEST(threads.size() > 1u);
+    BOOST_TEST(threads.size() <= 4u);
+    for(const auto& ai : ais)
+    {
+        BOOST_TEST_REQUIRE(ai->gfs.size() == 19u);
+        for(unsigned i = 0; i < ai->gfs.size(); i++)
+        {
+            BOOST_TEST(ai->gfs[i] == i + 1u);
+            BOOST_TEST(ai->nwfs[i] == (i == 0u || (i + 1u) % 5 == 0u));
+        }
+    }
+
+    // Exceptions are passed to the caller after all AIs have run
+    ais[3]->failGF = 20;
+    BOOST_CHECK_THROW(runner.RunGF(ais, 20, false), std::runtime_error);
+    for(unsigned i = 0; i < ais.size(); i++)
+        BOOST_TEST(ais[i]->gfs.size() == (i == 3u ? 19u : 20u));
+    // Can still be used
+    runner.RunGF(ais, 21, false);
+    BOOST_TEST(ais[3]->gfs.back() == 21u);
+
+    runner.SetNumThreads(2);
+    BOOST_TEST(runner.GetNumThreads() == 2u);
+    runner.SetNumThreads(1);
+    BOOST_TEST(runner.GetNumThreads() == 1u);
+    threads.clear();
+    runner.RunGF(ais, 22, false);
+    BOOST_TEST(threads.size() == 1u);
+    BOOST_TEST(*threads.begin() == std::this_thread::get_id());
+}
+
+namespace {
+/// Run real AIs for all players and return the serialized commands of each player and NWF and the number of objects
+/// created
+std::pair<std::vector<std::string>, unsigned> runAIsAndRecordCommands(const unsigned numThreads)
+{
+    WorldFixture<CreateEmptyWorld, 4, 64, 64> fixture;
+    Game& game = *fixture.game;
+    GameWorld& world = fixture.world;
+    // The AIs are seeded from the game RNG
+    RANDOM.Init(42);
+    const unsigned startObjIdCounter = GameObject::GetObjIDCounter();
+    for(unsigned playerId = 0; playerId < world.GetNumPlayers(); playerId++)
+        game.AddAIPlayer(AIFactory::Create(AI::Info(AI::Type::Default, AI::Level::Hard), playerId, world));
+    game.SetNumAIThreads(numThreads);
+
+    std::vector<std::string> commands;
+    constexpr unsigned nwfLength = 5;
+    for(unsigned gf = 0; gf < 1000; gf += nwfLength)
+    {
+        for(unsigned playerId = 0; playerId < world.GetNumPlayers(); playerId++)
+        {
+            Serializer ser;
+            for(gc::GameCommandPtr& gc : game.aiPlayers_[playerId].FetchGameCommands())
+            {
+                gc->Serialize(ser);
+                gc->Execute(world, playerId);
+            }
+            commands.emplace_back(reinterpret_cast<const char*>(ser.GetData()), ser.GetLength());
+        }
+        for(unsigned i = 0; i < nwfLength; i++)
+        {
+            fixture.em.ExecuteNextGF();
+            game.RunAIs(fixture.em.GetCurrentGF(), i == 0);
+        }
+    }
+    return std::make_pair(commands, GameObject::GetObjIDCounter() - startObjIdCounter);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ParallelAIsAreReproducible)
+{
+    const auto sequentialResult = runAIsAndRecordCommands(1);
+    // Sanity check: The AIs did something
+    BOOST_TEST_REQUIRE(
+      helpers::contains_if(sequentialResult.first, [](const std::string& cmds) { return !cmds.empty(); }));
+    BOOST_TEST_REQUIRE(sequentialResult.second > 0u);
+    BOOST_TEST((runAIsAndRecordCommands(1) == sequentialResult));
+    BOOST_TEST((runAIsAndRecordCommands(4) == sequentialResult));
+}
+
 BOOST_FIXTURE_TEST_CASE(KeepBQUpdated, BiggerWorldWithGCExecution)
 {
     // Place some trees to reduce BQ at some points
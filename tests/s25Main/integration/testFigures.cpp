@@ -3,16 +3,20 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GamePlayer.h"
+#include "GlobalGameSettings.h"
 #include "PointOutput.h"
 #include "RttrForeachPt.h"
+#include "addons/const_addons.h"
 #include "buildings/nobBaseWarehouse.h"
 #include "factories/BuildingFactory.h"
 #include "figures/noFigure.h"
 #include "figures/nofGeologist.h"
 #include "figures/nofScout_Free.h"
 #include "notifications/ResourceNote.h"
+#include "pathfinding/PathConditionHuman.h"
 #include "worldFixtures/WorldWithGCExecution.h"
 #include "nodeObjs/noFlag.h"
+#include "nodeObjs/noGranite.h"
 #include "nodeObjs/noSign.h"
 #include "gameTypes/GameTypesOutput.h"
 #include "rttr/test/random.hpp"
@@ -146,4 +150,67 @@ BOOST_FIXTURE_TEST_CASE(GeologistPlacesSigns, EmptyWorldFixture1P)
     }
 }
 
+namespace {
+/// Scout which can be moved around freely to test the off-road path search
+class TestWalkingFigure : public nofScout_Free
+{
+public:
+    using nofScout_Free::nofScout_Free;
+    using noFigure::FindFreePathDir;
+
+    void MoveTo(MapPoint pt)
+    {
+        auto self = world->RemoveFigure(pos, *this);
+        pos = pt;
+        world->AddFigure(pt, std::move(self));
+    }
+};
+} // namespace
+
+using EmptyWorldFixture1PWide = WorldFixture<CreateEmptyWorld, 1, 40, 30>;
+
+BOOST_FIXTURE_TEST_CASE(FreeWalkingFollowsRoute, EmptyWorldFixture1PWide)
+{
+    ggs.setSelection(AddonId::FOLLOW_FREE_ROUTES, 1);
+    // Far away from the HQ
+    const MapPoint start(3, 3), dest(10, 25);
+    auto& figure = world.AddFigure(start, std::make_unique<TestWalkingFigure>(start, 0, nullptr));
+    const PathConditionHuman pathChecker(world);
+
+    const auto walkToDest = [&](unsigned blockAtStep) {
+        // Route found by the first search of the figure
+        std::vector<Direction> route;
+        BOOST_TEST_REQUIRE(world.FindHumanPath(figure.GetPos(), dest, 100, false, nullptr, &route));
+        unsigned numSteps = 0;
+        while(figure.GetPos() != dest)
+        {
+            BOOST_TEST_REQUIRE(numSteps < 100u);
+            if(numSteps == blockAtStep)
+            {
+                // Block the route ahead, so a new one must be searched
+                const MapPoint nextPt = world.GetNeighbour(figure.GetPos(), route[numSteps]);
+                world.SetNO(world.GetNeighbour(nextPt, route[numSteps + 1]), new noGranite(GraniteType::One, 1));
+            }
+            const auto dir = figure.FindFreePathDir(dest, 100);
+            BOOST_TEST_REQUIRE(dir);
+            if(numSteps < blockAtStep)
+                BOOST_TEST(*dir == route[numSteps]);
+            BOOST_TEST_REQUIRE(pathChecker.IsEdgeOk(figure.GetPos(), *dir));
+            const MapPoint nextPt = world.GetNeighbour(figure.GetPos(), *dir);
+            BOOST_TEST_REQUIRE((nextPt == dest || pathChecker.IsNodeOk(nextPt)));
+            figure.MoveTo(nextPt);
+            numSteps++;
+        }
+        return numSteps;
+    };
+    const unsigned distance = world.CalcDistance(start, dest);
+    // Unobstructed the shortest route is followed till the end
+    BOOST_TEST(walkToDest(100) == distance);
+    figure.MoveTo(start);
+    // Walk around the obstacle
+    const unsigned numSteps = walkToDest(5);
+    BOOST_TEST(numSteps >= distance);
+    BOOST_TEST(numSteps <= distance + 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,7 @@
 #include "worldFixtures/TestEventManager.h"
 #include <rttr/test/LogAccessor.hpp>
 #include <boost/test/unit_test.hpp>
+#include <limits>
 
 BOOST_AUTO_TEST_SUITE(GameEventsTestSuite)
 
@@ -107,6 +108,53 @@ BOOST_AUTO_TEST_CASE(MultipleEvents)
     BOOST_TEST_REQUIRE(obj.handledEventIds[2] == 44u);
 }
 
+BOOST_AUTO_TEST_CASE(LongEventsKeepOrder)
+{
+    TestEventManager evMgr(0);
+    TestEventHandler obj;
+    const unsigned farGF = 200000;
+    // Events far in the future and events of the same GF added later must be executed in the order they were added
+    evMgr.AddEvent(&obj, farGF, 3);
+    evMgr.AddEvent(&obj, 2000, 1);
+    evMgr.AddEvent(&obj, 1, 0);
+    evMgr.AddEvent(&obj, farGF - 10, 2);
+    const std::vector<const GameEvent*> evts = evMgr.GetEvents();
+    BOOST_TEST_REQUIRE(evts.size() == 4u);
+    for(unsigned i = 0; i < evts.size(); i++)
+        BOOST_TEST(evts[i]->id == i);
+    while(evMgr.GetCurrentGF() < 1500)
+        evMgr.ExecuteNextGF();
+    evMgr.AddEvent(&obj, 500, 11);
+    BOOST_TEST_REQUIRE(evMgr.ExecuteNextEvent() == 500u);
+    BOOST_TEST_REQUIRE(obj.handledEventIds == std::vector<unsigned>({0, 1, 11}), boost::test_tools::per_element());
+    while(evMgr.GetCurrentGF() < farGF - 1000)
+        evMgr.ExecuteNextGF();
+    evMgr.AddEvent(&obj, 1000, 33);
+    evMgr.AddEvent(&obj, 990, 22);
+    while(evMgr.GetCurrentGF() < farGF)
+        evMgr.ExecuteNextGF();
+    BOOST_TEST(obj.handledEventIds == std::vector<unsigned>({0, 1, 11, 2, 22, 3, 33}),
+               boost::test_tools::per_element());
+    BOOST_TEST(evMgr.GetNumActiveEvents() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(EventsAtEndOfGFRange)
+{
+    // The calculations of the blocks must not overflow
+    constexpr unsigned maxGF = std::numeric_limits<unsigned>::max();
+    TestEventManager evMgr(maxGF - 2000);
+    TestEventHandler obj;
+    evMgr.AddEvent(&obj, 1900, 2);
+    evMgr.AddEvent(&obj, 1500, 1);
+    BOOST_TEST_REQUIRE(evMgr.ExecuteNextEvent() == 1500u);
+    BOOST_TEST_REQUIRE(evMgr.ExecuteNextEvent() == 400u);
+    BOOST_TEST(obj.handledEventIds == std::vector<unsigned>({1, 2}), boost::test_tools::per_element());
+    // Without events it advances to the end
+    BOOST_TEST(evMgr.ExecuteNextEvent() == 100u);
+    BOOST_TEST(evMgr.GetCurrentGF() == maxGF);
+    BOOST_TEST(evMgr.ExecuteNextEvent() == 0u);
+}
+
 BOOST_AUTO_TEST_CASE(Reschedule)
 {
     TestEventManager evMgr(0);
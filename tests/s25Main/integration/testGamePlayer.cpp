@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "FindWhConditions.h"
 #include "GamePlayer.h"
 #include "buildings/nobBaseWarehouse.h"
 #include "buildings/nobMilitary.h"
@@ -11,6 +12,7 @@
 #include "ingameWindows/iwBuildingProductivities.h"
 #include "worldFixtures/CreateEmptyWorld.h"
 #include "worldFixtures/WorldFixture.h"
+#include "nodeObjs/noFlag.h"
 #include "gameData/BuildingProperties.h"
 #include "rttr/test/random.hpp"
 #include "s25util/warningSuppression.h"
@@ -119,3 +121,37 @@ BOOST_FIXTURE_TEST_CASE(ProductivityStats, WorldFixtureEmpty1P)
     BOOST_TEST(buildingRegister.CalcProductivities() == expectedProductivity, per_element());
     BOOST_TEST(buildingRegister.CalcAverageProductivity() == avgProd);
 }
+
+BOOST_FIXTURE_TEST_CASE(FindWarehouseAfterRoadChanges, WorldFixtureEmpty2P)
+{
+    GamePlayer& player = world.GetPlayer(0);
+    const nobBaseWarehouse* hq = player.GetFirstWH();
+    const MapPoint hqFlagPos = world.GetNeighbour(player.GetHQPos(), Direction::SouthEast);
+    const MapPoint flagPos = world.MakeMapPoint(hqFlagPos + Position(4, 0));
+    world.SetFlag(flagPos, 0);
+    const noFlag& flag = *world.GetSpecObj<noFlag>(flagPos);
+    BOOST_TEST(!player.FindWarehouse(flag, FW::NoCondition(), true, false));
+
+    world.BuildRoad(0, false, hqFlagPos, std::vector<Direction>(4, Direction::East));
+    unsigned length = 0;
+    // Repeated queries and both directions yield the same result
+    for(int i = 0; i < 2; i++)
+    {
+        BOOST_TEST(player.FindWarehouse(flag, FW::NoCondition(), true, false, &length) == hq);
+        BOOST_TEST(length == 5u);
+        BOOST_TEST(player.FindWarehouse(flag, FW::NoCondition(), false, false, &length) == hq);
+        BOOST_TEST(length == 5u);
+    }
+    // Forbidden road
+    BOOST_TEST(!player.FindWarehouse(flag, FW::NoCondition(), true, false, nullptr, flag.GetRoute(Direction::West)));
+
+    // Splitting the road doesn't change the result
+    const MapPoint middleFlagPos = world.MakeMapPoint(hqFlagPos + Position(2, 0));
+    world.SetFlag(middleFlagPos, 0);
+    BOOST_TEST(player.FindWarehouse(flag, FW::NoCondition(), true, false, &length) == hq);
+    BOOST_TEST(length == 5u);
+    // But removing it does
+    world.DestroyFlag(middleFlagPos, 0);
+    BOOST_TEST(!player.FindWarehouse(flag, FW::NoCondition(), true, false));
+    BOOST_TEST(!player.FindWarehouse(flag, FW::NoCondition(), false, false));
+}
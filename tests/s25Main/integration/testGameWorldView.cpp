@@ -3,11 +3,15 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "PointOutput.h"
+#include "helpers/containerUtils.h"
 #include "uiHelper/uiHelpers.hpp"
 #include "worldFixtures/CreateEmptyWorld.h"
 #include "worldFixtures/WorldFixture.h"
+#include "world/GameWorldDrawList.h"
 #include "world/GameWorldView.h"
 #include "world/GameWorldViewer.h"
+#include "nodeObjs/noAnimal.h"
+#include "nodeObjs/noEnvObject.h"
 #include "gameData/MapConsts.h"
 #include "rttr/test/random.hpp"
 #include <boost/test/unit_test.hpp>
@@ -107,4 +111,51 @@ BOOST_FIXTURE_TEST_CASE(GetsCorrectMaxHeight, EmptyWorldFixture1P)
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(DrawListIsIndependentOfThreads, EmptyWorldFixture1P)
+{
+    uiHelper::initGUITests(); // Required for GameWorldView
+
+    const MapPoint hqPos = world.GetPlayer(0).GetHQPos();
+    const MapPoint envPt = world.MakeMapPoint(Position(hqPos) + Position(2, 2));
+    auto* envObj = new noEnvObject(envPt, 500);
+    world.SetNO(envPt, envObj);
+    const MapPoint animalPt = world.MakeMapPoint(Position(hqPos) + Position(-2, 3));
+    auto& animal = world.AddFigure(animalPt, std::make_unique<noAnimal>(Species::Deer, animalPt));
+
+    GameWorldViewer gwv(0, world);
+    // Big enough to be split into multiple bands
+    GameWorldView view(gwv, Position(0, 0), Extent(4000, 3000));
+    const Position mousePos = rttr::test::randomPoint<Position>(0, 1000);
+
+    GameWorldDrawListBuilder builder;
+    builder.SetNumThreads(1);
+    GameWorldDrawList singleThreaded;
+    builder.Build(view, mousePos, singleThreaded);
+    BOOST_TEST_REQUIRE(singleThreaded.hasSelPt());
+
+    // The view is bigger than the map so the objects are drawn multiple times, but once without wrapping
+    const auto containsEntry = [&](noBase& obj, const MapPoint pt) {
+        const DrawListEntry expected{DrawListEntryType::Object, Visibility::Visible, pt, world.GetNodePos(pt), &obj,
+                                     nullptr};
+        return helpers::contains(singleThreaded.entries, expected);
+    };
+    BOOST_TEST(containsEntry(*envObj, envPt));
+    BOOST_TEST(containsEntry(animal, animalPt));
+
+    for(unsigned numThreads = 2; numThreads <= 4; numThreads++)
+    {
+        builder.SetNumThreads(numThreads);
+        GameWorldDrawList multiThreaded;
+        // Multiple times to reuse the workers
+        for(int i = 0; i < 2; i++)
+        {
+            builder.Build(view, mousePos, multiThreaded);
+            BOOST_TEST((multiThreaded.entries == singleThreaded.entries));
+            BOOST_TEST(multiThreaded.selPt == singleThreaded.selPt);
+            BOOST_TEST(multiThreaded.selPtOffset == singleThreaded.selPtOffset);
+            BOOST_TEST(multiThreaded.selPtDistance == singleThreaded.selPtDistance);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AsyncChecksum.h"
+#include "Game.h"
+#include "GamePlayer.h"
+#include "GlobalGameSettings.h"
+#include "PlayerInfo.h"
+#include "factories/BuildingFactory.h"
+#include "random/Random.h"
+#include "worldFixtures/CreateEmptyWorld.h"
+#include "world/GameWorld.h"
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(ParallelGames)
+
+namespace {
+/// Play a game with some buildings connected by roads and return the checksum at the end.
+/// Does not use Boost.Test macros as it runs in other threads
+AsyncChecksum runGame(const unsigned seed)
+{
+    PlayerInfo playerInfo;
+    playerInfo.ps = PlayerState::Occupied;
+    GlobalGameSettings ggs;
+    ggs.exploration = Exploration::Classic;
+    Game game(ggs, 0, std::vector<PlayerInfo>(2, playerInfo));
+    GameWorld& world = game.world_;
+    {
+        // The world creation may use the RNG of the tests which is shared by all threads
+        static std::mutex createMutex;
+        std::lock_guard<std::mutex> lock(createMutex);
+        if(!CreateEmptyWorld(MapExtent(40, 20))(world))
+            throw std::runtime_error("Failed to create world");
+    }
+    RANDOM.Init(seed);
+    for(unsigned playerId = 0; playerId < world.GetNumPlayers(); playerId++)
+    {
+        // The forester plants trees at random places, the woodcutter is built first (wares on roads, builder)
+        // and then cuts those trees (free paths)
+        const MapPoint hqPos = world.GetPlayer(playerId).GetHQPos();
+        const MapPoint foresterPos = hqPos + MapPoint(2, 0);
+        BuildingFactory::CreateBuilding(world, BuildingType::Forester, foresterPos, playerId, Nation::Romans);
+        world.BuildRoad(playerId, false, world.GetNeighbour(foresterPos, Direction::SouthEast),
+                        std::vector<Direction>(2, Direction::West));
+        const MapPoint woodcutterPos = hqPos - MapPoint(2, 0);
+        world.SetBuildingSite(BuildingType::Woodcutter, woodcutterPos, playerId);
+        world.BuildRoad(playerId, false, world.GetNeighbour(woodcutterPos, Direction::SouthEast),
+                        std::vector<Direction>(2, Direction::East));
+    }
+
+    for(unsigned gf = 0; gf < 3000; gf++)
+        game.em_->ExecuteNextGF();
+    return AsyncChecksum::create(game);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ParallelGamesMatchSerialGames)
+{
+    // Games use the path finders and other state which must not be shared between threads
+    const std::array<unsigned, 2> seeds = {{42, 1337}};
+    std::array<AsyncChecksum, 2> serialResults;
+    for(unsigned i = 0; i < seeds.size(); i++)
+        serialResults[i] = runGame(seeds[i]);
+    // Sanity check: The games differ
+    BOOST_TEST_REQUIRE(serialResults[0] != serialResults[1]);
+
+    std::array<AsyncChecksum, 2> parallelResults;
+    std::array<std::exception_ptr, 2> errors;
+    std::vector<std::thread> threads;
+    for(unsigned i = 0; i < seeds.size(); i++)
+    {
+        threads.emplace_back([&, i]() {
+            try
+            {
+                parallelResults[i] = runGame(seeds[i]);
+            } catch(...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for(std::thread& thread : threads)
+        thread.join();
+    for(unsigned i = 0; i < seeds.size(); i++)
+    {
+        BOOST_TEST_REQUIRE(!errors[i]);
+        BOOST_TEST(parallelResults[i] == serialResults[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
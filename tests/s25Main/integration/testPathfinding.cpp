@@ -2,17 +2,27 @@
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "GamePlayer.h"
+#include "GlobalGameSettings.h"
 #include "RttrForeachPt.h"
+#include "addons/const_addons.h"
 #include "helpers/OptionalIO.h"
+#include "pathfinding/FreePathFinderImpl.h"
+#include "pathfinding/PathConditionHuman.h"
+#include "pathfinding/RoadPathFinder.h"
 #include "worldFixtures/CreateEmptyWorld.h"
 #include "worldFixtures/WorldFixture.h"
 #include "worldFixtures/terrainHelpers.h"
 #include "nodeObjs/noGranite.h"
+#include "nodeObjs/noRoadNode.h"
 #include "gameTypes/GameTypesOutput.h"
 #include "gameData/GameConsts.h"
 #include <rttr/test/testHelpers.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 // Tests are designed to check for every possible direction and terrain distribution
@@ -254,4 +264,169 @@ BOOST_FIXTURE_TEST_CASE(BlockedPaths, WorldFixtureEmpty0P)
     BOOST_TEST_REQUIRE(world.FindHumanPath(startPt, surroundingPts2[0]));
 }
 
+using WorldFixtureEmpty1PBig = WorldFixture<CreateEmptyWorld, 1, 24, 24>;
+BOOST_FIXTURE_TEST_CASE(WarePathCostsEqualFindPath, WorldFixtureEmpty1PBig)
+{
+    RoadPathFinder& pathFinder = world.GetRoadPathFinder();
+    const MapPoint hqFlagPos = world.GetNeighbour(world.GetPlayer(0).GetHQPos(), Direction::SouthEast);
+    // Grid of flags with some roads left out to get detours
+    std::vector<const noRoadNode*> goals;
+    unsigned roadIdx = 0;
+    for(int y = 0; y < 4; y++)
+    {
+        for(int x = -2; x <= 2; x++)
+        {
+            const MapPoint pt = world.MakeMapPoint(hqFlagPos + Position(2 * x, 2 * y));
+            if(pt != hqFlagPos)
+                world.SetFlag(pt, 0);
+            if(x > -2 && roadIdx++ % 3 != 1)
+                world.BuildRoad(0, false, world.MakeMapPoint(pt - Position(2, 0)), {Direction::East, Direction::East});
+            if(y > 0 && roadIdx++ % 3 != 1)
+            {
+                world.BuildRoad(0, false, world.MakeMapPoint(pt - Position(0, 2)),
+                                {Direction::SouthEast, Direction::SouthWest});
+            }
+            const auto* flag = world.GetSpecObj<noRoadNode>(pt);
+            BOOST_TEST_REQUIRE(flag);
+            goals.push_back(flag);
+            if(y == 1)
+            {
+                const MapPoint bldPos = world.GetNeighbour(pt, Direction::NorthWest);
+                world.SetBuildingSite(BuildingType::Woodcutter, bldPos, 0);
+                if(world.GetSpecObj<noRoadNode>(bldPos))
+                    goals.push_back(world.GetSpecObj<noRoadNode>(bldPos));
+            }
+        }
+    }
+    goals.push_back(world.GetSpecObj<noRoadNode>(world.GetPlayer(0).GetHQPos()));
+
+    const std::vector<unsigned> maxValues{std::numeric_limits<unsigned>::max(), 2000, 600, 60, 5};
+    for(const noRoadNode* start : goals)
+    {
+        std::vector<std::pair<bool, unsigned>> expectedResults;
+        for(const unsigned max : maxValues)
+        {
+            for(const noRoadNode* goal : goals)
+            {
+                unsigned length = 0;
+                const bool found = goal != start && pathFinder.FindPath(*start, *goal, true, max, nullptr, &length);
+                expectedResults.emplace_back(found, found ? length : 0);
+            }
+        }
+        RoadPathFinder::WarePathCosts pathCosts(pathFinder, *start);
+        auto itExpected = expectedResults.begin();
+        for(const unsigned max : maxValues)
+        {
+            for(const noRoadNode* goal : goals)
+            {
+                unsigned length = 0;
+                const bool found = goal != start && pathCosts.FindPath(*goal, max, length);
+                BOOST_TEST(found == itExpected->first);
+                if(found)
+                    BOOST_TEST(length == itExpected->second);
+                ++itExpected;
+            }
+        }
+    }
+}
+
+using WorldFixtureEmpty0PHuge = WorldFixture<CreateEmptyWorld, 0, 96, 80>;
+BOOST_FIXTURE_TEST_CASE(HierarchicalPathsAreValid, WorldFixtureEmpty0PHuge)
+{
+    // Walls of stones with a few gaps
+    for(MapCoord y = 0; y < world.GetHeight(); y++)
+    {
+        if(y % 40 != 10)
+            world.SetNO(MapPoint(30, y), new noGranite(GraniteType::One, 1));
+        if(y % 25 != 3)
+            world.SetNO(MapPoint(70, y), new noGranite(GraniteType::One, 1));
+    }
+    const auto checkPaths = [this]() {
+        for(unsigned i = 0; i < 40; i++)
+        {
+            const MapPoint start((i * 37) % world.GetWidth(), (i * 11) % world.GetHeight());
+            const MapPoint dest((i * 53 + 45) % world.GetWidth(), (i * 29 + 7) % world.GetHeight());
+            if(start == dest || !PathConditionHuman(world).IsNodeOk(start))
+                continue;
+            ggs.setSelection(AddonId::HIERARCHICAL_PATHFINDING, 0);
+            unsigned expectedLength = 0;
+            const bool expectedFound = world.FindHumanPath(start, dest, 500, false, &expectedLength).has_value();
+            ggs.setSelection(AddonId::HIERARCHICAL_PATHFINDING, 1);
+            unsigned length = 0;
+            std::vector<Direction> route;
+            const auto dir = world.FindHumanPath(start, dest, 500, false, &length, &route);
+            BOOST_TEST_REQUIRE(dir.has_value() == expectedFound);
+            if(!expectedFound)
+                continue;
+            BOOST_TEST(length >= expectedLength);
+            BOOST_TEST(length <= 500u);
+            BOOST_TEST_REQUIRE(route.size() == length);
+            BOOST_TEST(route.front() == *dir);
+            MapPoint routeEnd;
+            BOOST_TEST_REQUIRE(
+              world.GetFreePathFinder().CheckRoute(start, route, 0, PathConditionHuman(world), &routeEnd));
+            BOOST_TEST(routeEnd == dest);
+        }
+    };
+    checkPaths();
+    // Close gaps, the changed clusters must be updated
+    world.SetNO(MapPoint(30, 10), new noGranite(GraniteType::One, 1));
+    world.SetNO(MapPoint(70, 53), new noGranite(GraniteType::One, 1));
+    checkPaths();
+    // And open new ones
+    world.DestroyNO(MapPoint(30, 62));
+    world.DestroyNO(MapPoint(70, 30));
+    checkPaths();
+}
+
+using WorldFixtureEmpty0PMedium = WorldFixture<CreateEmptyWorld, 0, 30, 24>;
+BOOST_FIXTURE_TEST_CASE(PathLengthsMatchPaths, WorldFixtureEmpty0PMedium)
+{
+    // Some walls and blocked nodes
+    for(MapCoord y = 2; y < world.GetHeight() - 2; y++)
+        world.SetNO(MapPoint(8, y), new noGranite(GraniteType::One, 1));
+    for(MapCoord x = 8; x < 20; x++)
+        world.SetNO(MapPoint(x, 14), new noGranite(GraniteType::One, 1));
+    const MapPoint start(4, 10);
+    std::vector<MapPoint> targets;
+    RTTR_FOREACH_PT(MapPoint, world.GetSize())
+    {
+        if(pt != start)
+            targets.push_back(pt);
+    }
+    // Duplicates are allowed
+    targets.push_back(targets.front());
+    FreePathFinder& pathFinder = world.GetFreePathFinder();
+    const PathConditionHuman pathChecker(world);
+    for(const unsigned maxLength : {0u, 1u, 5u, 12u, 1000u})
+    {
+        const std::vector<unsigned> lengths = pathFinder.FindPathLengths(start, targets, maxLength, pathChecker);
+        BOOST_TEST_REQUIRE(lengths.size() == targets.size());
+        for(unsigned i = 0; i < targets.size(); i++)
+        {
+            unsigned expectedLength = FreePathFinder::unreachable;
+            pathFinder.FindPath(start, targets[i], false, maxLength, nullptr, &expectedLength, nullptr, pathChecker);
+            BOOST_TEST(lengths[i] == expectedLength);
+        }
+    }
+    // Start is reachable without walking
+    BOOST_TEST(pathFinder.FindPathLengths(start, {start}, 5, pathChecker) == std::vector<unsigned>{0u});
+
+    // Only the closest targets are returned, equally distant ones in order of the targets
+    const std::vector<unsigned> allLengths = pathFinder.FindPathLengths(start, targets, 1000, pathChecker);
+    for(const unsigned maxHits : {1u, 7u, 50u})
+    {
+        const std::vector<unsigned> lengths = pathFinder.FindPathLengths(start, targets, 1000, pathChecker, maxHits);
+        std::vector<unsigned> order(targets.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(),
+                         [&allLengths](unsigned lhs, unsigned rhs) { return allLengths[lhs] < allLengths[rhs]; });
+        for(unsigned i = 0; i < order.size(); i++)
+        {
+            const unsigned expectedLength = (i < maxHits) ? allLengths[order[i]] : FreePathFinder::unreachable;
+            BOOST_TEST(lengths[order[i]] == expectedLength);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "AsyncSavegameWriter.h"
 #include "GameCommands.h"
 #include "GameEvent.h"
 #include "GamePlayer.h"
@@ -670,6 +671,49 @@ BOOST_FIXTURE_TEST_CASE(SerializeHunter, EmptyWorldFixture1P)
                                   sgd2.GetData() + sgd2.GetLength());
 }
 
+BOOST_FIXTURE_TEST_CASE(WriteSavegameAsync, EmptyWorldFixture1P)
+{
+    TmpFile tmpFile(".sav");
+    BOOST_TEST_REQUIRE(tmpFile.isValid());
+    tmpFile.close();
+    bfs::path tmpSavePath = tmpFile.filePath;
+    tmpSavePath += ".tmp";
+
+    const auto makeSave = [this]() {
+        auto save = std::make_unique<Savegame>();
+        for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+            save->AddPlayer(world.GetPlayer(i));
+        save->ggs = ggs;
+        save->start_gf = em.GetCurrentGF();
+        save->sgd.MakeSnapshot(*game);
+        return save;
+    };
+
+    AsyncSavegameWriter writer;
+    BOOST_TEST_REQUIRE(writer.Write(makeSave(), tmpFile.filePath, "MapTitle"));
+    writer.Wait();
+    BOOST_TEST(!writer.IsBusy());
+    BOOST_TEST(writer.TakeErrors().empty());
+    // Written to a temporary file which got renamed
+    BOOST_TEST(!bfs::exists(tmpSavePath));
+
+    Savegame loadSave;
+    BOOST_TEST_REQUIRE(loadSave.Load(tmpFile.filePath, SaveGameDataToLoad::All));
+    BOOST_TEST(loadSave.GetMapName() == "MapTitle");
+    BOOST_TEST(loadSave.start_gf == em.GetCurrentGF());
+    const auto expectedSave = makeSave();
+    BOOST_CHECK_EQUAL_COLLECTIONS(loadSave.sgd.GetData(), loadSave.sgd.GetData() + loadSave.sgd.GetLength(),
+                                  expectedSave->sgd.GetData(),
+                                  expectedSave->sgd.GetData() + expectedSave->sgd.GetLength());
+
+    // Errors are reported and the existing file is kept
+    BOOST_TEST_REQUIRE(writer.Write(makeSave(), tmpFile.filePath.parent_path() / "nonExistingDir" / "foo.sav", ""));
+    writer.Wait();
+    BOOST_TEST(writer.TakeErrors().size() == 1u);
+    BOOST_TEST(writer.TakeErrors().empty());
+    BOOST_TEST(bfs::exists(tmpFile.filePath));
+}
+
 BOOST_AUTO_TEST_CASE(SerializeGameMessageChat)
 {
     const GameMessage_Chat msg(rttr::test::randomValue(0u, 10u), rttr::test::randomEnum<ChatDestination>(), "Hello");
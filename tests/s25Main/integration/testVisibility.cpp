@@ -0,0 +1,93 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GamePlayer.h"
+#include "PointOutput.h"
+#include "buildings/nobHQ.h"
+#include "figures/nofScout_Free.h"
+#include "worldFixtures/CreateEmptyWorld.h"
+#include "worldFixtures/WorldFixture.h"
+#include "world/SightSources.h"
+#include "gameTypes/GameTypesOutput.h"
+#include "gameData/MilitaryConsts.h"
+#include "rttr/test/random.hpp"
+#include <boost/test/unit_test.hpp>
+
+namespace {
+using VisibilityFixture = WorldFixture<CreateEmptyWorld, 2, 60, 40>;
+
+void addScouts(GameWorld& world, unsigned numScouts)
+{
+    for(unsigned i = 0; i < numScouts; i++)
+    {
+        const MapPoint pt(rttr::test::randomValue<MapCoord>(0, world.GetWidth() - 1),
+                          rttr::test::randomValue<MapCoord>(0, world.GetHeight() - 1));
+        const unsigned char player = rttr::test::randomValue(0, 1);
+        world.AddFigure(pt, std::make_unique<nofScout_Free>(pt, player, nullptr));
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(Visibility)
+
+BOOST_FIXTURE_TEST_CASE(ScoutingFigureCounters, VisibilityFixture)
+{
+    const MapPoint pt(10, 12);
+    BOOST_TEST(!world.MayHaveScoutingFigure(pt, 0));
+    BOOST_TEST(!world.MayHaveScoutingFigure(pt, 1));
+    auto& scout = world.AddFigure(pt, std::make_unique<nofScout_Free>(pt, 1, nullptr));
+    auto& scout2 = world.AddFigure(pt, std::make_unique<nofScout_Free>(pt, 1, nullptr));
+    BOOST_TEST(!world.MayHaveScoutingFigure(pt, 0));
+    BOOST_TEST(world.MayHaveScoutingFigure(pt, 1));
+    BOOST_TEST(!world.MayHaveScoutingFigure(world.GetNeighbour(pt, Direction::East), 1));
+    world.RemoveFigure(pt, scout);
+    BOOST_TEST(world.MayHaveScoutingFigure(pt, 1));
+    world.RemoveFigure(pt, scout2);
+    BOOST_TEST(!world.MayHaveScoutingFigure(pt, 1));
+}
+
+BOOST_FIXTURE_TEST_CASE(SightSourcesEqualPointCheck, VisibilityFixture)
+{
+    addScouts(world, 20);
+    const nobHQ* hq = world.GetSpecObj<nobHQ>(world.GetPlayer(0).GetHQPos());
+    BOOST_TEST_REQUIRE(hq);
+    for(unsigned i = 0; i < 20; i++)
+    {
+        const MapPoint center(rttr::test::randomValue<MapCoord>(0, world.GetWidth() - 1),
+                              rttr::test::randomValue<MapCoord>(0, world.GetHeight() - 1));
+        const unsigned radius = rttr::test::randomValue(0u, 20u);
+        for(unsigned char player = 0; player < world.GetNumPlayers(); player++)
+        {
+            for(const noBaseBuilding* exception : {static_cast<const noBaseBuilding*>(nullptr), hq})
+            {
+                const SightSources sources(world, player, exception);
+                for(const MapPoint pt : world.GetPointsInRadiusWithCenter(center, radius))
+                {
+                    BOOST_TEST_INFO("Player " << unsigned(player) << " at " << pt << " around " << center);
+                    BOOST_TEST(sources.IsVisible(pt) == world.IsPointCompletelyVisible(pt, player, exception));
+                }
+            }
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(RecalcVisibilitiesAroundPoint, VisibilityFixture)
+{
+    ggs.exploration = Exploration::FogOfWar;
+    addScouts(world, 10);
+    const nobHQ* hq = world.GetSpecObj<nobHQ>(world.GetPlayer(0).GetHQPos());
+    const unsigned radius = hq->GetMilitaryRadius() + VISUALRANGE_MILITARY + 1;
+    world.MakeVisibleAroundPoint(hq->GetPos(), radius, 0);
+    // Recalc as if the HQ was destroyed
+    world.RecalcVisibilitiesAroundPoint(hq->GetPos(), radius, 0, hq);
+    for(const MapPoint pt : world.GetPointsInRadiusWithCenter(hq->GetPos(), radius))
+    {
+        BOOST_TEST_INFO(pt);
+        const auto expectedVis =
+          world.IsPointCompletelyVisible(pt, 0, hq) ? Visibility::Visible : Visibility::FogOfWar;
+        BOOST_TEST(world.GetFoWNode(pt, 0).visibility == expectedVis);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -824,10 +824,9 @@ BOOST_AUTO_TEST_CASE(onExplored)
     std::map<int, Points> gamePtsPerPlayer;
     RTTR_FOREACH_PT(MapPoint, world.GetSize())
     {
-        const MapNode& node = world.GetNode(pt);
         for(unsigned i = 0; i < world.GetNumPlayers(); i++)
         {
-            if(node.fow[i].visibility == Visibility::Visible)
+            if(world.GetFoWNode(pt, i).visibility == Visibility::Visible)
                 gamePtsPerPlayer[i].push_back(std::pair<int, int>(pt.x, pt.y));
         }
     }
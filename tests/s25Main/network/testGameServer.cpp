@@ -0,0 +1,230 @@
+// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GlobalGameSettings.h"
+#include "JoinPlayerInfo.h"
+#include "RTTR_Version.h"
+#include "TestServer.h"
+#include "network/CreateServerInfo.h"
+#include "network/GameMessage.h"
+#include "network/GameMessages.h"
+#include "network/GameServer.h"
+#include "gameTypes/AIInfo.h"
+#include "gameTypes/MapDescription.h"
+#include "gameTypes/MapInfo.h"
+#include "test/testConfig.h"
+#include "rttr/test/LogAccessor.hpp"
+#include "rttr/test/random.hpp"
+#include "s25util/SocketSet.h"
+#include <boost/filesystem/path.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+const bfs::path testMapPath = rttr::test::rttrBaseDir / "tests" / "testData" / "maps" / "LuaFunctions.SWD";
+/// The map has 3 player slots
+constexpr unsigned numMapPlayers = 3;
+
+/// Client talking to the server by sending the messages of the GameClient directly
+struct TestClient
+{
+    Connection con;
+    unsigned playerId = GameMessageWithPlayer::NO_PLAYER_ID;
+
+    TestClient() : con(GameMessage::create_game) {}
+
+    void send(GameMessage* msg)
+    {
+        con.sendQueue.push(msg);
+        con.sendQueue.send(con.so, 10);
+    }
+
+    /// Receive all pending messages. Return false if the connection was closed
+    bool receive()
+    {
+        SocketSet set;
+        set.Add(con.so);
+        while(set.Select(0, 0) > 0)
+        {
+            if(con.recvQueue.recv(con.so) < 0)
+                return false;
+            set.Clear();
+            set.Add(con.so);
+        }
+        return true;
+    }
+
+    /// Run the server until this client received a message of type T. Other messages are dropped.
+    /// Return nullptr if none arrived within a few seconds or the server closed the connection
+    template<class T>
+    std::unique_ptr<T> waitFor(GameServer& server)
+    {
+        const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while(std::chrono::steady_clock::now() < endTime)
+        {
+            server.Run();
+            const bool isConnected = receive();
+            while(!con.recvQueue.empty())
+            {
+                auto msg = con.recvQueue.pop();
+                if(dynamic_cast<T*>(msg.get()))
+                    return std::unique_ptr<T>(static_cast<T*>(msg.release()));
+            }
+            if(!isConnected)
+                break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nullptr;
+    }
+
+    /// Connect and send the password. Return true if the server accepted it.
+    /// Note: The server drops the connection on a wrong password without sending the answer
+    bool connect(GameServer& server, const uint16_t port, const std::string& password)
+    {
+        BOOST_TEST_REQUIRE(con.so.Connect("localhost", port, false));
+        const auto idMsg = waitFor<GameMessage_Player_Id>(server);
+        BOOST_TEST_REQUIRE(idMsg);
+        playerId = idMsg->player;
+        send(new GameMessage_Server_Type(ServerType::Direct, rttr::version::GetRevision()));
+        const auto typeMsg = waitFor<GameMessage_Server_TypeOK>(server);
+        BOOST_TEST_REQUIRE(typeMsg);
+        BOOST_TEST_REQUIRE((typeMsg->err_code == GameMessage_Server_TypeOK::StatusCode::Ok));
+        send(new GameMessage_Server_Password(password));
+        const auto pwMsg = waitFor<GameMessage_Server_Password>(server);
+        return pwMsg && pwMsg->password == "true";
+    }
+
+    /// Join the game after the password was accepted. Return the players as sent by the server
+    std::vector<JoinPlayerInfo> join(GameServer& server)
+    {
+        MapInfo mapInfo;
+        BOOST_TEST_REQUIRE(mapInfo.mapData.CompressFromFile(testMapPath, &mapInfo.mapChecksum));
+        BOOST_TEST_REQUIRE(
+          mapInfo.luaData.CompressFromFile(bfs::path(testMapPath).replace_extension("lua"), &mapInfo.luaChecksum));
+        send(new GameMessage_Map_Checksum(mapInfo.mapChecksum, mapInfo.luaChecksum));
+        const auto playerList = waitFor<GameMessage_Player_List>(server);
+        BOOST_TEST_REQUIRE(playerList);
+        BOOST_TEST_REQUIRE(playerList->playerInfos.size() == numMapPlayers);
+        return playerList->playerInfos;
+    }
+};
+
+struct GameServerFixture
+{
+    rttr::test::LogAccessor logAcc;
+    GameServer server;
+    uint16_t port = 0;
+
+    ~GameServerFixture() { server.Stop(); }
+
+    void startServer(const std::string& password, const std::string& hostPassword)
+    {
+        for(unsigned i = 0; i < 10; i++)
+        {
+            port = static_cast<uint16_t>(rttr::test::randomValue(1024, 49151));
+            if(server.Start(CreateServerInfo(ServerType::Direct, port, "TestGame", password),
+                            MapDescription(testMapPath, MapType::OldMap), hostPassword))
+                return;
+        }
+        BOOST_FAIL("Could not start the server"); // LCOV_EXCL_LINE
+    }
+
+    /// Run the server until the condition is met or the time is up. Return the condition
+    template<class T_Cond>
+    bool runUntil(T_Cond&& cond)
+    {
+        const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while(!cond() && std::chrono::steady_clock::now() < endTime)
+        {
+            server.Run();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return cond();
+    }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(GameServerTests, GameServerFixture)
+
+BOOST_AUTO_TEST_CASE(HostPasswordGrantsHostOnce)
+{
+    startServer("", "hostPw");
+    TestClient host;
+    BOOST_TEST_REQUIRE(host.connect(server, port, "hostPw"));
+    std::vector<JoinPlayerInfo> players = host.join(server);
+    BOOST_TEST(players[host.playerId].isHost);
+
+    // Only 1 host allowed, so the host password is just a wrong password now
+    TestClient secondHost;
+    BOOST_TEST(!secondHost.connect(server, port, "hostPw"));
+
+    TestClient guest;
+    BOOST_TEST_REQUIRE(guest.connect(server, port, ""));
+    players = guest.join(server);
+    BOOST_TEST(players[host.playerId].isHost);
+    BOOST_TEST(!players[guest.playerId].isHost);
+
+    // When the host left someone else can become the host
+    host.con.so.Close();
+    BOOST_TEST_REQUIRE(guest.waitFor<GameMessage_Player_Kicked>(server));
+    TestClient newHost;
+    BOOST_TEST_REQUIRE(newHost.connect(server, port, "hostPw"));
+    players = newHost.join(server);
+    BOOST_TEST(!players[guest.playerId].isHost);
+    BOOST_TEST(players[newHost.playerId].isHost);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyHostPasswordGrantsNothing)
+{
+    startServer("pw", "");
+    TestClient client;
+    BOOST_TEST(!client.connect(server, port, ""));
+
+    TestClient guest;
+    BOOST_TEST_REQUIRE(guest.connect(server, port, "pw"));
+    const std::vector<JoinPlayerInfo> players = guest.join(server);
+    for(const JoinPlayerInfo& player : players)
+        BOOST_TEST(!player.isHost);
+}
+
+BOOST_AUTO_TEST_CASE(AutoStartCountsDownAndStopsWhenAllLeft)
+{
+    startServer("", "");
+    BOOST_TEST(!server.HasAIPlayers());
+    // Fill all slots but one with AIs, so the game can start when the client is ready
+    for(unsigned i = 1; i < numMapPlayers; i++)
+        BOOST_TEST_REQUIRE(server.SetAIPlayer(i, AI::Info(AI::Type::Dummy)));
+    BOOST_TEST(!server.SetAIPlayer(1, AI::Info(AI::Type::Dummy))); // Already used
+    BOOST_TEST(server.HasAIPlayers());
+    server.SetAutoStart(true, 1);
+
+    TestClient client;
+    BOOST_TEST_REQUIRE(client.connect(server, port, ""));
+    BOOST_TEST_REQUIRE(client.playerId == 0u);
+    const std::vector<JoinPlayerInfo> players = client.join(server);
+    BOOST_TEST((players[1].ps == PlayerState::AI));
+    BOOST_TEST((players[2].ps == PlayerState::AI));
+    // Settings can still be changed
+    BOOST_TEST(server.SetGGS(GlobalGameSettings()));
+
+    client.send(new GameMessage_Player_Ready(client.playerId, true));
+    const auto countdown = client.waitFor<GameMessage_Countdown>(server);
+    BOOST_TEST_REQUIRE(countdown);
+    BOOST_TEST(countdown->countdown == 1u);
+    BOOST_TEST_REQUIRE(client.waitFor<GameMessage_Server_Start>(server));
+    BOOST_TEST(server.IsRunning());
+    BOOST_TEST(!server.SetGGS(GlobalGameSettings()));
+
+    // The game can't continue without players
+    client.con.so.Close();
+    BOOST_TEST(runUntil([this]() { return !server.IsRunning(); }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
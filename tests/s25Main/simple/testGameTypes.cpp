@@ -4,12 +4,15 @@
 
 #include "ai/AIResource.h"
 #include "helpers/EnumRange.h"
+#include "gameTypes/CompressedData.h"
 #include "gameTypes/GameTypesOutput.h"
 #include "gameTypes/Resource.h"
 #include <boost/preprocessor/seq/for_each.hpp>
 #include <boost/preprocessor/stringize.hpp>
 #include <boost/preprocessor/variadic/to_seq.hpp>
 #include <boost/test/unit_test.hpp>
+#include <stdexcept>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(GameTypes)
 
@@ -151,4 +154,24 @@ BOOST_AUTO_TEST_CASE(CanUseBqWOrks)
         }
 }
 
+BOOST_AUTO_TEST_CASE(CompressionRoundtrip)
+{
+    std::vector<char> data(10000);
+    for(unsigned i = 0; i < data.size(); i++)
+        data[i] = static_cast<char>((i * 7u) % 13u);
+    for(const auto codec : {CompressionCodec::BZip2, CompressionCodec::Zstd})
+    {
+        for(const auto level : {CompressionLevel::Fast, CompressionLevel::Default, CompressionLevel::Best})
+        {
+            const std::vector<char> compressed = CompressedData::compress(data, level, codec);
+            BOOST_TEST(compressed.size() < data.size());
+            // The codec is detected from the data
+            BOOST_TEST((CompressedData::getCodec(compressed) == codec));
+            BOOST_TEST(CompressedData::decompress(compressed, data.size()) == data, boost::test_tools::per_element());
+            BOOST_CHECK_THROW(CompressedData::decompress(compressed, data.size() - 1), std::runtime_error);
+        }
+    }
+    BOOST_CHECK_THROW(CompressedData::decompress(data, data.size()), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
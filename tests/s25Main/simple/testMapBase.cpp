@@ -11,6 +11,8 @@
 #include <rttr/test/random.hpp>
 #include <boost/test/unit_test.hpp>
 #include <array>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(WorldCreationSuite)
 
@@ -151,6 +153,92 @@ BOOST_AUTO_TEST_CASE(GetMatchingPointsInRadius)
     BOOST_TEST(firstEvenPt.front() == evenPts.front());
 }
 
+BOOST_AUTO_TEST_CASE(VisitPointsInRadius)
+{
+    MapBase world;
+    for(const MapExtent size : {MapExtent(20, 30), MapExtent(33, 80), MapExtent(100, 100)})
+    {
+        world.Resize(size);
+        // Points in the middle use the precomputed offsets, points close to the border wrap around
+        const std::vector<MapPoint> testPoints{MapPoint(0, 0),
+                                               MapPoint(size.x - 1, size.y - 1),
+                                               MapPoint(size.x / 2, size.y / 2),
+                                               MapPoint(size.x / 2, size.y / 2 + 1),
+                                               MapPoint(rttr::test::randomValue<MapCoord>(0, size.x - 1),
+                                                        rttr::test::randomValue<MapCoord>(0, size.y - 1))};
+        for(const MapPoint pt : testPoints)
+        {
+            for(const unsigned radius : {0u, 1u, 5u, 9u, rttr::test::randomValue(10u, 40u)})
+            {
+                // Expected: Walk around the rings using the neighbours
+                std::vector<std::pair<MapPoint, unsigned>> expected{{pt, 0u}};
+                MapPoint curStartPt = pt;
+                for(unsigned r = 1; r <= radius; ++r)
+                {
+                    curStartPt = world.GetNeighbour(curStartPt, Direction::West);
+                    MapPoint curPt = curStartPt;
+                    for(const auto dir : helpers::enumRange(Direction::NorthEast))
+                    {
+                        for(unsigned step = 0; step < r; ++step)
+                        {
+                            expected.emplace_back(curPt, r);
+                            curPt = world.GetNeighbour(curPt, dir);
+                        }
+                    }
+                }
+                std::vector<std::pair<MapPoint, unsigned>> visited;
+                const bool stopped = world.VisitPointsInRadius(
+                  pt, radius, [&visited](const MapPoint curPt, unsigned r) { visited.emplace_back(curPt, r); }, true);
+                BOOST_TEST(!stopped);
+                BOOST_TEST_REQUIRE(visited.size() == expected.size());
+                for(unsigned i = 0; i < visited.size(); i++)
+                {
+                    BOOST_TEST_REQUIRE(visited[i].first == expected[i].first);
+                    BOOST_TEST_REQUIRE(visited[i].second == expected[i].second);
+                    // Might be closer when wrapping around small maps
+                    BOOST_TEST_REQUIRE(world.CalcDistance(pt, visited[i].first) <= visited[i].second);
+                }
+                // Stop at some point
+                const unsigned stopIdx = rttr::test::randomValue(0u, static_cast<unsigned>(expected.size()) - 1u);
+                unsigned numVisited = 0;
+                BOOST_TEST(world.VisitPointsInRadius(
+                  pt, radius, [&numVisited, stopIdx](MapPoint, unsigned) { return numVisited++ == stopIdx; }, true));
+                BOOST_TEST(numVisited == stopIdx + 1u);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SumValuesInRadius)
+{
+    MapBase world;
+    // Include maps smaller than the radius where points are counted multiple times
+    for(const MapExtent size : {MapExtent(3, 4), MapExtent(20, 30), MapExtent(33, 80)})
+    {
+        world.Resize(size);
+        std::vector<int> values(prodOfComponents(size));
+        for(int& value : values)
+            value = rttr::test::randomValue(-40, 40);
+        for(const unsigned radius : {0u, 1u, 2u, 5u, 8u})
+        {
+            const std::vector<int> sums = world.SumValuesInRadius(values, radius);
+            BOOST_TEST_REQUIRE(sums.size() == values.size());
+            for(MapCoord y = 0; y < size.y; y++)
+            {
+                for(MapCoord x = 0; x < size.x; x++)
+                {
+                    const MapPoint pt(x, y);
+                    int expectedSum = 0;
+                    for(const MapPoint curPt : world.GetPointsInRadiusWithCenter(pt, radius))
+                        expectedSum += values[world.GetIdx(curPt)];
+                    BOOST_TEST_INFO(pt << " radius " << radius);
+                    BOOST_TEST(sums[world.GetIdx(pt)] == expectedSum);
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(GetIdx)
 {
     MapBase world;
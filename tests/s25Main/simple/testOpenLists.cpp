@@ -4,6 +4,7 @@
 
 #include "pathfinding/OpenListBinaryHeap.h"
 #include <rttr/test/random.hpp>
+#include <boost/mpl/list.hpp>
 #include <boost/test/unit_test.hpp>
 #include <algorithm>
 #include <iterator>
@@ -22,15 +23,15 @@ struct ListGetKey
     constexpr auto operator()(const ListEl& el) const { return el.key; }
 };
 
-using OpenListBase = OpenListBinaryHeap<ListEl, ListGetKey>;
-
-class OpenList : public OpenListBase
+template<unsigned T_Arity>
+class OpenList : public OpenListDaryHeap<ListEl, ListGetKey, T_Arity>
 {
 public:
-    using Parent = OpenListBase;
+    using Parent = OpenListDaryHeap<ListEl, ListGetKey, T_Arity>;
     using Parent::arePositionsValid;
     using Parent::isHeap;
 };
+using OpenListTypes = boost::mpl::list<OpenList<2>, OpenList<3>, OpenList<4>>;
 auto getSortedVector(unsigned ct, bool ascending)
 {
     std::vector<ListEl> elements;
@@ -50,9 +51,9 @@ auto getRandomVector(unsigned ct, unsigned maxVal = 100000)
 
 BOOST_AUTO_TEST_SUITE(OpenLists)
 
-BOOST_AUTO_TEST_CASE(PushTopWorks)
+BOOST_AUTO_TEST_CASE_TEMPLATE(PushTopWorks, T_OpenList, OpenListTypes)
 {
-    OpenList list;
+    T_OpenList list;
     BOOST_TEST_REQUIRE(list.isHeap());
     BOOST_TEST_REQUIRE(list.arePositionsValid());
     BOOST_TEST_REQUIRE(list.size() == 0u);
@@ -104,9 +105,9 @@ BOOST_AUTO_TEST_CASE(PushTopWorks)
     }
 }
 
-BOOST_AUTO_TEST_CASE(PopRemovesLowestElement)
+BOOST_AUTO_TEST_CASE_TEMPLATE(PopRemovesLowestElement, T_OpenList, OpenListTypes)
 {
-    OpenList list;
+    T_OpenList list;
 
     // Random vector with some duplicate elements
     auto elements = getRandomVector(rttr::test::randomValue(30u, 70u), 20);
@@ -135,9 +136,9 @@ BOOST_AUTO_TEST_CASE(PopRemovesLowestElement)
     BOOST_TEST(list.empty());
 }
 
-BOOST_AUTO_TEST_CASE(RearrangeMakesTheHeapValidAgain)
+BOOST_AUTO_TEST_CASE_TEMPLATE(RearrangeMakesTheHeapValidAgain, T_OpenList, OpenListTypes)
 {
-    OpenList list;
+    T_OpenList list;
 
     // Random vector with some duplicate elements
     auto elements = getRandomVector(rttr::test::randomValue(30u, 70u), 20);
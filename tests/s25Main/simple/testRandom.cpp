@@ -10,6 +10,7 @@
 #include <boost/test/unit_test.hpp>
 #include <limits>
 #include <random>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -71,6 +72,30 @@ BOOST_AUTO_TEST_CASE(RandomSameSeq)
     }
 }
 
+BOOST_AUTO_TEST_CASE(RandomPerThread)
+{
+    const auto GetObjId = []() { return 0u; }; // Fake function for RANDOM_RAND
+    // Each thread has its own RNG, so running another one must not change the sequence of this thread
+    RANDOM.Init(0x1337);
+    std::vector<int> expected, otherThreadResults;
+    for(unsigned i = 0; i < 10; i++)
+        expected.push_back(RANDOM_RAND(1024));
+    RANDOM.Init(0x1337);
+    std::vector<int> results;
+    for(unsigned i = 0; i < 5; i++)
+        results.push_back(RANDOM_RAND(1024));
+    std::thread otherThread([&]() {
+        RANDOM.Init(0x1337);
+        for(unsigned i = 0; i < 10; i++)
+            otherThreadResults.push_back(RANDOM_RAND(1024));
+    });
+    otherThread.join();
+    for(unsigned i = 0; i < 5; i++)
+        results.push_back(RANDOM_RAND(1024));
+    BOOST_TEST(results == expected, boost::test_tools::per_element());
+    BOOST_TEST(otherThreadResults == expected, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(ValueRangeValid, T_RNG, TestedRNGS)
 {
     for(unsigned seed : seeds)
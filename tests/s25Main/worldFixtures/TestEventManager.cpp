@@ -4,57 +4,36 @@
 
 #include "TestEventManager.h"
 #include "GameEvent.h"
+#include "helpers/containerUtils.h"
 
 unsigned TestEventManager::ExecuteNextEvent(unsigned maxGF)
 {
     if(GetCurrentGF() >= maxGF)
         return 0;
-    if(events.empty())
+    const unsigned startGF = GetCurrentGF();
+    const unsigned nextEventGF = GetNextEventGF();
+    if(nextEventGF > maxGF)
     {
-        unsigned numGFs = maxGF - GetCurrentGF();
-        currentGF = maxGF;
-        return numGFs;
+        AdvanceToGF(maxGF);
+        return maxGF - startGF;
     }
-    auto itEvents = events.begin();
-    if(itEvents->first > maxGF)
-    {
-        unsigned numGFs = maxGF - GetCurrentGF();
-        currentGF = maxGF;
-        return numGFs;
-    }
-    unsigned numGFs = itEvents->first - GetCurrentGF();
-    currentGF = itEvents->first;
-    ExecuteEvents(itEvents);
+    AdvanceToGF(nextEventGF);
+    ExecuteCurrentEvents();
     DestroyCurrentObjects();
-    return numGFs;
+    return nextEventGF - startGF;
 }
 
 std::vector<const GameEvent*> TestEventManager::GetObjEvents(const GameObject& obj) const
 {
-    std::vector<const GameEvent*> objEvnts;
-    for(const auto& event : events)
-    {
-        for(const GameEvent* ev : event.second)
-        {
-            if(ev->obj == &obj)
-                objEvnts.push_back(ev);
-        }
-    }
+    std::vector<const GameEvent*> objEvnts = GetEvents();
+    helpers::erase_if(objEvnts, [&obj](const GameEvent* ev) { return ev->obj != &obj; });
     return objEvnts;
 }
 
 bool TestEventManager::IsEventActive(const GameObject& obj, const unsigned id) const
 {
-    for(const auto& event : events)
-    {
-        for(const GameEvent* ev : event.second)
-        {
-            if(ev->id == id && ev->obj == &obj)
-                return true;
-        }
-    }
-
-    return false;
+    return helpers::contains_if(GetEvents(),
+                                [&obj, id](const GameEvent* ev) { return ev->id == id && ev->obj == &obj; });
 }
 
 const GameEvent* TestEventManager::RescheduleEvent(const GameEvent* event, unsigned targetGF)
@@ -127,5 +127,6 @@ protected:
     // LCOV_EXCL_START
     void AltitudeChanged(MapPoint) override {}
     void VisibilityChanged(MapPoint, unsigned, Visibility, Visibility) override {}
+    void PassabilityChanged(MapPoint) override {}
     // LCOV_EXCL_STOP
 };